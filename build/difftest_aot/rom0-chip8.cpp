@@ -0,0 +1,401 @@
+// Generated by chip8_recompile from rom0-chip8.ch8 (chip8 profile). Do not edit.
+#include "aot.h"
+
+namespace {
+
+using X = CompiledRomAccess;
+using Quirks = Chip8Quirks;
+
+// 0x200 - 0x201 (call)
+uint32_t block_200(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x200:  // CALL 0x202
+        X::call(c, 0x200, 0x202);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x202 - 0x203 (call)
+uint32_t block_202(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x202:  // CALL 0x204
+        X::call(c, 0x202, 0x204);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x204 - 0x205 (call)
+uint32_t block_204(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x204:  // CALL 0x206
+        X::call(c, 0x204, 0x206);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x206 - 0x207 (call)
+uint32_t block_206(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x206:  // CALL 0x208
+        X::call(c, 0x206, 0x208);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x208 - 0x209 (call)
+uint32_t block_208(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x208:  // CALL 0x20A
+        X::call(c, 0x208, 0x20A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20A - 0x20B (call)
+uint32_t block_20A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20A:  // CALL 0x20C
+        X::call(c, 0x20A, 0x20C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20C - 0x20D (call)
+uint32_t block_20C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20C:  // CALL 0x20E
+        X::call(c, 0x20C, 0x20E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20E - 0x20F (call)
+uint32_t block_20E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20E:  // CALL 0x210
+        X::call(c, 0x20E, 0x210);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x210 - 0x211 (call)
+uint32_t block_210(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x210:  // CALL 0x212
+        X::call(c, 0x210, 0x212);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x212 - 0x213 (call)
+uint32_t block_212(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x212:  // CALL 0x214
+        X::call(c, 0x212, 0x214);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x214 - 0x215 (call)
+uint32_t block_214(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x214:  // CALL 0x216
+        X::call(c, 0x214, 0x216);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x216 - 0x217 (call)
+uint32_t block_216(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x216:  // CALL 0x218
+        X::call(c, 0x216, 0x218);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x218 - 0x219 (call)
+uint32_t block_218(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x218:  // CALL 0x21A
+        X::call(c, 0x218, 0x21A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21A - 0x21B (call)
+uint32_t block_21A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21A:  // CALL 0x21C
+        X::call(c, 0x21A, 0x21C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21C - 0x21D (call)
+uint32_t block_21C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21C:  // CALL 0x21E
+        X::call(c, 0x21C, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21E - 0x21F (call)
+uint32_t block_21E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21E:  // CALL 0x220
+        X::call(c, 0x21E, 0x220);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x220 - 0x22B (indirect)
+uint32_t block_220(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x220:  // DRW V2, V7, 6
+        pc = 0x220;
+        if (X::interpret<Quirks>(c, 0xD276)) { return n + 1; }
+        if (++n == budget) { pc = 0x222; return n; }
+        [[fallthrough]];
+    case 0x222:  // DRW VC, VB, 8
+        pc = 0x222;
+        if (X::interpret<Quirks>(c, 0xDCB8)) { return n + 1; }
+        if (++n == budget) { pc = 0x224; return n; }
+        [[fallthrough]];
+    case 0x224:  // LD I, 0xC08
+        I = 0xC08;
+        if (++n == budget) { pc = 0x226; return n; }
+        [[fallthrough]];
+    case 0x226:  // DRW VD, V9, 0
+        pc = 0x226;
+        if (X::interpret<Quirks>(c, 0xDD90)) { return n + 1; }
+        if (++n == budget) { pc = 0x228; return n; }
+        [[fallthrough]];
+    case 0x228:  // LD V0, 0xB6
+        V[0x0] = 0xB6;
+        if (++n == budget) { pc = 0x22A; return n; }
+        [[fallthrough]];
+    case 0x22A:  // JP V0, 0x260
+        pc = 0x22A;
+        X::interpret<Quirks>(c, 0xB260);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+const CompiledBlock BLOCKS[] = {
+    {0x200, 0x202, block_200},
+    {0x202, 0x204, block_202},
+    {0x204, 0x206, block_204},
+    {0x206, 0x208, block_206},
+    {0x208, 0x20A, block_208},
+    {0x20A, 0x20C, block_20A},
+    {0x20C, 0x20E, block_20C},
+    {0x20E, 0x210, block_20E},
+    {0x210, 0x212, block_210},
+    {0x212, 0x214, block_212},
+    {0x214, 0x216, block_214},
+    {0x216, 0x218, block_216},
+    {0x218, 0x21A, block_218},
+    {0x21A, 0x21C, block_21A},
+    {0x21C, 0x21E, block_21C},
+    {0x21E, 0x220, block_21E},
+    {0x220, 0x22C, block_220},
+};
+
+const uint8_t IMAGE[] = {
+    0x22, 0x02, 0x22, 0x04, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0A, 0x22, 0x0C, 0x22, 0x0E, 0x22, 0x10,
+    0x22, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1A, 0x22, 0x1C, 0x22, 0x1E, 0x22, 0x20,
+    0xD2, 0x76, 0xDC, 0xB8, 0xAC, 0x08, 0xDD, 0x90, 0x60, 0xB6, 0xB2, 0x60, 0x61, 0xD3, 0x76, 0x6B,
+    0xF9, 0x55, 0x60, 0x07, 0x00, 0xE0, 0xA6, 0x1D, 0xE5, 0x9E, 0x13, 0x7A, 0xCD, 0xDB, 0x22, 0x98,
+    0x67, 0x30, 0x23, 0xB2, 0xC6, 0x1E, 0x64, 0xEC, 0xCF, 0x32, 0x31, 0xBD, 0x5A, 0x50, 0x00, 0xE0,
+    0x13, 0xC6, 0xD0, 0x84, 0xD2, 0x28, 0xFC, 0x29, 0x13, 0xD6, 0x13, 0xEA, 0x4E, 0x32, 0x46, 0x29,
+    0xE0, 0xA1, 0xD2, 0x66, 0xA8, 0xDF, 0xD1, 0x07, 0x23, 0x68, 0x82, 0xD3, 0x69, 0xAB, 0x62, 0x91,
+    0x47, 0x37, 0x00, 0xE0, 0xC7, 0x9B, 0xC6, 0x7B, 0xF5, 0x29, 0x13, 0x84, 0xEF, 0x9E, 0x84, 0x3E,
+    0x12, 0x40, 0xD6, 0x81, 0xC0, 0xD8, 0xC7, 0xBD, 0xE2, 0x9E, 0x41, 0xCA, 0x12, 0xE2, 0x22, 0x7E,
+    0xA3, 0x2E, 0x4F, 0xE5, 0x8E, 0x9E, 0x13, 0x8A, 0x62, 0xC9, 0x73, 0xD0, 0x71, 0x4C, 0xD6, 0x75,
+    0xE0, 0xA1, 0x00, 0xE0, 0x13, 0xFA, 0x82, 0x43, 0x40, 0x13, 0xD0, 0x3B, 0xD0, 0xFF, 0x8D, 0xFE,
+    0x12, 0x00, 0xC7, 0xAE, 0x13, 0x22, 0x75, 0xAB, 0xDA, 0x39, 0xEB, 0x9E, 0x00, 0xE0, 0x46, 0xF2,
+    0xCA, 0xA5, 0xC9, 0x8C, 0xA6, 0x55, 0xC4, 0x5A, 0x13, 0xCA, 0xF0, 0x1E, 0x35, 0x85, 0x87, 0xA6,
+    0x13, 0x96, 0xFC, 0x15, 0x31, 0x8A, 0x72, 0xAB, 0xA8, 0x01, 0xD5, 0xEC, 0x40, 0x01, 0x23, 0x32,
+    0xE9, 0x9E, 0x12, 0x7A, 0x30, 0xFC, 0x13, 0x60, 0xA3, 0x6A, 0x00, 0xE0, 0x13, 0x72, 0xF9, 0x07,
+    0x42, 0x37, 0xF5, 0x18, 0x60, 0x44, 0xB2, 0xF8, 0x66, 0x02, 0x6C, 0x66, 0xDC, 0x09, 0x00, 0xE0,
+    0x60, 0x50, 0xB2, 0xF4, 0x00, 0xE0, 0x13, 0x46, 0x86, 0x35, 0x39, 0x22, 0x33, 0x4C, 0x00, 0xE0,
+    0x95, 0xA0, 0x13, 0x44, 0x13, 0x94, 0x79, 0x88, 0xC1, 0x3F, 0x6D, 0x1D, 0x13, 0x7C, 0x36, 0xEC,
+    0xFB, 0x65, 0xD2, 0xDC, 0xC4, 0x2B, 0x13, 0x16, 0x23, 0x2A, 0xAA, 0x92, 0x61, 0x59, 0x59, 0xD0,
+    0x00, 0xE0, 0x66, 0xA4, 0x13, 0xF4, 0xF5, 0x07, 0x00, 0xE0, 0x00, 0xE0, 0x22, 0xD6, 0xCF, 0x7D,
+    0x8B, 0x41, 0xA0, 0x30, 0xD3, 0x3B, 0x75, 0x90, 0x12, 0x82, 0xCB, 0x67, 0xC6, 0x90, 0x00, 0xE0,
+    0x13, 0xC4, 0xD6, 0x37, 0x23, 0x40, 0x38, 0xD1, 0x5C, 0x22, 0xCC, 0x88, 0x22, 0xA8, 0x60, 0x72,
+    0xB2, 0x86, 0x4D, 0x50, 0xD4, 0x44, 0xAF, 0x69, 0x88, 0xF0, 0x12, 0x04, 0x42, 0x11, 0xE8, 0x9E,
+    0x97, 0xF0, 0x84, 0x25, 0x13, 0xE4, 0x7A, 0x92, 0x8B, 0xE7, 0x12, 0xDC, 0x00, 0xE0, 0x57, 0xA0,
+    0x70, 0x98, 0xD9, 0x4B, 0x60, 0xB3, 0x12, 0x10, 0xAB, 0xD5, 0x78, 0x27, 0x12, 0x34, 0xAC, 0x29,
+    0xEC, 0xA1, 0x83, 0xB0, 0x3C, 0x38, 0x12, 0x82, 0xFD, 0x1E, 0xA4, 0x35, 0xAD, 0x7F, 0x8A, 0x64,
+    0x13, 0xB6, 0x61, 0x90, 0xC4, 0x9F, 0xEB, 0xA1, 0xE2, 0x9E, 0x7F, 0x25, 0xD1, 0x8A, 0x13, 0x36,
+    0xBE, 0x5D, 0xA3, 0xAA, 0x60, 0xCA, 0xB2, 0xCA, 0xC8, 0x83, 0x13, 0xCC, 0x12, 0x92, 0x12, 0xA6,
+    0x13, 0x82, 0x84, 0x25, 0xDA, 0x83, 0x23, 0x4E, 0x6A, 0x84, 0xC5, 0x89, 0x82, 0x55, 0x23, 0xBE,
+    0xA0, 0x41, 0x72, 0x65, 0x12, 0x8E, 0x81, 0x6E, 0xC0, 0xD9, 0x9F, 0x40, 0xDA, 0x7D, 0x84, 0x95,
+    0x87, 0xB1, 0x82, 0x12, 0x22, 0x4E, 0x93, 0xD0, 0x12, 0xD4, 0x54, 0x90, 0x60, 0xDA, 0xB2, 0x42,
+    0x00, 0xE0, 0x13, 0xA2, 0x70, 0x7F, 0x49, 0x84, 0xE4, 0x9E, 0x5B, 0xF0, 0x12, 0x00, 0x12, 0x00,
+};
+
+const CompiledRom ROM = {
+    0xEA7CCBD7CB3F60CBULL, 512, QuirkProfile::Chip8, "rom0-chip8.ch8",
+    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE
+};
+
+const CompiledRomRegistrar REGISTRAR(&ROM);
+
+}  // namespace
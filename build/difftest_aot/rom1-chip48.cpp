@@ -0,0 +1,683 @@
+// Generated by chip8_recompile from rom1-chip48.ch8 (chip48 profile). Do not edit.
+#include "aot.h"
+
+namespace {
+
+using X = CompiledRomAccess;
+using Quirks = Chip48Quirks;
+
+// 0x200 - 0x201 (call)
+uint32_t block_200(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x200:  // CALL 0x202
+        X::call(c, 0x200, 0x202);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x202 - 0x203 (call)
+uint32_t block_202(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x202:  // CALL 0x204
+        X::call(c, 0x202, 0x204);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x204 - 0x205 (call)
+uint32_t block_204(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x204:  // CALL 0x206
+        X::call(c, 0x204, 0x206);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x206 - 0x207 (call)
+uint32_t block_206(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x206:  // CALL 0x208
+        X::call(c, 0x206, 0x208);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x208 - 0x209 (call)
+uint32_t block_208(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x208:  // CALL 0x20A
+        X::call(c, 0x208, 0x20A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20A - 0x20B (call)
+uint32_t block_20A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20A:  // CALL 0x20C
+        X::call(c, 0x20A, 0x20C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20C - 0x20D (call)
+uint32_t block_20C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20C:  // CALL 0x20E
+        X::call(c, 0x20C, 0x20E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20E - 0x20F (call)
+uint32_t block_20E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20E:  // CALL 0x210
+        X::call(c, 0x20E, 0x210);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x210 - 0x211 (call)
+uint32_t block_210(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x210:  // CALL 0x212
+        X::call(c, 0x210, 0x212);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x212 - 0x213 (call)
+uint32_t block_212(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x212:  // CALL 0x214
+        X::call(c, 0x212, 0x214);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x214 - 0x215 (call)
+uint32_t block_214(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x214:  // CALL 0x216
+        X::call(c, 0x214, 0x216);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x216 - 0x217 (call)
+uint32_t block_216(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x216:  // CALL 0x218
+        X::call(c, 0x216, 0x218);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x218 - 0x219 (call)
+uint32_t block_218(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x218:  // CALL 0x21A
+        X::call(c, 0x218, 0x21A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21A - 0x21B (call)
+uint32_t block_21A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21A:  // CALL 0x21C
+        X::call(c, 0x21A, 0x21C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21C - 0x21D (call)
+uint32_t block_21C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21C:  // CALL 0x21E
+        X::call(c, 0x21C, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21E - 0x21F (call)
+uint32_t block_21E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21E:  // CALL 0x220
+        X::call(c, 0x21E, 0x220);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x220 - 0x223 (jump)
+uint32_t block_220(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x220:  // ADD VD, 0x79
+        V[0xD] = static_cast<uint8_t>(V[0xD] + 0x79);
+        if (++n == budget) { pc = 0x222; return n; }
+        [[fallthrough]];
+    case 0x222:  // JP 0x3DC
+        pc = 0x3DC;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x276 - 0x279 (call)
+uint32_t block_276(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x276:  // LD V0, 0x73
+        V[0x0] = 0x73;
+        if (++n == budget) { pc = 0x278; return n; }
+        [[fallthrough]];
+    case 0x278:  // CALL 0x342
+        X::call(c, 0x278, 0x342);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x27A - 0x285 (indirect)
+uint32_t block_27A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x27A:  // DRW VA, VB, 4
+        pc = 0x27A;
+        if (X::interpret<Quirks>(c, 0xDAB4)) { return n + 1; }
+        if (++n == budget) { pc = 0x27C; return n; }
+        [[fallthrough]];
+    case 0x27C:  // LD [I], VC
+        pc = 0x27C;
+        if (X::interpret<Quirks>(c, 0xFC55)) { return n + 1; }
+        if (++n == budget) { pc = 0x27E; return n; }
+        [[fallthrough]];
+    case 0x27E:  // LD VA, 0xAF
+        V[0xA] = 0xAF;
+        if (++n == budget) { pc = 0x280; return n; }
+        [[fallthrough]];
+    case 0x280:  // SHL VE, V4
+        { uint8_t source = V[0xE]; V[0xE] = static_cast<uint8_t>(source << 1); V[0xF] = (source & 0x80) >> 7; }
+        if (++n == budget) { pc = 0x282; return n; }
+        [[fallthrough]];
+    case 0x282:  // LD V2, 0x02
+        V[0x2] = 0x02;
+        if (++n == budget) { pc = 0x284; return n; }
+        [[fallthrough]];
+    case 0x284:  // JP V0, 0x22C
+        pc = 0x284;
+        X::interpret<Quirks>(c, 0xB22C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2A8 - 0x2AB (jump)
+uint32_t block_2A8(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2A8:  // RND V6, 0xF1
+        pc = 0x2A8;
+        if (X::interpret<Quirks>(c, 0xC6F1)) { return n + 1; }
+        if (++n == budget) { pc = 0x2AA; return n; }
+        [[fallthrough]];
+    case 0x2AA:  // JP 0x276
+        pc = 0x276;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x342 - 0x343 (return)
+uint32_t block_342(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x342:  // RET
+        X::ret(c);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3B4 - 0x3B5 (jump)
+uint32_t block_3B4(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3B4:  // JP 0x2A8
+        pc = 0x2A8;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3DC - 0x3DD (skip)
+uint32_t block_3DC(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3DC:  // SE V9, 0x42
+        pc = (V[0x9] == 0x42) ? 0x3E0 : 0x3DE;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3DE - 0x3DF (fallthrough)
+uint32_t block_3DE(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3DE:  // ADD V7, 0xB9
+        V[0x7] = static_cast<uint8_t>(V[0x7] + 0xB9);
+        pc = 0x3E0;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3E0 - 0x3E7 (skip)
+uint32_t block_3E0(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3E0:  // ADD V8, 0x63
+        V[0x8] = static_cast<uint8_t>(V[0x8] + 0x63);
+        if (++n == budget) { pc = 0x3E2; return n; }
+        [[fallthrough]];
+    case 0x3E2:  // LD VE, 0x70
+        V[0xE] = 0x70;
+        if (++n == budget) { pc = 0x3E4; return n; }
+        [[fallthrough]];
+    case 0x3E4:  // SHL V6, VD
+        { uint8_t source = V[0x6]; V[0x6] = static_cast<uint8_t>(source << 1); V[0xF] = (source & 0x80) >> 7; }
+        if (++n == budget) { pc = 0x3E6; return n; }
+        [[fallthrough]];
+    case 0x3E6:  // SE V8, 0x8B
+        pc = (V[0x8] == 0x8B) ? 0x3EA : 0x3E8;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3E8 - 0x3E9 (return)
+uint32_t block_3E8(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3E8:  // RET
+        X::ret(c);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3EA - 0x3EB (call)
+uint32_t block_3EA(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3EA:  // CALL 0x3B4
+        X::call(c, 0x3EA, 0x3B4);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3EC - 0x3EF (skip)
+uint32_t block_3EC(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3EC:  // ADD V9, 0x9C
+        V[0x9] = static_cast<uint8_t>(V[0x9] + 0x9C);
+        if (++n == budget) { pc = 0x3EE; return n; }
+        [[fallthrough]];
+    case 0x3EE:  // SE V5, 0xCF
+        pc = (V[0x5] == 0xCF) ? 0x3F2 : 0x3F0;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3F0 - 0x3F1 (fallthrough)
+uint32_t block_3F0(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3F0:  // LD I, 0xB3F
+        I = 0xB3F;
+        pc = 0x3F2;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3F2 - 0x3F5 (indirect)
+uint32_t block_3F2(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3F2:  // LD V2, 0x2E
+        V[0x2] = 0x2E;
+        if (++n == budget) { pc = 0x3F4; return n; }
+        [[fallthrough]];
+    case 0x3F4:  // JP V0, 0x2DC
+        pc = 0x3F4;
+        X::interpret<Quirks>(c, 0xB2DC);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+const CompiledBlock BLOCKS[] = {
+    {0x200, 0x202, block_200},
+    {0x202, 0x204, block_202},
+    {0x204, 0x206, block_204},
+    {0x206, 0x208, block_206},
+    {0x208, 0x20A, block_208},
+    {0x20A, 0x20C, block_20A},
+    {0x20C, 0x20E, block_20C},
+    {0x20E, 0x210, block_20E},
+    {0x210, 0x212, block_210},
+    {0x212, 0x214, block_212},
+    {0x214, 0x216, block_214},
+    {0x216, 0x218, block_216},
+    {0x218, 0x21A, block_218},
+    {0x21A, 0x21C, block_21A},
+    {0x21C, 0x21E, block_21C},
+    {0x21E, 0x220, block_21E},
+    {0x220, 0x224, block_220},
+    {0x276, 0x27A, block_276},
+    {0x27A, 0x286, block_27A},
+    {0x2A8, 0x2AC, block_2A8},
+    {0x342, 0x344, block_342},
+    {0x3B4, 0x3B6, block_3B4},
+    {0x3DC, 0x3DE, block_3DC},
+    {0x3DE, 0x3E0, block_3DE},
+    {0x3E0, 0x3E8, block_3E0},
+    {0x3E8, 0x3EA, block_3E8},
+    {0x3EA, 0x3EC, block_3EA},
+    {0x3EC, 0x3F0, block_3EC},
+    {0x3F0, 0x3F2, block_3F0},
+    {0x3F2, 0x3F6, block_3F2},
+};
+
+const uint8_t IMAGE[] = {
+    0x22, 0x02, 0x22, 0x04, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0A, 0x22, 0x0C, 0x22, 0x0E, 0x22, 0x10,
+    0x22, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1A, 0x22, 0x1C, 0x22, 0x1E, 0x22, 0x20,
+    0x7D, 0x79, 0x13, 0xDC, 0x13, 0xC8, 0x71, 0x36, 0x34, 0x16, 0xC2, 0xC6, 0x77, 0xDF, 0xA3, 0x10,
+    0x82, 0xA2, 0x23, 0xA6, 0xC6, 0x89, 0x12, 0x4A, 0x13, 0xE8, 0x12, 0xE2, 0xCB, 0x1C, 0xD4, 0x13,
+    0x12, 0x9C, 0xF1, 0x29, 0x22, 0x72, 0x12, 0xBA, 0x22, 0x6E, 0xD5, 0x37, 0xC4, 0xFE, 0x96, 0x70,
+    0x42, 0xFD, 0x8C, 0xB3, 0x23, 0x66, 0x6B, 0x15, 0xA4, 0x47, 0x6A, 0x83, 0x5C, 0x20, 0xCA, 0x61,
+    0xA8, 0xFC, 0x66, 0x53, 0xDC, 0x20, 0x23, 0x0A, 0xDE, 0x32, 0x12, 0x0C, 0xAB, 0xAC, 0x95, 0x00,
+    0x12, 0x36, 0xDD, 0x4E, 0xDB, 0x27, 0x60, 0x73, 0x23, 0x42, 0xDA, 0xB4, 0xFC, 0x55, 0x6A, 0xAF,
+    0x8E, 0x4E, 0x62, 0x02, 0xB2, 0x2C, 0x13, 0xC6, 0xF8, 0x55, 0x6C, 0x48, 0xC1, 0xA2, 0x62, 0x7C,
+    0xB2, 0x02, 0x67, 0x97, 0xE5, 0xA1, 0x3B, 0xB6, 0xFD, 0x55, 0xD4, 0x3A, 0x9D, 0xD0, 0x42, 0x6C,
+    0x42, 0xD8, 0x97, 0xE0, 0x85, 0x11, 0x00, 0xEE, 0xC6, 0xF1, 0x12, 0x76, 0x13, 0xCA, 0x98, 0x20,
+    0xCB, 0xFC, 0xCE, 0x10, 0x88, 0x96, 0x7E, 0x64, 0x13, 0x7A, 0xEE, 0x9E, 0x13, 0x50, 0xD5, 0x0F,
+    0xAC, 0xA4, 0x88, 0x46, 0x90, 0x50, 0x23, 0x6E, 0x70, 0x56, 0x78, 0xBC, 0x70, 0xBA, 0x12, 0x06,
+    0xE0, 0xA1, 0x40, 0xFF, 0xA2, 0xE4, 0x70, 0x53, 0xFB, 0x07, 0x71, 0x10, 0x76, 0xA1, 0xEE, 0xA1,
+    0x38, 0x2E, 0x33, 0x39, 0x8F, 0xC5, 0xC7, 0x7B, 0xA2, 0x9F, 0x00, 0xE0, 0x12, 0x68, 0x56, 0xE3,
+    0x45, 0x1E, 0x13, 0xA4, 0x84, 0x16, 0xD4, 0x51, 0x7A, 0xBF, 0x62, 0xD2, 0xB2, 0xD2, 0x00, 0xE0,
+    0x12, 0xFE, 0x9A, 0x40, 0x23, 0x28, 0x03, 0xBB, 0x62, 0x58, 0xB2, 0x18, 0x13, 0xE4, 0x5F, 0xF0,
+    0x9B, 0xB0, 0xEA, 0xA1, 0xD4, 0xDE, 0x6A, 0x8E, 0x67, 0xF2, 0x4A, 0x41, 0x13, 0x72, 0x12, 0x9A,
+    0x12, 0x32, 0x9B, 0x80, 0x13, 0xBC, 0x12, 0x26, 0x22, 0x06, 0xA4, 0x14, 0x82, 0x62, 0xFF, 0x07,
+    0x8A, 0x8E, 0x13, 0x4A, 0xA8, 0xAD, 0x00, 0xE0, 0x7E, 0x0B, 0x90, 0xF0, 0x12, 0xB0, 0x4D, 0x99,
+    0xCA, 0x95, 0x00, 0xEE, 0xC6, 0x31, 0x84, 0x26, 0x4E, 0xC4, 0x6D, 0xF6, 0xEF, 0xA1, 0xD7, 0xF8,
+    0x00, 0xE0, 0xAA, 0x17, 0x83, 0xE0, 0x41, 0xEB, 0x12, 0xDE, 0x32, 0x8B, 0xCD, 0x91, 0x50, 0xA0,
+    0x13, 0x20, 0x13, 0x34, 0x23, 0x4E, 0x8F, 0x71, 0x75, 0x91, 0x12, 0xBC, 0xA7, 0x1E, 0x8B, 0x41,
+    0x6C, 0xE6, 0xD8, 0xDE, 0xE6, 0x9E, 0xF4, 0x15, 0x23, 0x66, 0x8C, 0x01, 0xC8, 0x72, 0x98, 0x40,
+    0x89, 0x30, 0x93, 0xD0, 0x12, 0x04, 0x85, 0xC0, 0xDD, 0x05, 0x9F, 0xA0, 0x82, 0x12, 0xC9, 0xCE,
+    0x13, 0x04, 0x12, 0x14, 0xCC, 0x97, 0x99, 0x90, 0x86, 0x92, 0xC3, 0x89, 0x62, 0x1A, 0x55, 0x40,
+    0x69, 0x02, 0x8A, 0xD6, 0x6F, 0x64, 0x81, 0x52, 0xA4, 0xC4, 0xCE, 0xE7, 0xF1, 0x07, 0xD1, 0x38,
+    0xDB, 0x00, 0xA6, 0xE0, 0x12, 0xA8, 0xDB, 0xC6, 0xD9, 0x73, 0x42, 0xDF, 0xFD, 0x0A, 0x38, 0x12,
+    0xFC, 0x1E, 0xAD, 0x9A, 0xDB, 0x09, 0x97, 0x00, 0xD1, 0x98, 0xF5, 0x65, 0x13, 0x3C, 0x43, 0xC6,
+    0x00, 0xE0, 0xC5, 0x39, 0x12, 0xC2, 0x62, 0x14, 0xB2, 0x9E, 0x5C, 0x50, 0x39, 0x42, 0x77, 0xB9,
+    0x78, 0x63, 0x6E, 0x70, 0x86, 0xDE, 0x38, 0x8B, 0x00, 0xEE, 0x23, 0xB4, 0x79, 0x9C, 0x35, 0xCF,
+    0xAB, 0x3F, 0x62, 0x2E, 0xB2, 0xDC, 0xDC, 0x0B, 0x13, 0x56, 0x13, 0xAE, 0x12, 0x00, 0x12, 0x00,
+};
+
+const CompiledRom ROM = {
+    0x3FD083933EBA37C8ULL, 512, QuirkProfile::Chip48, "rom1-chip48.ch8",
+    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE
+};
+
+const CompiledRomRegistrar REGISTRAR(&ROM);
+
+}  // namespace
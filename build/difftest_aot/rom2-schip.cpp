@@ -0,0 +1,629 @@
+// Generated by chip8_recompile from rom2-schip.ch8 (schip profile). Do not edit.
+#include "aot.h"
+
+namespace {
+
+using X = CompiledRomAccess;
+using Quirks = SuperChipQuirks;
+
+// 0x200 - 0x201 (call)
+uint32_t block_200(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x200:  // CALL 0x202
+        X::call(c, 0x200, 0x202);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x202 - 0x203 (call)
+uint32_t block_202(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x202:  // CALL 0x204
+        X::call(c, 0x202, 0x204);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x204 - 0x205 (call)
+uint32_t block_204(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x204:  // CALL 0x206
+        X::call(c, 0x204, 0x206);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x206 - 0x207 (call)
+uint32_t block_206(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x206:  // CALL 0x208
+        X::call(c, 0x206, 0x208);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x208 - 0x209 (call)
+uint32_t block_208(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x208:  // CALL 0x20A
+        X::call(c, 0x208, 0x20A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20A - 0x20B (call)
+uint32_t block_20A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20A:  // CALL 0x20C
+        X::call(c, 0x20A, 0x20C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20C - 0x20D (call)
+uint32_t block_20C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20C:  // CALL 0x20E
+        X::call(c, 0x20C, 0x20E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20E - 0x20F (call)
+uint32_t block_20E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20E:  // CALL 0x210
+        X::call(c, 0x20E, 0x210);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x210 - 0x211 (call)
+uint32_t block_210(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x210:  // CALL 0x212
+        X::call(c, 0x210, 0x212);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x212 - 0x213 (call)
+uint32_t block_212(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x212:  // CALL 0x214
+        X::call(c, 0x212, 0x214);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x214 - 0x215 (call)
+uint32_t block_214(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x214:  // CALL 0x216
+        X::call(c, 0x214, 0x216);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x216 - 0x217 (call)
+uint32_t block_216(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x216:  // CALL 0x218
+        X::call(c, 0x216, 0x218);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x218 - 0x219 (call)
+uint32_t block_218(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x218:  // CALL 0x21A
+        X::call(c, 0x218, 0x21A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21A - 0x21B (call)
+uint32_t block_21A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21A:  // CALL 0x21C
+        X::call(c, 0x21A, 0x21C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21C - 0x21D (call)
+uint32_t block_21C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21C:  // CALL 0x21E
+        X::call(c, 0x21C, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21E - 0x21F (call)
+uint32_t block_21E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21E:  // CALL 0x220
+        X::call(c, 0x21E, 0x220);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x220 - 0x221 (skip)
+uint32_t block_220(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x220:  // SKP V7
+        pc = 0x220;
+        X::interpret<Quirks>(c, 0xE79E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x222 - 0x223 (fallthrough)
+uint32_t block_222(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x222:  // LD I, 0x387
+        I = 0x387;
+        pc = 0x224;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x224 - 0x225 (jump)
+uint32_t block_224(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x224:  // JP 0x342
+        pc = 0x342;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x276 - 0x277 (skip)
+uint32_t block_276(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x276:  // SE VB, VD
+        pc = (V[0xB] == V[0xD]) ? 0x27A : 0x278;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x278 - 0x279 (call)
+uint32_t block_278(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x278:  // CALL 0x21E
+        X::call(c, 0x278, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x27A - 0x27D (skip)
+uint32_t block_27A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x27A:  // RND V1, 0x4F
+        pc = 0x27A;
+        if (X::interpret<Quirks>(c, 0xC14F)) { return n + 1; }
+        if (++n == budget) { pc = 0x27C; return n; }
+        [[fallthrough]];
+    case 0x27C:  // SE V7, 0x3F
+        pc = (V[0x7] == 0x3F) ? 0x280 : 0x27E;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x27E - 0x27F (fallthrough)
+uint32_t block_27E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x27E:  // DRW V4, V7, 9
+        pc = 0x27E;
+        if (X::interpret<Quirks>(c, 0xD479)) { return n + 1; }
+        pc = 0x280;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x280 - 0x283 (indirect)
+uint32_t block_280(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x280:  // LD V2, 0xD6
+        V[0x2] = 0xD6;
+        if (++n == budget) { pc = 0x282; return n; }
+        [[fallthrough]];
+    case 0x282:  // JP V0, 0x238
+        pc = 0x282;
+        X::interpret<Quirks>(c, 0xB238);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x342 - 0x345 (skip)
+uint32_t block_342(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x342:  // DRW V4, VC, E
+        pc = 0x342;
+        if (X::interpret<Quirks>(c, 0xD4CE)) { return n + 1; }
+        if (++n == budget) { pc = 0x344; return n; }
+        [[fallthrough]];
+    case 0x344:  // SE V5, VF
+        pc = (V[0x5] == V[0xF]) ? 0x348 : 0x346;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x346 - 0x347 (skip)
+uint32_t block_346(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x346:  // SNE V2, 0x9E
+        pc = (V[0x2] != 0x9E) ? 0x34A : 0x348;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x348 - 0x349 (jump)
+uint32_t block_348(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x348:  // JP 0x3F4
+        pc = 0x3F4;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x34A - 0x34B (jump)
+uint32_t block_34A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x34A:  // JP 0x214
+        pc = 0x214;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3F4 - 0x3F7 (jump)
+uint32_t block_3F4(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3F4:  // DRW V4, V2, 1
+        pc = 0x3F4;
+        if (X::interpret<Quirks>(c, 0xD421)) { return n + 1; }
+        if (++n == budget) { pc = 0x3F6; return n; }
+        [[fallthrough]];
+    case 0x3F6:  // JP 0x276
+        pc = 0x276;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+const CompiledBlock BLOCKS[] = {
+    {0x200, 0x202, block_200},
+    {0x202, 0x204, block_202},
+    {0x204, 0x206, block_204},
+    {0x206, 0x208, block_206},
+    {0x208, 0x20A, block_208},
+    {0x20A, 0x20C, block_20A},
+    {0x20C, 0x20E, block_20C},
+    {0x20E, 0x210, block_20E},
+    {0x210, 0x212, block_210},
+    {0x212, 0x214, block_212},
+    {0x214, 0x216, block_214},
+    {0x216, 0x218, block_216},
+    {0x218, 0x21A, block_218},
+    {0x21A, 0x21C, block_21A},
+    {0x21C, 0x21E, block_21C},
+    {0x21E, 0x220, block_21E},
+    {0x220, 0x222, block_220},
+    {0x222, 0x224, block_222},
+    {0x224, 0x226, block_224},
+    {0x276, 0x278, block_276},
+    {0x278, 0x27A, block_278},
+    {0x27A, 0x27E, block_27A},
+    {0x27E, 0x280, block_27E},
+    {0x280, 0x284, block_280},
+    {0x342, 0x346, block_342},
+    {0x346, 0x348, block_346},
+    {0x348, 0x34A, block_348},
+    {0x34A, 0x34C, block_34A},
+    {0x3F4, 0x3F8, block_3F4},
+};
+
+const uint8_t IMAGE[] = {
+    0x22, 0x02, 0x22, 0x04, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0A, 0x22, 0x0C, 0x22, 0x0E, 0x22, 0x10,
+    0x22, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1A, 0x22, 0x1C, 0x22, 0x1E, 0x22, 0x20,
+    0xE7, 0x9E, 0xA3, 0x87, 0x13, 0x42, 0x4E, 0x65, 0x12, 0xAA, 0xF2, 0x30, 0x00, 0xFE, 0xD7, 0x61,
+    0x84, 0x17, 0x12, 0x9A, 0x22, 0x96, 0x6B, 0xBF, 0xD5, 0x55, 0xC9, 0x78, 0x6F, 0x39, 0xA9, 0x28,
+    0x32, 0x2B, 0x80, 0x81, 0x12, 0x7A, 0x96, 0x50, 0x62, 0x0C, 0xB2, 0x90, 0x62, 0x08, 0xB2, 0x50,
+    0x13, 0xAE, 0x13, 0xC8, 0xA9, 0xA7, 0x31, 0x6C, 0x00, 0xE0, 0x79, 0xE5, 0x4F, 0x88, 0x52, 0xE0,
+    0x53, 0xCD, 0x34, 0x43, 0xA6, 0xF2, 0x74, 0xF9, 0x71, 0x1A, 0x00, 0xEE, 0x8B, 0xA1, 0xE4, 0x9E,
+    0x82, 0x20, 0x13, 0x34, 0x38, 0xEC, 0x5B, 0xD0, 0x22, 0x1E, 0xC1, 0x4F, 0x37, 0x3F, 0xD4, 0x79,
+    0x62, 0xD6, 0xB2, 0x38, 0xF0, 0x29, 0x22, 0xB6, 0x12, 0x24, 0x23, 0xD8, 0x6F, 0x73, 0x47, 0x1F,
+    0x7B, 0x15, 0x6A, 0x3F, 0x65, 0x9C, 0x62, 0x30, 0xB2, 0x74, 0x22, 0xCA, 0x12, 0x28, 0x7F, 0x38,
+    0xE0, 0x9E, 0xF3, 0x55, 0x8C, 0xF0, 0x8F, 0xD5, 0xD8, 0x65, 0xEE, 0xA1, 0xE4, 0xA1, 0x38, 0xDB,
+    0x8C, 0x11, 0x12, 0xD2, 0x62, 0xD6, 0xB2, 0x5C, 0x5A, 0x93, 0xFA, 0x0A, 0x12, 0x0C, 0x13, 0xAC,
+    0xC4, 0x5A, 0x23, 0xB6, 0xA7, 0xB3, 0x00, 0xE0, 0xA3, 0x14, 0x12, 0x88, 0xE3, 0x9E, 0x5C, 0x80,
+    0xE4, 0xA1, 0xD1, 0x0D, 0xA2, 0x74, 0x56, 0x10, 0x42, 0x45, 0x12, 0xCC, 0x13, 0x28, 0x13, 0x70,
+    0x7D, 0x57, 0x12, 0xB4, 0xE2, 0xA1, 0x00, 0xE0, 0x12, 0xCA, 0xCD, 0x88, 0x23, 0x74, 0x7E, 0xFB,
+    0x8C, 0x36, 0xFA, 0x65, 0xFB, 0x1E, 0x83, 0x27, 0xA6, 0xA4, 0x12, 0x6A, 0x6A, 0x26, 0xA8, 0xE3,
+    0x00, 0xC5, 0xFC, 0x29, 0x32, 0x73, 0x13, 0x8C, 0xFC, 0x65, 0x78, 0x57, 0x7F, 0xAF, 0x6E, 0xC7,
+    0xE0, 0xA1, 0x5B, 0x10, 0x13, 0x76, 0xC7, 0xF2, 0xCE, 0x2B, 0xCA, 0xAC, 0x13, 0xE2, 0x12, 0xB0,
+    0xC2, 0x9A, 0xDF, 0x2E, 0xE7, 0xA1, 0x8A, 0x00, 0xF9, 0x0A, 0x3D, 0x4F, 0x66, 0xBD, 0x80, 0x60,
+    0x76, 0xE5, 0xEF, 0x9E, 0x12, 0x16, 0x62, 0xFA, 0xB2, 0xDC, 0x12, 0x98, 0x79, 0x54, 0xCA, 0xDE,
+    0x80, 0x86, 0xD4, 0xCE, 0x55, 0xF0, 0x42, 0x9E, 0x13, 0xF4, 0x12, 0x14, 0xCC, 0x4F, 0x22, 0xCC,
+    0xF5, 0x0A, 0x40, 0xCF, 0x12, 0x06, 0x13, 0x72, 0x59, 0x40, 0x6C, 0x64, 0x13, 0xFA, 0xC3, 0xA7,
+    0xCA, 0x8E, 0x13, 0x3A, 0xD9, 0x89, 0x13, 0x5C, 0x00, 0xE0, 0x63, 0x57, 0xD1, 0x95, 0xD3, 0x9E,
+    0xF7, 0x85, 0xA2, 0xCE, 0xD5, 0x86, 0x8B, 0x93, 0x13, 0xF8, 0xD0, 0x4E, 0xA6, 0xF3, 0x12, 0x30,
+    0x90, 0x50, 0x13, 0x56, 0xED, 0xA1, 0x13, 0xE4, 0x32, 0x73, 0x12, 0x28, 0xED, 0xA1, 0x72, 0xA6,
+    0x67, 0x68, 0x3E, 0xF5, 0x62, 0x3E, 0xB2, 0x78, 0x13, 0x44, 0xD3, 0x8C, 0x76, 0x14, 0x12, 0xCE,
+    0x49, 0x99, 0x8D, 0x55, 0xD9, 0xFB, 0x88, 0x35, 0xFB, 0x33, 0x4C, 0x0F, 0x13, 0xD8, 0x47, 0x45,
+    0x82, 0x35, 0x13, 0x0A, 0x12, 0x96, 0x22, 0x30, 0x12, 0xF2, 0xAD, 0xC6, 0x00, 0xFC, 0x00, 0xE0,
+    0x13, 0xF4, 0x12, 0xA2, 0x53, 0x83, 0x12, 0x66, 0x58, 0x50, 0xE7, 0x9E, 0x84, 0xA1, 0x00, 0xE0,
+    0x00, 0xE0, 0x8E, 0xBE, 0x86, 0x93, 0xA8, 0xAB, 0x12, 0x38, 0x7C, 0x17, 0xDD, 0x90, 0x54, 0x60,
+    0xF3, 0x33, 0x12, 0xBC, 0x6D, 0xC0, 0xD5, 0xCB, 0x13, 0x44, 0xD9, 0xA0, 0x00, 0xFE, 0x12, 0x1A,
+    0xF7, 0x65, 0x12, 0xFA, 0xD4, 0x21, 0x12, 0x76, 0x48, 0x27, 0x89, 0xCE, 0x12, 0x00, 0x12, 0x00,
+};
+
+const CompiledRom ROM = {
+    0xFEABC10EB7497CB5ULL, 512, QuirkProfile::SuperChip, "rom2-schip.ch8",
+    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE
+};
+
+const CompiledRomRegistrar REGISTRAR(&ROM);
+
+}  // namespace
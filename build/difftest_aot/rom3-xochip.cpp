@@ -0,0 +1,579 @@
+// Generated by chip8_recompile from rom3-xochip.ch8 (xochip profile). Do not edit.
+#include "aot.h"
+
+namespace {
+
+using X = CompiledRomAccess;
+using Quirks = XoChipQuirks;
+
+// 0x200 - 0x201 (call)
+uint32_t block_200(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x200:  // CALL 0x202
+        X::call(c, 0x200, 0x202);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x202 - 0x203 (call)
+uint32_t block_202(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x202:  // CALL 0x204
+        X::call(c, 0x202, 0x204);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x204 - 0x205 (call)
+uint32_t block_204(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x204:  // CALL 0x206
+        X::call(c, 0x204, 0x206);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x206 - 0x207 (call)
+uint32_t block_206(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x206:  // CALL 0x208
+        X::call(c, 0x206, 0x208);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x208 - 0x209 (call)
+uint32_t block_208(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x208:  // CALL 0x20A
+        X::call(c, 0x208, 0x20A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20A - 0x20B (call)
+uint32_t block_20A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20A:  // CALL 0x20C
+        X::call(c, 0x20A, 0x20C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20C - 0x20D (call)
+uint32_t block_20C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20C:  // CALL 0x20E
+        X::call(c, 0x20C, 0x20E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20E - 0x20F (call)
+uint32_t block_20E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20E:  // CALL 0x210
+        X::call(c, 0x20E, 0x210);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x210 - 0x211 (call)
+uint32_t block_210(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x210:  // CALL 0x212
+        X::call(c, 0x210, 0x212);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x212 - 0x213 (call)
+uint32_t block_212(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x212:  // CALL 0x214
+        X::call(c, 0x212, 0x214);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x214 - 0x215 (call)
+uint32_t block_214(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x214:  // CALL 0x216
+        X::call(c, 0x214, 0x216);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x216 - 0x217 (call)
+uint32_t block_216(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x216:  // CALL 0x218
+        X::call(c, 0x216, 0x218);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x218 - 0x219 (call)
+uint32_t block_218(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x218:  // CALL 0x21A
+        X::call(c, 0x218, 0x21A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21A - 0x21B (call)
+uint32_t block_21A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21A:  // CALL 0x21C
+        X::call(c, 0x21A, 0x21C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21C - 0x21D (call)
+uint32_t block_21C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21C:  // CALL 0x21E
+        X::call(c, 0x21C, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21E - 0x21F (call)
+uint32_t block_21E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21E:  // CALL 0x220
+        X::call(c, 0x21E, 0x220);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x220 - 0x227 (skip)
+uint32_t block_220(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x220:  // DRW VA, VC, F
+        pc = 0x220;
+        if (X::interpret<Quirks>(c, 0xDACF)) { return n + 1; }
+        if (++n == budget) { pc = 0x222; return n; }
+        [[fallthrough]];
+    case 0x222:  // LD VC, 0x74
+        V[0xC] = 0x74;
+        if (++n == budget) { pc = 0x224; return n; }
+        [[fallthrough]];
+    case 0x224:  // LD I, 0xC5D
+        I = 0xC5D;
+        if (++n == budget) { pc = 0x226; return n; }
+        [[fallthrough]];
+    case 0x226:  // SE V0, 0xD5
+        pc = (V[0x0] == 0xD5) ? 0x22A : 0x228;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x228 - 0x229 (fallthrough)
+uint32_t block_228(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x228:  // LD I, 0xAD3
+        I = 0xAD3;
+        pc = 0x22A;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x22A - 0x235 (call)
+uint32_t block_22A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x22A:  // LD V2, 0xA5
+        V[0x2] = 0xA5;
+        if (++n == budget) { pc = 0x22C; return n; }
+        [[fallthrough]];
+    case 0x22C:  // SCU 1
+        pc = 0x22C;
+        if (X::interpret<Quirks>(c, 0x00D1)) { return n + 1; }
+        if (++n == budget) { pc = 0x22E; return n; }
+        [[fallthrough]];
+    case 0x22E:  // SHL VA, VB
+        { uint8_t source = V[0xB]; V[0xA] = static_cast<uint8_t>(source << 1); V[0xF] = (source & 0x80) >> 7; }
+        if (++n == budget) { pc = 0x230; return n; }
+        [[fallthrough]];
+    case 0x230:  // LD VA, 0x49
+        V[0xA] = 0x49;
+        if (++n == budget) { pc = 0x232; return n; }
+        [[fallthrough]];
+    case 0x232:  // LD I, 0x548
+        I = 0x548;
+        if (++n == budget) { pc = 0x234; return n; }
+        [[fallthrough]];
+    case 0x234:  // CALL 0x2A2
+        X::call(c, 0x234, 0x2A2);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x236 - 0x239 (indirect)
+uint32_t block_236(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x236:  // LD V0, 0xA4
+        V[0x0] = 0xA4;
+        if (++n == budget) { pc = 0x238; return n; }
+        [[fallthrough]];
+    case 0x238:  // JP V0, 0x290
+        pc = 0x238;
+        X::interpret<Quirks>(c, 0xB290);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2A2 - 0x2A3 (skip)
+uint32_t block_2A2(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2A2:  // SKNP V1
+        pc = 0x2A2;
+        X::interpret<Quirks>(c, 0xE1A1);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2A4 - 0x2A7 (fallthrough)
+uint32_t block_2A4(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2A4:  // LD I, 0x94A7
+        I = 0x94A7;
+        pc = 0x2A8;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2A8 - 0x2AB (skip)
+uint32_t block_2A8(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2A8:  // CLS
+        pc = 0x2A8;
+        if (X::interpret<Quirks>(c, 0x00E0)) { return n + 1; }
+        if (++n == budget) { pc = 0x2AA; return n; }
+        [[fallthrough]];
+    case 0x2AA:  // SKNP VF
+        pc = 0x2AA;
+        X::interpret<Quirks>(c, 0xEFA1);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2AC - 0x2AD (fallthrough)
+uint32_t block_2AC(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2AC:  // LD V0, 0x82
+        V[0x0] = 0x82;
+        pc = 0x2AE;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2AE - 0x2AF (indirect)
+uint32_t block_2AE(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2AE:  // JP V0, 0x2C8
+        pc = 0x2AE;
+        X::interpret<Quirks>(c, 0xB2C8);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+const CompiledBlock BLOCKS[] = {
+    {0x200, 0x202, block_200},
+    {0x202, 0x204, block_202},
+    {0x204, 0x206, block_204},
+    {0x206, 0x208, block_206},
+    {0x208, 0x20A, block_208},
+    {0x20A, 0x20C, block_20A},
+    {0x20C, 0x20E, block_20C},
+    {0x20E, 0x210, block_20E},
+    {0x210, 0x212, block_210},
+    {0x212, 0x214, block_212},
+    {0x214, 0x216, block_214},
+    {0x216, 0x218, block_216},
+    {0x218, 0x21A, block_218},
+    {0x21A, 0x21C, block_21A},
+    {0x21C, 0x21E, block_21C},
+    {0x21E, 0x220, block_21E},
+    {0x220, 0x228, block_220},
+    {0x228, 0x22A, block_228},
+    {0x22A, 0x236, block_22A},
+    {0x236, 0x23A, block_236},
+    {0x2A2, 0x2A4, block_2A2},
+    {0x2A4, 0x2A8, block_2A4},
+    {0x2A8, 0x2AC, block_2A8},
+    {0x2AC, 0x2AE, block_2AC},
+    {0x2AE, 0x2B0, block_2AE},
+};
+
+const uint8_t IMAGE[] = {
+    0x22, 0x02, 0x22, 0x04, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0A, 0x22, 0x0C, 0x22, 0x0E, 0x22, 0x10,
+    0x22, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1A, 0x22, 0x1C, 0x22, 0x1E, 0x22, 0x20,
+    0xDA, 0xCF, 0x6C, 0x74, 0xAC, 0x5D, 0x30, 0xD5, 0xAA, 0xD3, 0x62, 0xA5, 0x00, 0xD1, 0x8A, 0xBE,
+    0x6A, 0x49, 0xA5, 0x48, 0x22, 0xA2, 0x60, 0xA4, 0xB2, 0x90, 0xC7, 0xB1, 0x7F, 0xCF, 0x6A, 0x0F,
+    0x96, 0x60, 0x00, 0xFB, 0x7F, 0x49, 0xE1, 0x9E, 0x6D, 0x6E, 0x13, 0x76, 0xDA, 0x45, 0xF2, 0x3A,
+    0x8B, 0x44, 0x4B, 0x97, 0x93, 0x29, 0x81, 0x57, 0x95, 0x70, 0xA3, 0xDA, 0x87, 0xE6, 0x83, 0x33,
+    0x3D, 0xB1, 0x56, 0xB0, 0x13, 0x4E, 0xC2, 0xAE, 0xFA, 0x07, 0x00, 0xE0, 0x59, 0xB0, 0xA3, 0x3C,
+    0x23, 0x88, 0x62, 0x35, 0x00, 0xE0, 0x66, 0x82, 0x23, 0xAA, 0xAE, 0x24, 0xE2, 0xA1, 0x4B, 0xB3,
+    0x3E, 0xAB, 0x8B, 0x05, 0x81, 0x35, 0x60, 0x06, 0xB2, 0x5E, 0xF1, 0x15, 0x00, 0xD6, 0x69, 0xA9,
+    0x7D, 0xBA, 0x8A, 0xB6, 0x75, 0x3D, 0x4A, 0x3C, 0xF0, 0x00, 0x3C, 0x0E, 0xFE, 0x01, 0x59, 0x32,
+    0x00, 0xDD, 0xE1, 0xA1, 0xF0, 0x00, 0x94, 0xA7, 0x00, 0xE0, 0xEF, 0xA1, 0x60, 0x82, 0xB2, 0xC8,
+    0xC1, 0xC7, 0xD0, 0x94, 0x13, 0x6A, 0xC3, 0xAB, 0xF0, 0x00, 0x37, 0xBA, 0xF0, 0x00, 0x9C, 0x4B,
+    0xF0, 0x00, 0x0E, 0xCA, 0x89, 0x52, 0x8C, 0x2E, 0x8E, 0x80, 0x83, 0x27, 0x00, 0xE0, 0xFE, 0x07,
+    0x36, 0x5D, 0xC7, 0x0B, 0xE4, 0x9E, 0xF0, 0x00, 0x74, 0x94, 0x8C, 0x27, 0x8C, 0x40, 0x8C, 0x84,
+    0x13, 0xB8, 0x13, 0x70, 0xC4, 0xBA, 0x3B, 0x4C, 0x12, 0x44, 0x3C, 0xD9, 0x54, 0xF2, 0xF8, 0x75,
+    0xF0, 0x00, 0xFC, 0x3B, 0x23, 0xFA, 0xAC, 0xEB, 0x7B, 0x87, 0xE6, 0x9E, 0x8D, 0xA7, 0x4C, 0x87,
+    0x37, 0x8C, 0x4B, 0x96, 0x40, 0x0A, 0x13, 0xA8, 0x8E, 0x6E, 0xE9, 0x9E, 0x12, 0x06, 0xE8, 0xA1,
+    0x4F, 0x6D, 0x86, 0x25, 0x6E, 0xC1, 0xAA, 0xF4, 0x8D, 0xC6, 0xAA, 0x09, 0xA7, 0x59, 0x74, 0x24,
+    0xD2, 0x49, 0xED, 0x9E, 0x36, 0x32, 0x84, 0x92, 0xF0, 0x00, 0x7C, 0xF6, 0xF5, 0x1E, 0x90, 0xB0,
+    0x60, 0xB4, 0xB2, 0x28, 0x13, 0x64, 0xAB, 0x99, 0x74, 0x52, 0xF0, 0x00, 0x24, 0x75, 0x00, 0xE0,
+    0x50, 0xA3, 0x54, 0x80, 0x78, 0x78, 0xF0, 0x00, 0x1F, 0x59, 0x13, 0x10, 0xF7, 0x07, 0x60, 0x0A,
+    0xB2, 0x10, 0x5E, 0x63, 0xCA, 0xA2, 0xD7, 0x8F, 0xF5, 0x65, 0x39, 0x7A, 0x13, 0xE6, 0xC9, 0xC2,
+    0xF8, 0x0A, 0x5C, 0x60, 0x23, 0x6C, 0x49, 0x59, 0xD4, 0xBA, 0x00, 0xE0, 0x37, 0x93, 0x60, 0x68,
+    0xB2, 0x04, 0x00, 0xE0, 0xA7, 0xB1, 0x7E, 0xEF, 0xF0, 0x02, 0x00, 0xFC, 0x00, 0xE0, 0xF9, 0x33,
+    0x22, 0xFA, 0x00, 0xE0, 0xAC, 0x3D, 0x00, 0xE0, 0x3E, 0x14, 0xAA, 0xC8, 0x13, 0x48, 0x3D, 0xE1,
+    0xF0, 0x00, 0xA0, 0x1F, 0x12, 0xCE, 0x00, 0xE0, 0x12, 0xAA, 0x00, 0xE0, 0xD5, 0xB8, 0x60, 0xD6,
+    0xB2, 0x4E, 0x76, 0x2E, 0x22, 0x4C, 0x60, 0x6A, 0xB2, 0x70, 0x85, 0x47, 0x12, 0xF6, 0x8D, 0x76,
+    0x81, 0x84, 0x00, 0xEE, 0x22, 0xEE, 0x13, 0xAA, 0xA8, 0xBF, 0x30, 0xA7, 0x00, 0xFE, 0x32, 0x38,
+    0x13, 0x0A, 0x12, 0xFA, 0xFA, 0x3A, 0xC6, 0x90, 0x7B, 0xFF, 0x63, 0x6D, 0x00, 0xE0, 0xC2, 0xF7,
+    0x60, 0x66, 0xB2, 0xFE, 0x8F, 0xA0, 0xE1, 0xA1, 0xD2, 0xCB, 0xD5, 0x73, 0xF0, 0x00, 0x56, 0x58,
+    0x5C, 0x40, 0xF8, 0x33, 0x6A, 0x63, 0xFE, 0x33, 0x71, 0xCA, 0x8A, 0xDE, 0x63, 0x32, 0xF0, 0x00,
+    0xFD, 0x2C, 0x74, 0xFF, 0xC3, 0x84, 0xCA, 0xA3, 0x3F, 0xD9, 0x32, 0x3B, 0x12, 0x00, 0x12, 0x00,
+};
+
+const CompiledRom ROM = {
+    0x2A68AF37299CD63EULL, 512, QuirkProfile::XoChip, "rom3-xochip.ch8",
+    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE
+};
+
+const CompiledRomRegistrar REGISTRAR(&ROM);
+
+}  // namespace
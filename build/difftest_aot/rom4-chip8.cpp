@@ -0,0 +1,377 @@
+// Generated by chip8_recompile from rom4-chip8.ch8 (chip8 profile). Do not edit.
+#include "aot.h"
+
+namespace {
+
+using X = CompiledRomAccess;
+using Quirks = Chip8Quirks;
+
+// 0x200 - 0x201 (call)
+uint32_t block_200(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x200:  // CALL 0x202
+        X::call(c, 0x200, 0x202);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x202 - 0x203 (call)
+uint32_t block_202(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x202:  // CALL 0x204
+        X::call(c, 0x202, 0x204);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x204 - 0x205 (call)
+uint32_t block_204(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x204:  // CALL 0x206
+        X::call(c, 0x204, 0x206);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x206 - 0x207 (call)
+uint32_t block_206(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x206:  // CALL 0x208
+        X::call(c, 0x206, 0x208);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x208 - 0x209 (call)
+uint32_t block_208(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x208:  // CALL 0x20A
+        X::call(c, 0x208, 0x20A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20A - 0x20B (call)
+uint32_t block_20A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20A:  // CALL 0x20C
+        X::call(c, 0x20A, 0x20C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20C - 0x20D (call)
+uint32_t block_20C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20C:  // CALL 0x20E
+        X::call(c, 0x20C, 0x20E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20E - 0x20F (call)
+uint32_t block_20E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20E:  // CALL 0x210
+        X::call(c, 0x20E, 0x210);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x210 - 0x211 (call)
+uint32_t block_210(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x210:  // CALL 0x212
+        X::call(c, 0x210, 0x212);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x212 - 0x213 (call)
+uint32_t block_212(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x212:  // CALL 0x214
+        X::call(c, 0x212, 0x214);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x214 - 0x215 (call)
+uint32_t block_214(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x214:  // CALL 0x216
+        X::call(c, 0x214, 0x216);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x216 - 0x217 (call)
+uint32_t block_216(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x216:  // CALL 0x218
+        X::call(c, 0x216, 0x218);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x218 - 0x219 (call)
+uint32_t block_218(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x218:  // CALL 0x21A
+        X::call(c, 0x218, 0x21A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21A - 0x21B (call)
+uint32_t block_21A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21A:  // CALL 0x21C
+        X::call(c, 0x21A, 0x21C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21C - 0x21D (call)
+uint32_t block_21C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21C:  // CALL 0x21E
+        X::call(c, 0x21C, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21E - 0x21F (call)
+uint32_t block_21E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21E:  // CALL 0x220
+        X::call(c, 0x21E, 0x220);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x220 - 0x221 (jump)
+uint32_t block_220(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x220:  // JP 0x20E
+        pc = 0x20E;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+const CompiledBlock BLOCKS[] = {
+    {0x200, 0x202, block_200},
+    {0x202, 0x204, block_202},
+    {0x204, 0x206, block_204},
+    {0x206, 0x208, block_206},
+    {0x208, 0x20A, block_208},
+    {0x20A, 0x20C, block_20A},
+    {0x20C, 0x20E, block_20C},
+    {0x20E, 0x210, block_20E},
+    {0x210, 0x212, block_210},
+    {0x212, 0x214, block_212},
+    {0x214, 0x216, block_214},
+    {0x216, 0x218, block_216},
+    {0x218, 0x21A, block_218},
+    {0x21A, 0x21C, block_21A},
+    {0x21C, 0x21E, block_21C},
+    {0x21E, 0x220, block_21E},
+    {0x220, 0x222, block_220},
+};
+
+const uint8_t IMAGE[] = {
+    0x22, 0x02, 0x22, 0x04, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0A, 0x22, 0x0C, 0x22, 0x0E, 0x22, 0x10,
+    0x22, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1A, 0x22, 0x1C, 0x22, 0x1E, 0x22, 0x20,
+    0x12, 0x0E, 0xC2, 0xFB, 0xC8, 0x88, 0x12, 0xDE, 0xEF, 0x9E, 0xCA, 0xA9, 0x4D, 0x05, 0xCB, 0x01,
+    0x8B, 0xB0, 0x8C, 0x7F, 0x13, 0x24, 0xDE, 0x30, 0x3D, 0xAA, 0xC5, 0x95, 0x71, 0x1F, 0xD9, 0x09,
+    0x9C, 0xF0, 0x12, 0xA6, 0x13, 0x06, 0x13, 0xFA, 0x82, 0x15, 0xCD, 0x86, 0xA3, 0x46, 0x72, 0x90,
+    0xAD, 0x80, 0x12, 0x0C, 0x12, 0xC0, 0x44, 0x69, 0x00, 0xE0, 0x23, 0x42, 0x62, 0x31, 0x81, 0x41,
+    0xD3, 0x38, 0xF4, 0x33, 0x8D, 0x57, 0xC3, 0xC8, 0x72, 0xBE, 0x5E, 0x30, 0x69, 0xB7, 0x42, 0xDB,
+    0xD1, 0x35, 0x77, 0xA6, 0xEA, 0xA1, 0xDB, 0xE6, 0xD9, 0xDA, 0xAC, 0x6C, 0x22, 0xDA, 0x13, 0xE8,
+    0x46, 0x77, 0x22, 0xAE, 0x6F, 0x1F, 0x34, 0xD6, 0x23, 0xE4, 0x5C, 0xE3, 0x12, 0xD4, 0x80, 0x61,
+    0x5B, 0x60, 0x64, 0x0E, 0x8D, 0x32, 0x8E, 0x20, 0xF6, 0x29, 0x12, 0x80, 0xDA, 0x3D, 0x12, 0x2A,
+    0xCD, 0x3E, 0xAA, 0x37, 0x60, 0x44, 0xB2, 0x28, 0x23, 0xDE, 0x47, 0xF8, 0xEB, 0x9E, 0x3F, 0x40,
+    0x8A, 0x64, 0x34, 0x5F, 0x60, 0x5C, 0xB2, 0x16, 0xC6, 0x1E, 0x70, 0x88, 0x13, 0x4C, 0xA4, 0x78,
+    0x13, 0xDC, 0x00, 0xE0, 0x13, 0x2A, 0xA0, 0x5A, 0xD9, 0x51, 0x7C, 0x2A, 0x6E, 0x9C, 0xD2, 0x33,
+    0x23, 0x12, 0xC5, 0xA9, 0x58, 0x90, 0x6C, 0xFA, 0x12, 0xEC, 0x4C, 0x6B, 0x23, 0x0A, 0x13, 0x66,
+    0x12, 0x9C, 0x51, 0x40, 0x88, 0xE1, 0x23, 0xF6, 0x33, 0x26, 0xC5, 0xC2, 0x60, 0xAC, 0xB2, 0xD6,
+    0xDD, 0xB4, 0x78, 0xE2, 0xD5, 0x0D, 0xD3, 0xC5, 0x60, 0xE0, 0xB2, 0xF8, 0xCB, 0x9A, 0xAF, 0x0F,
+    0xAB, 0xCE, 0x22, 0xBA, 0x49, 0xD3, 0xA2, 0x00, 0x74, 0x6A, 0x13, 0xF4, 0x42, 0xA0, 0x13, 0x56,
+    0x12, 0xBC, 0x63, 0x3E, 0x7C, 0x29, 0xD9, 0x5D, 0xDB, 0x72, 0xEC, 0xA1, 0x12, 0x0C, 0x8F, 0x82,
+    0x94, 0xD0, 0xA0, 0x93, 0x88, 0x9E, 0x12, 0xBA, 0x4C, 0x79, 0x70, 0x7A, 0x13, 0x70, 0xFF, 0x18,
+    0x6D, 0xBB, 0xAB, 0x54, 0x63, 0x95, 0xDE, 0x9A, 0xD7, 0x8D, 0x22, 0x04, 0x13, 0x3A, 0xE0, 0xA1,
+    0xC9, 0xA1, 0x54, 0xE0, 0x8E, 0xB2, 0x13, 0x28, 0x3D, 0x23, 0xC2, 0xBF, 0x55, 0xA0, 0x66, 0x06,
+    0xEF, 0xA1, 0x4E, 0x98, 0x12, 0xB6, 0x78, 0x1B, 0x34, 0xA7, 0xC0, 0xBB, 0x84, 0x47, 0x79, 0x2E,
+    0x60, 0x94, 0xB2, 0xBC, 0xC4, 0xAA, 0xCC, 0x33, 0x12, 0x14, 0x4D, 0x54, 0x13, 0xEC, 0x23, 0xCA,
+    0x12, 0x52, 0x42, 0x89, 0x12, 0x5A, 0x6E, 0xA0, 0x8D, 0xA3, 0x22, 0x52, 0xC1, 0x10, 0xE9, 0xA1,
+    0xC1, 0x68, 0x12, 0x82, 0xD0, 0x1F, 0x12, 0xC2, 0x12, 0xAC, 0x23, 0xE8, 0x9B, 0x60, 0x6B, 0xDF,
+    0x82, 0xC6, 0x9F, 0xA0, 0x6A, 0xC9, 0x94, 0xA0, 0xA9, 0xAF, 0x8A, 0x67, 0x66, 0xD8, 0x64, 0x53,
+    0xEF, 0x9E, 0xE5, 0xA1, 0x00, 0xE0, 0x13, 0x2E, 0x61, 0x0E, 0xFD, 0x0A, 0x23, 0x66, 0x93, 0x20,
+    0xED, 0x9E, 0x89, 0x87, 0x60, 0x1E, 0xB2, 0x4C, 0x60, 0x70, 0xB2, 0x56, 0x3F, 0x73, 0xA7, 0xF9,
+    0x68, 0xC7, 0x23, 0xA0, 0x60, 0x48, 0x00, 0xE0, 0x13, 0xFC, 0xEC, 0xA1, 0xF8, 0x65, 0x84, 0xE5,
+    0x13, 0x20, 0x6D, 0x2F, 0x61, 0x46, 0x60, 0x4C, 0xB2, 0x1A, 0x8E, 0x01, 0xD0, 0x74, 0xE2, 0x9E,
+    0xFE, 0x33, 0xCC, 0x32, 0x3C, 0x3C, 0xFC, 0x0A, 0x85, 0x67, 0x13, 0xB0, 0x79, 0xDD, 0xAB, 0xDC,
+    0xAD, 0x2C, 0x13, 0x2E, 0x62, 0x57, 0x31, 0xB4, 0xAB, 0x89, 0xAC, 0x70, 0x12, 0x00, 0x12, 0x00,
+};
+
+const CompiledRom ROM = {
+    0x7502D70345B8834FULL, 512, QuirkProfile::Chip8, "rom4-chip8.ch8",
+    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE
+};
+
+const CompiledRomRegistrar REGISTRAR(&ROM);
+
+}  // namespace
@@ -0,0 +1,449 @@
+// Generated by chip8_recompile from rom5-chip48.ch8 (chip48 profile). Do not edit.
+#include "aot.h"
+
+namespace {
+
+using X = CompiledRomAccess;
+using Quirks = Chip48Quirks;
+
+// 0x200 - 0x201 (call)
+uint32_t block_200(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x200:  // CALL 0x202
+        X::call(c, 0x200, 0x202);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x202 - 0x203 (call)
+uint32_t block_202(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x202:  // CALL 0x204
+        X::call(c, 0x202, 0x204);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x204 - 0x205 (call)
+uint32_t block_204(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x204:  // CALL 0x206
+        X::call(c, 0x204, 0x206);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x206 - 0x207 (call)
+uint32_t block_206(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x206:  // CALL 0x208
+        X::call(c, 0x206, 0x208);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x208 - 0x209 (call)
+uint32_t block_208(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x208:  // CALL 0x20A
+        X::call(c, 0x208, 0x20A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20A - 0x20B (call)
+uint32_t block_20A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20A:  // CALL 0x20C
+        X::call(c, 0x20A, 0x20C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20C - 0x20D (call)
+uint32_t block_20C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20C:  // CALL 0x20E
+        X::call(c, 0x20C, 0x20E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20E - 0x20F (call)
+uint32_t block_20E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20E:  // CALL 0x210
+        X::call(c, 0x20E, 0x210);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x210 - 0x211 (call)
+uint32_t block_210(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x210:  // CALL 0x212
+        X::call(c, 0x210, 0x212);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x212 - 0x213 (call)
+uint32_t block_212(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x212:  // CALL 0x214
+        X::call(c, 0x212, 0x214);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x214 - 0x215 (call)
+uint32_t block_214(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x214:  // CALL 0x216
+        X::call(c, 0x214, 0x216);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x216 - 0x217 (call)
+uint32_t block_216(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x216:  // CALL 0x218
+        X::call(c, 0x216, 0x218);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x218 - 0x219 (call)
+uint32_t block_218(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x218:  // CALL 0x21A
+        X::call(c, 0x218, 0x21A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21A - 0x21B (call)
+uint32_t block_21A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21A:  // CALL 0x21C
+        X::call(c, 0x21A, 0x21C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21C - 0x21D (call)
+uint32_t block_21C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21C:  // CALL 0x21E
+        X::call(c, 0x21C, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21E - 0x21F (call)
+uint32_t block_21E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21E:  // CALL 0x220
+        X::call(c, 0x21E, 0x220);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x220 - 0x225 (skip)
+uint32_t block_220(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x220:  // OR V1, V0
+        V[0x1] |= V[0x0];
+        if (++n == budget) { pc = 0x222; return n; }
+        [[fallthrough]];
+    case 0x222:  // LD B, VD
+        pc = 0x222;
+        if (X::interpret<Quirks>(c, 0xFD33)) { return n + 1; }
+        if (++n == budget) { pc = 0x224; return n; }
+        [[fallthrough]];
+    case 0x224:  // SE V1, 0x51
+        pc = (V[0x1] == 0x51) ? 0x228 : 0x226;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x226 - 0x227 (skip)
+uint32_t block_226(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x226:  // SNE V4, 0x6B
+        pc = (V[0x4] != 0x6B) ? 0x22A : 0x228;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x228 - 0x229 (fallthrough)
+uint32_t block_228(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x228:  // SUBN V0, VB
+        { uint8_t noBorrow = V[0xB] >= V[0x0] ? 1 : 0; V[0x0] = static_cast<uint8_t>(V[0xB] - V[0x0]); V[0xF] = noBorrow; }
+        pc = 0x22A;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x22A - 0x22D (indirect)
+uint32_t block_22A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x22A:  // LD V2, 0xCE
+        V[0x2] = 0xCE;
+        if (++n == budget) { pc = 0x22C; return n; }
+        [[fallthrough]];
+    case 0x22C:  // JP V0, 0x2CC
+        pc = 0x22C;
+        X::interpret<Quirks>(c, 0xB2CC);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+const CompiledBlock BLOCKS[] = {
+    {0x200, 0x202, block_200},
+    {0x202, 0x204, block_202},
+    {0x204, 0x206, block_204},
+    {0x206, 0x208, block_206},
+    {0x208, 0x20A, block_208},
+    {0x20A, 0x20C, block_20A},
+    {0x20C, 0x20E, block_20C},
+    {0x20E, 0x210, block_20E},
+    {0x210, 0x212, block_210},
+    {0x212, 0x214, block_212},
+    {0x214, 0x216, block_214},
+    {0x216, 0x218, block_216},
+    {0x218, 0x21A, block_218},
+    {0x21A, 0x21C, block_21A},
+    {0x21C, 0x21E, block_21C},
+    {0x21E, 0x220, block_21E},
+    {0x220, 0x226, block_220},
+    {0x226, 0x228, block_226},
+    {0x228, 0x22A, block_228},
+    {0x22A, 0x22E, block_22A},
+};
+
+const uint8_t IMAGE[] = {
+    0x22, 0x02, 0x22, 0x04, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0A, 0x22, 0x0C, 0x22, 0x0E, 0x22, 0x10,
+    0x22, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1A, 0x22, 0x1C, 0x22, 0x1E, 0x22, 0x20,
+    0x81, 0x01, 0xFD, 0x33, 0x31, 0x51, 0x44, 0x6B, 0x80, 0xB7, 0x62, 0xCE, 0xB2, 0xCC, 0xA4, 0x85,
+    0x6F, 0xB8, 0x34, 0xB3, 0x87, 0x95, 0x62, 0xC2, 0xB2, 0x6A, 0xD9, 0xCA, 0x62, 0xA0, 0xB2, 0xF4,
+    0xD2, 0xD9, 0x49, 0xE0, 0x12, 0x84, 0xE9, 0x9E, 0x00, 0xE0, 0xD5, 0x20, 0x13, 0x3A, 0xCF, 0xE8,
+    0x67, 0xB9, 0x4E, 0xB9, 0x8F, 0xC7, 0x00, 0xE0, 0x00, 0xEE, 0x13, 0xD6, 0x65, 0x70, 0x6B, 0x3D,
+    0x62, 0x50, 0xB2, 0x0A, 0xAD, 0x50, 0xEB, 0xA1, 0xAA, 0x0B, 0xC9, 0x24, 0xE9, 0xA1, 0x62, 0x1C,
+    0xB2, 0x04, 0xA4, 0x84, 0x12, 0xE4, 0x77, 0xD6, 0xDA, 0xA4, 0x37, 0x14, 0x13, 0xBA, 0x13, 0x96,
+    0x3B, 0x67, 0xA8, 0xF4, 0xAD, 0x78, 0x8F, 0x60, 0x8B, 0x93, 0xFC, 0x1E, 0x78, 0x68, 0xC6, 0xBA,
+    0x13, 0xD4, 0x00, 0xEE, 0x78, 0x15, 0x13, 0x6A, 0x62, 0x2C, 0xB2, 0x2E, 0x13, 0x64, 0x35, 0xB3,
+    0x6C, 0xE6, 0xA3, 0x78, 0x3E, 0xE5, 0xDB, 0x4D, 0x62, 0x40, 0xB2, 0xA6, 0x12, 0xC2, 0x34, 0x90,
+    0x53, 0xE0, 0x50, 0x90, 0xAA, 0x43, 0x13, 0xAA, 0xD6, 0xBE, 0x62, 0x84, 0xB2, 0xBA, 0xAC, 0xFF,
+    0x12, 0xDA, 0x4B, 0x49, 0x8C, 0x60, 0xD2, 0x34, 0x23, 0x1E, 0x5C, 0xD0, 0x77, 0xA9, 0x52, 0xD0,
+    0x23, 0xA6, 0x00, 0xEE, 0xA7, 0xCC, 0x12, 0xE6, 0x12, 0x12, 0x13, 0x26, 0x12, 0x18, 0xC4, 0xF6,
+    0x7E, 0xD2, 0x93, 0x8E, 0xC0, 0xC5, 0xA4, 0x21, 0x7D, 0x93, 0xD0, 0x78, 0x13, 0x06, 0xFD, 0x33,
+    0x13, 0xEE, 0x7C, 0x9B, 0x84, 0x23, 0x3A, 0xC9, 0x72, 0x68, 0xAB, 0x81, 0x13, 0x00, 0xED, 0xA1,
+    0xDC, 0xF6, 0x4B, 0xC8, 0x89, 0x72, 0xD8, 0x6A, 0x8B, 0x70, 0x6D, 0xBD, 0xC9, 0x42, 0x00, 0xE0,
+    0xE5, 0xA1, 0x5E, 0x60, 0x62, 0x96, 0xB2, 0xD0, 0x3C, 0x29, 0x86, 0xAE, 0x62, 0x0A, 0xB2, 0x4C,
+    0xA6, 0xAA, 0x9C, 0xD0, 0xDC, 0x64, 0xCF, 0xB3, 0x6F, 0x58, 0xA3, 0x23, 0x36, 0x73, 0x13, 0xC6,
+    0x12, 0x2A, 0x77, 0x3F, 0x12, 0x64, 0x7A, 0x86, 0xC9, 0x61, 0x84, 0xA5, 0x69, 0x88, 0x7B, 0xD3,
+    0x81, 0xA5, 0x12, 0xB6, 0x00, 0xE0, 0x35, 0x85, 0x13, 0x6A, 0x7F, 0x86, 0x33, 0x0E, 0x23, 0x70,
+    0x4D, 0xC4, 0x00, 0xE0, 0x00, 0xE0, 0xE9, 0xA1, 0x00, 0xEE, 0xDF, 0x0E, 0x66, 0xA1, 0x46, 0x60,
+    0x66, 0x80, 0x4D, 0x09, 0x00, 0xEE, 0xAD, 0x5F, 0x81, 0x01, 0x12, 0x4E, 0x7D, 0xC1, 0xF8, 0x18,
+    0x31, 0x78, 0x37, 0x73, 0x8D, 0x45, 0xAC, 0xEB, 0x62, 0x68, 0xB2, 0x5A, 0xC8, 0x5D, 0x13, 0xE0,
+    0xCD, 0xC4, 0xC7, 0xCF, 0xAD, 0xBD, 0xC7, 0xE3, 0xF4, 0x29, 0x8D, 0x70, 0x12, 0xCA, 0xAE, 0x90,
+    0x8F, 0xE2, 0x13, 0x3E, 0x6B, 0x10, 0xC3, 0x81, 0x62, 0x24, 0xB2, 0x24, 0x13, 0x56, 0x62, 0x4C,
+    0xB2, 0x9E, 0x87, 0x47, 0x00, 0xEE, 0xDD, 0x6E, 0xF1, 0x55, 0x12, 0xC8, 0x64, 0xDC, 0x13, 0xA8,
+    0xE1, 0xA1, 0xD4, 0x08, 0x69, 0xC1, 0x31, 0x2B, 0x54, 0x10, 0x30, 0x03, 0x13, 0x42, 0x71, 0xF5,
+    0x3D, 0x64, 0x71, 0x93, 0x3B, 0x4E, 0x45, 0x9D, 0xCF, 0x2F, 0x7D, 0xC3, 0xC8, 0x4B, 0xFC, 0x15,
+    0x00, 0xEE, 0xC5, 0xF2, 0x12, 0x2A, 0x88, 0x5E, 0x31, 0x76, 0x13, 0xEA, 0x83, 0x80, 0xA0, 0xD3,
+    0x9F, 0xA0, 0x97, 0xC0, 0x13, 0x64, 0xD9, 0x28, 0x59, 0x30, 0xE7, 0xA1, 0x78, 0x57, 0x13, 0xBE,
+    0xD5, 0xC2, 0x62, 0x3C, 0xB2, 0x68, 0x13, 0xE8, 0x13, 0x96, 0xC0, 0x5D, 0x12, 0x00, 0x12, 0x00,
+};
+
+const CompiledRom ROM = {
+    0x84714D8B8EB3BF97ULL, 512, QuirkProfile::Chip48, "rom5-chip48.ch8",
+    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE
+};
+
+const CompiledRomRegistrar REGISTRAR(&ROM);
+
+}  // namespace
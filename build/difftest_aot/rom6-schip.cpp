@@ -0,0 +1,1367 @@
+// Generated by chip8_recompile from rom6-schip.ch8 (schip profile). Do not edit.
+#include "aot.h"
+
+namespace {
+
+using X = CompiledRomAccess;
+using Quirks = SuperChipQuirks;
+
+// 0x200 - 0x201 (call)
+uint32_t block_200(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x200:  // CALL 0x202
+        X::call(c, 0x200, 0x202);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x202 - 0x203 (call)
+uint32_t block_202(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x202:  // CALL 0x204
+        X::call(c, 0x202, 0x204);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x204 - 0x205 (call)
+uint32_t block_204(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x204:  // CALL 0x206
+        X::call(c, 0x204, 0x206);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x206 - 0x207 (call)
+uint32_t block_206(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x206:  // CALL 0x208
+        X::call(c, 0x206, 0x208);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x208 - 0x209 (call)
+uint32_t block_208(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x208:  // CALL 0x20A
+        X::call(c, 0x208, 0x20A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20A - 0x20B (call)
+uint32_t block_20A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20A:  // CALL 0x20C
+        X::call(c, 0x20A, 0x20C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20C - 0x20D (call)
+uint32_t block_20C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20C:  // CALL 0x20E
+        X::call(c, 0x20C, 0x20E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20E - 0x20F (call)
+uint32_t block_20E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20E:  // CALL 0x210
+        X::call(c, 0x20E, 0x210);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x210 - 0x211 (call)
+uint32_t block_210(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x210:  // CALL 0x212
+        X::call(c, 0x210, 0x212);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x212 - 0x213 (call)
+uint32_t block_212(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x212:  // CALL 0x214
+        X::call(c, 0x212, 0x214);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x214 - 0x215 (call)
+uint32_t block_214(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x214:  // CALL 0x216
+        X::call(c, 0x214, 0x216);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x216 - 0x217 (call)
+uint32_t block_216(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x216:  // CALL 0x218
+        X::call(c, 0x216, 0x218);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x218 - 0x219 (call)
+uint32_t block_218(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x218:  // CALL 0x21A
+        X::call(c, 0x218, 0x21A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21A - 0x21B (call)
+uint32_t block_21A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21A:  // CALL 0x21C
+        X::call(c, 0x21A, 0x21C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21C - 0x21D (call)
+uint32_t block_21C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21C:  // CALL 0x21E
+        X::call(c, 0x21C, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21E - 0x21F (call)
+uint32_t block_21E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21E:  // CALL 0x220
+        X::call(c, 0x21E, 0x220);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x220 - 0x223 (skip)
+uint32_t block_220(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x220:  // LD VD, 0x3B
+        V[0xD] = 0x3B;
+        if (++n == budget) { pc = 0x222; return n; }
+        [[fallthrough]];
+    case 0x222:  // SNE V3, 0x20
+        pc = (V[0x3] != 0x20) ? 0x226 : 0x224;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x224 - 0x225 (fallthrough)
+uint32_t block_224(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x224:  // XOR V9, V6
+        V[0x9] ^= V[0x6];
+        pc = 0x226;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x226 - 0x22B (skip)
+uint32_t block_226(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x226:  // DRW V6, V3, A
+        pc = 0x226;
+        if (X::interpret<Quirks>(c, 0xD63A)) { return n + 1; }
+        if (++n == budget) { pc = 0x228; return n; }
+        [[fallthrough]];
+    case 0x228:  // RND V9, 0xE7
+        pc = 0x228;
+        if (X::interpret<Quirks>(c, 0xC9E7)) { return n + 1; }
+        if (++n == budget) { pc = 0x22A; return n; }
+        [[fallthrough]];
+    case 0x22A:  // SKP V4
+        pc = 0x22A;
+        X::interpret<Quirks>(c, 0xE49E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x22C - 0x22D (jump)
+uint32_t block_22C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x22C:  // JP 0x2D6
+        pc = 0x2D6;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x22E - 0x237 (skip)
+uint32_t block_22E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x22E:  // CLS
+        pc = 0x22E;
+        if (X::interpret<Quirks>(c, 0x00E0)) { return n + 1; }
+        if (++n == budget) { pc = 0x230; return n; }
+        [[fallthrough]];
+    case 0x230:  // RND V9, 0x17
+        pc = 0x230;
+        if (X::interpret<Quirks>(c, 0xC917)) { return n + 1; }
+        if (++n == budget) { pc = 0x232; return n; }
+        [[fallthrough]];
+    case 0x232:  // LD VC, [I]
+        pc = 0x232;
+        if (X::interpret<Quirks>(c, 0xFC65)) { return n + 1; }
+        if (++n == budget) { pc = 0x234; return n; }
+        [[fallthrough]];
+    case 0x234:  // SUBN V3, V0
+        { uint8_t noBorrow = V[0x0] >= V[0x3] ? 1 : 0; V[0x3] = static_cast<uint8_t>(V[0x0] - V[0x3]); V[0xF] = noBorrow; }
+        if (++n == budget) { pc = 0x236; return n; }
+        [[fallthrough]];
+    case 0x236:  // SNE VF, 0x8E
+        pc = (V[0xF] != 0x8E) ? 0x23A : 0x238;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x238 - 0x239 (fallthrough)
+uint32_t block_238(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x238:  // SUBN V6, V7
+        { uint8_t noBorrow = V[0x7] >= V[0x6] ? 1 : 0; V[0x6] = static_cast<uint8_t>(V[0x7] - V[0x6]); V[0xF] = noBorrow; }
+        pc = 0x23A;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x23A - 0x23D (jump)
+uint32_t block_23A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x23A:  // CLS
+        pc = 0x23A;
+        if (X::interpret<Quirks>(c, 0x00E0)) { return n + 1; }
+        if (++n == budget) { pc = 0x23C; return n; }
+        [[fallthrough]];
+    case 0x23C:  // JP 0x226
+        pc = 0x226;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x23E - 0x23F (skip)
+uint32_t block_23E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x23E:  // SNE V1, 0xC7
+        pc = (V[0x1] != 0xC7) ? 0x242 : 0x240;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x240 - 0x241 (fallthrough)
+uint32_t block_240(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x240:  // ADD VD, 0x35
+        V[0xD] = static_cast<uint8_t>(V[0xD] + 0x35);
+        pc = 0x242;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x242 - 0x245 (jump)
+uint32_t block_242(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x242:  // ADD V4, 0x20
+        V[0x4] = static_cast<uint8_t>(V[0x4] + 0x20);
+        if (++n == budget) { pc = 0x244; return n; }
+        [[fallthrough]];
+    case 0x244:  // JP 0x39E
+        pc = 0x39E;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x276 - 0x277 (skip)
+uint32_t block_276(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x276:  // SNE V8, 0x8A
+        pc = (V[0x8] != 0x8A) ? 0x27A : 0x278;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x278 - 0x279 (fallthrough)
+uint32_t block_278(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x278:  // LD B, VC
+        pc = 0x278;
+        if (X::interpret<Quirks>(c, 0xFC33)) { return n + 1; }
+        pc = 0x27A;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x27A - 0x281 (jump)
+uint32_t block_27A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x27A:  // CLS
+        pc = 0x27A;
+        if (X::interpret<Quirks>(c, 0x00E0)) { return n + 1; }
+        if (++n == budget) { pc = 0x27C; return n; }
+        [[fallthrough]];
+    case 0x27C:  // LD B, V9
+        pc = 0x27C;
+        if (X::interpret<Quirks>(c, 0xF933)) { return n + 1; }
+        if (++n == budget) { pc = 0x27E; return n; }
+        [[fallthrough]];
+    case 0x27E:  // LD V7, 0x66
+        V[0x7] = 0x66;
+        if (++n == budget) { pc = 0x280; return n; }
+        [[fallthrough]];
+    case 0x280:  // JP 0x3D6
+        pc = 0x3D6;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2BA - 0x2BB (jump)
+uint32_t block_2BA(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2BA:  // JP 0x2C2
+        pc = 0x2C2;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2C2 - 0x2CD (jump)
+uint32_t block_2C2(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2C2:  // ADD V8, 0x79
+        V[0x8] = static_cast<uint8_t>(V[0x8] + 0x79);
+        if (++n == budget) { pc = 0x2C4; return n; }
+        [[fallthrough]];
+    case 0x2C4:  // AND VA, V9
+        V[0xA] &= V[0x9];
+        if (++n == budget) { pc = 0x2C6; return n; }
+        [[fallthrough]];
+    case 0x2C6:  // CLS
+        pc = 0x2C6;
+        if (X::interpret<Quirks>(c, 0x00E0)) { return n + 1; }
+        if (++n == budget) { pc = 0x2C8; return n; }
+        [[fallthrough]];
+    case 0x2C8:  // LD B, V9
+        pc = 0x2C8;
+        if (X::interpret<Quirks>(c, 0xF933)) { return n + 1; }
+        if (++n == budget) { pc = 0x2CA; return n; }
+        [[fallthrough]];
+    case 0x2CA:  // LD V3, 0xFB
+        V[0x3] = 0xFB;
+        if (++n == budget) { pc = 0x2CC; return n; }
+        [[fallthrough]];
+    case 0x2CC:  // JP 0x330
+        pc = 0x330;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2D6 - 0x2D9 (skip)
+uint32_t block_2D6(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2D6:  // CLS
+        pc = 0x2D6;
+        if (X::interpret<Quirks>(c, 0x00E0)) { return n + 1; }
+        if (++n == budget) { pc = 0x2D8; return n; }
+        [[fallthrough]];
+    case 0x2D8:  // SE V7, 0xF2
+        pc = (V[0x7] == 0xF2) ? 0x2DC : 0x2DA;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2DA - 0x2DB (fallthrough)
+uint32_t block_2DA(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2DA:  // RND V5, 0xBA
+        pc = 0x2DA;
+        if (X::interpret<Quirks>(c, 0xC5BA)) { return n + 1; }
+        pc = 0x2DC;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2DC - 0x2DD (skip)
+uint32_t block_2DC(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2DC:  // SE VC, VE
+        pc = (V[0xC] == V[0xE]) ? 0x2E0 : 0x2DE;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2DE - 0x2DF (fallthrough)
+uint32_t block_2DE(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2DE:  // LD I, 0x3A8
+        I = 0x3A8;
+        pc = 0x2E0;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2E0 - 0x2E3 (jump)
+uint32_t block_2E0(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2E0:  // LOW
+        pc = 0x2E0;
+        if (X::interpret<Quirks>(c, 0x00FE)) { return n + 1; }
+        if (++n == budget) { pc = 0x2E2; return n; }
+        [[fallthrough]];
+    case 0x2E2:  // JP 0x23E
+        pc = 0x23E;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2F8 - 0x2FB (skip)
+uint32_t block_2F8(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2F8:  // LD V4, 0xFD
+        V[0x4] = 0xFD;
+        if (++n == budget) { pc = 0x2FA; return n; }
+        [[fallthrough]];
+    case 0x2FA:  // SNE VE, VA
+        pc = (V[0xE] != V[0xA]) ? 0x2FE : 0x2FC;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2FC - 0x2FD (fallthrough)
+uint32_t block_2FC(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2FC:  // LD V7, 0x4D
+        V[0x7] = 0x4D;
+        pc = 0x2FE;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x2FE - 0x2FF (jump)
+uint32_t block_2FE(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x2FE:  // JP 0x276
+        pc = 0x276;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x330 - 0x333 (skip)
+uint32_t block_330(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x330:  // DRW V4, V0, D
+        pc = 0x330;
+        if (X::interpret<Quirks>(c, 0xD40D)) { return n + 1; }
+        if (++n == budget) { pc = 0x332; return n; }
+        [[fallthrough]];
+    case 0x332:  // SE V6, 0xD1
+        pc = (V[0x6] == 0xD1) ? 0x336 : 0x334;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x334 - 0x335 (fallthrough)
+uint32_t block_334(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x334:  // SUBN VD, VE
+        { uint8_t noBorrow = V[0xE] >= V[0xD] ? 1 : 0; V[0xD] = static_cast<uint8_t>(V[0xE] - V[0xD]); V[0xF] = noBorrow; }
+        pc = 0x336;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x336 - 0x339 (jump)
+uint32_t block_336(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x336:  // LD ST, V0
+        pc = 0x336;
+        if (X::interpret<Quirks>(c, 0xF018)) { return n + 1; }
+        if (++n == budget) { pc = 0x338; return n; }
+        [[fallthrough]];
+    case 0x338:  // JP 0x2F8
+        pc = 0x2F8;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x39E - 0x39F (call)
+uint32_t block_39E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x39E:  // CALL 0x3F8
+        X::call(c, 0x39E, 0x3F8);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3A0 - 0x3A5 (jump)
+uint32_t block_3A0(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3A0:  // DRW VD, V1, F
+        pc = 0x3A0;
+        if (X::interpret<Quirks>(c, 0xDD1F)) { return n + 1; }
+        if (++n == budget) { pc = 0x3A2; return n; }
+        [[fallthrough]];
+    case 0x3A2:  // LD I, 0x70A
+        I = 0x70A;
+        if (++n == budget) { pc = 0x3A4; return n; }
+        [[fallthrough]];
+    case 0x3A4:  // JP 0x3C6
+        pc = 0x3C6;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3C6 - 0x3C9 (skip)
+uint32_t block_3C6(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3C6:  // LD VE, 0xF5
+        V[0xE] = 0xF5;
+        if (++n == budget) { pc = 0x3C8; return n; }
+        [[fallthrough]];
+    case 0x3C8:  // SE V6, VB
+        pc = (V[0x6] == V[0xB]) ? 0x3CC : 0x3CA;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3CA - 0x3CB (skip)
+uint32_t block_3CA(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3CA:  // SE VE, 0x31
+        pc = (V[0xE] == 0x31) ? 0x3CE : 0x3CC;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3CC - 0x3CD (fallthrough)
+uint32_t block_3CC(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3CC:  // RND V4, 0xE8
+        pc = 0x3CC;
+        if (X::interpret<Quirks>(c, 0xC4E8)) { return n + 1; }
+        pc = 0x3CE;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3CE - 0x3D5 (fallthrough)
+uint32_t block_3CE(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3CE:  // RND V2, 0x84
+        pc = 0x3CE;
+        if (X::interpret<Quirks>(c, 0xC284)) { return n + 1; }
+        if (++n == budget) { pc = 0x3D0; return n; }
+        [[fallthrough]];
+    case 0x3D0:  // ADD VA, 0x71
+        V[0xA] = static_cast<uint8_t>(V[0xA] + 0x71);
+        if (++n == budget) { pc = 0x3D2; return n; }
+        [[fallthrough]];
+    case 0x3D2:  // LD V5, 0x2B
+        V[0x5] = 0x2B;
+        if (++n == budget) { pc = 0x3D4; return n; }
+        [[fallthrough]];
+    case 0x3D4:  // SCL
+        pc = 0x3D4;
+        if (X::interpret<Quirks>(c, 0x00FC)) { return n + 1; }
+        pc = 0x3D6;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3D6 - 0x3DD (skip)
+uint32_t block_3D6(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3D6:  // LD VF, 0x93
+        V[0xF] = 0x93;
+        if (++n == budget) { pc = 0x3D8; return n; }
+        [[fallthrough]];
+    case 0x3D8:  // ADD VE, 0x75
+        V[0xE] = static_cast<uint8_t>(V[0xE] + 0x75);
+        if (++n == budget) { pc = 0x3DA; return n; }
+        [[fallthrough]];
+    case 0x3DA:  // SCD 0
+        pc = 0x3DA;
+        if (X::interpret<Quirks>(c, 0x00C0)) { return n + 1; }
+        if (++n == budget) { pc = 0x3DC; return n; }
+        [[fallthrough]];
+    case 0x3DC:  // SNE VF, V1
+        pc = (V[0xF] != V[0x1]) ? 0x3E0 : 0x3DE;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3DE - 0x3DF (jump)
+uint32_t block_3DE(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3DE:  // JP 0x3EC
+        pc = 0x3EC;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3E0 - 0x3E1 (skip)
+uint32_t block_3E0(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3E0:  // SNE VA, 0x16
+        pc = (V[0xA] != 0x16) ? 0x3E4 : 0x3E2;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3E2 - 0x3E3 (fallthrough)
+uint32_t block_3E2(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3E2:  // LD I, 0xBBF
+        I = 0xBBF;
+        pc = 0x3E4;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3E4 - 0x3E5 (skip)
+uint32_t block_3E4(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3E4:  // SE V9, 0x6B
+        pc = (V[0x9] == 0x6B) ? 0x3E8 : 0x3E6;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3E6 - 0x3E7 (fallthrough)
+uint32_t block_3E6(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3E6:  // DRW VA, VE, 6
+        pc = 0x3E6;
+        if (X::interpret<Quirks>(c, 0xDAE6)) { return n + 1; }
+        pc = 0x3E8;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3E8 - 0x3EB (skip)
+uint32_t block_3E8(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3E8:  // RND VB, 0xE5
+        pc = 0x3E8;
+        if (X::interpret<Quirks>(c, 0xCBE5)) { return n + 1; }
+        if (++n == budget) { pc = 0x3EA; return n; }
+        [[fallthrough]];
+    case 0x3EA:  // SNE V5, 0xBB
+        pc = (V[0x5] != 0xBB) ? 0x3EE : 0x3EC;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3EC - 0x3ED (fallthrough)
+uint32_t block_3EC(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3EC:  // RND VE, 0xDA
+        pc = 0x3EC;
+        if (X::interpret<Quirks>(c, 0xCEDA)) { return n + 1; }
+        pc = 0x3EE;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3EE - 0x3EF (skip)
+uint32_t block_3EE(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3EE:  // SNE VC, 0x82
+        pc = (V[0xC] != 0x82) ? 0x3F2 : 0x3F0;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3F0 - 0x3F1 (fallthrough)
+uint32_t block_3F0(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3F0:  // DRW V5, VE, D
+        pc = 0x3F0;
+        if (X::interpret<Quirks>(c, 0xD5ED)) { return n + 1; }
+        pc = 0x3F2;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3F2 - 0x3F5 (indirect)
+uint32_t block_3F2(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3F2:  // LD V2, 0x90
+        V[0x2] = 0x90;
+        if (++n == budget) { pc = 0x3F4; return n; }
+        [[fallthrough]];
+    case 0x3F4:  // JP V0, 0x254
+        pc = 0x3F4;
+        X::interpret<Quirks>(c, 0xB254);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x3F8 - 0x3F9 (jump)
+uint32_t block_3F8(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x3F8:  // JP 0x2BA
+        pc = 0x2BA;
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+const CompiledBlock BLOCKS[] = {
+    {0x200, 0x202, block_200},
+    {0x202, 0x204, block_202},
+    {0x204, 0x206, block_204},
+    {0x206, 0x208, block_206},
+    {0x208, 0x20A, block_208},
+    {0x20A, 0x20C, block_20A},
+    {0x20C, 0x20E, block_20C},
+    {0x20E, 0x210, block_20E},
+    {0x210, 0x212, block_210},
+    {0x212, 0x214, block_212},
+    {0x214, 0x216, block_214},
+    {0x216, 0x218, block_216},
+    {0x218, 0x21A, block_218},
+    {0x21A, 0x21C, block_21A},
+    {0x21C, 0x21E, block_21C},
+    {0x21E, 0x220, block_21E},
+    {0x220, 0x224, block_220},
+    {0x224, 0x226, block_224},
+    {0x226, 0x22C, block_226},
+    {0x22C, 0x22E, block_22C},
+    {0x22E, 0x238, block_22E},
+    {0x238, 0x23A, block_238},
+    {0x23A, 0x23E, block_23A},
+    {0x23E, 0x240, block_23E},
+    {0x240, 0x242, block_240},
+    {0x242, 0x246, block_242},
+    {0x276, 0x278, block_276},
+    {0x278, 0x27A, block_278},
+    {0x27A, 0x282, block_27A},
+    {0x2BA, 0x2BC, block_2BA},
+    {0x2C2, 0x2CE, block_2C2},
+    {0x2D6, 0x2DA, block_2D6},
+    {0x2DA, 0x2DC, block_2DA},
+    {0x2DC, 0x2DE, block_2DC},
+    {0x2DE, 0x2E0, block_2DE},
+    {0x2E0, 0x2E4, block_2E0},
+    {0x2F8, 0x2FC, block_2F8},
+    {0x2FC, 0x2FE, block_2FC},
+    {0x2FE, 0x300, block_2FE},
+    {0x330, 0x334, block_330},
+    {0x334, 0x336, block_334},
+    {0x336, 0x33A, block_336},
+    {0x39E, 0x3A0, block_39E},
+    {0x3A0, 0x3A6, block_3A0},
+    {0x3C6, 0x3CA, block_3C6},
+    {0x3CA, 0x3CC, block_3CA},
+    {0x3CC, 0x3CE, block_3CC},
+    {0x3CE, 0x3D6, block_3CE},
+    {0x3D6, 0x3DE, block_3D6},
+    {0x3DE, 0x3E0, block_3DE},
+    {0x3E0, 0x3E2, block_3E0},
+    {0x3E2, 0x3E4, block_3E2},
+    {0x3E4, 0x3E6, block_3E4},
+    {0x3E6, 0x3E8, block_3E6},
+    {0x3E8, 0x3EC, block_3E8},
+    {0x3EC, 0x3EE, block_3EC},
+    {0x3EE, 0x3F0, block_3EE},
+    {0x3F0, 0x3F2, block_3F0},
+    {0x3F2, 0x3F6, block_3F2},
+    {0x3F8, 0x3FA, block_3F8},
+};
+
+const uint8_t IMAGE[] = {
+    0x22, 0x02, 0x22, 0x04, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0A, 0x22, 0x0C, 0x22, 0x0E, 0x22, 0x10,
+    0x22, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1A, 0x22, 0x1C, 0x22, 0x1E, 0x22, 0x20,
+    0x6D, 0x3B, 0x43, 0x20, 0x89, 0x63, 0xD6, 0x3A, 0xC9, 0xE7, 0xE4, 0x9E, 0x12, 0xD6, 0x00, 0xE0,
+    0xC9, 0x17, 0xFC, 0x65, 0x83, 0x07, 0x4F, 0x8E, 0x86, 0x77, 0x00, 0xE0, 0x12, 0x26, 0x41, 0xC7,
+    0x7D, 0x35, 0x74, 0x20, 0x13, 0x9E, 0x00, 0xC8, 0xE6, 0x9E, 0x8E, 0x5E, 0x38, 0xBA, 0x12, 0x88,
+    0xF4, 0x33, 0x12, 0x2E, 0xC5, 0x66, 0xDA, 0x50, 0x74, 0xC3, 0x00, 0xE0, 0x12, 0xB6, 0x62, 0xB6,
+    0xB2, 0x68, 0x4B, 0x6B, 0x12, 0xB6, 0x13, 0x2E, 0x13, 0x12, 0xA8, 0xC1, 0x00, 0xEE, 0x87, 0x71,
+    0x73, 0xE5, 0x23, 0x4A, 0x7A, 0xF6, 0x48, 0x8A, 0xFC, 0x33, 0x00, 0xE0, 0xF9, 0x33, 0x67, 0x66,
+    0x13, 0xD6, 0x73, 0x80, 0x34, 0xA6, 0x22, 0x9A, 0x22, 0x56, 0x00, 0xFE, 0x13, 0x38, 0x94, 0x00,
+    0x8B, 0xF6, 0x00, 0xE0, 0x12, 0xB0, 0x9B, 0xC0, 0x00, 0xEE, 0x3C, 0x7B, 0xD0, 0x4F, 0x13, 0xEE,
+    0xAB, 0x6E, 0x13, 0xAA, 0xAC, 0xBA, 0x13, 0xA2, 0xD9, 0x99, 0xC2, 0x1E, 0xE6, 0x46, 0xF8, 0x30,
+    0xA9, 0xBB, 0x38, 0xBE, 0x32, 0x9C, 0x76, 0xD1, 0x13, 0xCE, 0x12, 0xC2, 0x13, 0xC4, 0x4C, 0xD6,
+    0x00, 0xE0, 0x78, 0x79, 0x8A, 0x92, 0x00, 0xE0, 0xF9, 0x33, 0x63, 0xFB, 0x13, 0x30, 0xC4, 0xCA,
+    0x12, 0x96, 0x79, 0x3F, 0x58, 0x80, 0x00, 0xE0, 0x37, 0xF2, 0xC5, 0xBA, 0x5C, 0xE0, 0xA3, 0xA8,
+    0x00, 0xFE, 0x12, 0x3E, 0x62, 0xBA, 0xB2, 0x06, 0x13, 0xB0, 0x7C, 0xD1, 0x6D, 0xBD, 0x00, 0xE0,
+    0xA9, 0xB0, 0xD7, 0x3E, 0x33, 0xF5, 0xAD, 0xBA, 0x64, 0xFD, 0x9E, 0xA0, 0x67, 0x4D, 0x12, 0x76,
+    0x81, 0x91, 0x12, 0x90, 0xF7, 0x65, 0x13, 0x7A, 0x22, 0x1A, 0x6E, 0x02, 0xA5, 0x36, 0x63, 0x7E,
+    0x9D, 0x70, 0x69, 0x4B, 0xC6, 0x1E, 0x35, 0xFB, 0x8E, 0x06, 0xA2, 0xA5, 0xD8, 0xAA, 0x82, 0xD6,
+    0x82, 0x00, 0x40, 0x1A, 0x75, 0xE9, 0xF2, 0x55, 0x86, 0xB7, 0xEF, 0xA1, 0x23, 0x6A, 0x12, 0xBE,
+    0xD4, 0x0D, 0x36, 0xD1, 0x8D, 0xE7, 0xF0, 0x18, 0x12, 0xF8, 0xEE, 0xA1, 0x33, 0x3B, 0x12, 0xD8,
+    0x89, 0x44, 0x12, 0x5E, 0xC1, 0x72, 0x66, 0x8E, 0x00, 0xE0, 0x13, 0x50, 0xD9, 0xDA, 0x49, 0x5A,
+    0x69, 0xB0, 0xA2, 0xA6, 0xA7, 0x1E, 0x42, 0x96, 0xE3, 0x9E, 0xF1, 0x0A, 0x00, 0xE0, 0xD6, 0x93,
+    0x80, 0xA3, 0x6E, 0x35, 0x12, 0x72, 0xFE, 0x65, 0x22, 0xE2, 0x13, 0x4E, 0x35, 0xC6, 0x23, 0xBA,
+    0x12, 0xA0, 0xD0, 0x60, 0xE4, 0xA1, 0xEB, 0xA1, 0x13, 0x52, 0x00, 0xFC, 0x7D, 0x16, 0x6C, 0xDC,
+    0x4C, 0xCA, 0x00, 0xE0, 0x78, 0x94, 0xF2, 0x65, 0x8E, 0xAE, 0x39, 0x54, 0x7A, 0x4B, 0xD2, 0xAF,
+    0x12, 0x1A, 0x7F, 0x08, 0x23, 0xD8, 0x13, 0xDE, 0x33, 0x7C, 0x12, 0xCA, 0x35, 0x91, 0x23, 0xF8,
+    0xDD, 0x1F, 0xA7, 0x0A, 0x13, 0xC6, 0xE1, 0xA1, 0xF0, 0x30, 0x7A, 0x46, 0x13, 0x64, 0xFD, 0x1E,
+    0x8E, 0xA3, 0x35, 0xE4, 0x00, 0xEE, 0xDF, 0x49, 0x00, 0xEE, 0x78, 0xCB, 0x00, 0xE0, 0x12, 0x6E,
+    0xF3, 0x0A, 0x62, 0xD0, 0xB2, 0x10, 0x6E, 0xF5, 0x56, 0xB0, 0x3E, 0x31, 0xC4, 0xE8, 0xC2, 0x84,
+    0x7A, 0x71, 0x65, 0x2B, 0x00, 0xFC, 0x6F, 0x93, 0x7E, 0x75, 0x00, 0xC0, 0x9F, 0x10, 0x13, 0xEC,
+    0x4A, 0x16, 0xAB, 0xBF, 0x39, 0x6B, 0xDA, 0xE6, 0xCB, 0xE5, 0x45, 0xBB, 0xCE, 0xDA, 0x4C, 0x82,
+    0xD5, 0xED, 0x62, 0x90, 0xB2, 0x54, 0x7F, 0x13, 0x12, 0xBA, 0x00, 0xFE, 0x12, 0x00, 0x12, 0x00,
+};
+
+const CompiledRom ROM = {
+    0xEDC40C87A212B08BULL, 512, QuirkProfile::SuperChip, "rom6-schip.ch8",
+    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE
+};
+
+const CompiledRomRegistrar REGISTRAR(&ROM);
+
+}  // namespace
@@ -0,0 +1,408 @@
+// Generated by chip8_recompile from rom7-xochip.ch8 (xochip profile). Do not edit.
+#include "aot.h"
+
+namespace {
+
+using X = CompiledRomAccess;
+using Quirks = XoChipQuirks;
+
+// 0x200 - 0x201 (call)
+uint32_t block_200(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x200:  // CALL 0x202
+        X::call(c, 0x200, 0x202);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x202 - 0x203 (call)
+uint32_t block_202(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x202:  // CALL 0x204
+        X::call(c, 0x202, 0x204);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x204 - 0x205 (call)
+uint32_t block_204(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x204:  // CALL 0x206
+        X::call(c, 0x204, 0x206);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x206 - 0x207 (call)
+uint32_t block_206(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x206:  // CALL 0x208
+        X::call(c, 0x206, 0x208);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x208 - 0x209 (call)
+uint32_t block_208(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x208:  // CALL 0x20A
+        X::call(c, 0x208, 0x20A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20A - 0x20B (call)
+uint32_t block_20A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20A:  // CALL 0x20C
+        X::call(c, 0x20A, 0x20C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20C - 0x20D (call)
+uint32_t block_20C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20C:  // CALL 0x20E
+        X::call(c, 0x20C, 0x20E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x20E - 0x20F (call)
+uint32_t block_20E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x20E:  // CALL 0x210
+        X::call(c, 0x20E, 0x210);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x210 - 0x211 (call)
+uint32_t block_210(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x210:  // CALL 0x212
+        X::call(c, 0x210, 0x212);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x212 - 0x213 (call)
+uint32_t block_212(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x212:  // CALL 0x214
+        X::call(c, 0x212, 0x214);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x214 - 0x215 (call)
+uint32_t block_214(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x214:  // CALL 0x216
+        X::call(c, 0x214, 0x216);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x216 - 0x217 (call)
+uint32_t block_216(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x216:  // CALL 0x218
+        X::call(c, 0x216, 0x218);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x218 - 0x219 (call)
+uint32_t block_218(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x218:  // CALL 0x21A
+        X::call(c, 0x218, 0x21A);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21A - 0x21B (call)
+uint32_t block_21A(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21A:  // CALL 0x21C
+        X::call(c, 0x21A, 0x21C);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21C - 0x21D (call)
+uint32_t block_21C(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21C:  // CALL 0x21E
+        X::call(c, 0x21C, 0x21E);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x21E - 0x21F (call)
+uint32_t block_21E(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x21E:  // CALL 0x220
+        X::call(c, 0x21E, 0x220);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+// 0x220 - 0x231 (return)
+uint32_t block_220(Chip8& c, uint32_t budget) {
+    auto& V = X::V(c);
+    uint16_t& I = X::I(c);
+    uint16_t& pc = X::pc(c);
+    (void)V;
+    (void)I;
+    (void)budget;
+    uint32_t n = 0;
+    switch (pc) {
+    case 0x220:  // LD V8, 0x51
+        V[0x8] = 0x51;
+        if (++n == budget) { pc = 0x222; return n; }
+        [[fallthrough]];
+    case 0x222:  // XOR V9, V9
+        V[0x9] ^= V[0x9];
+        if (++n == budget) { pc = 0x224; return n; }
+        [[fallthrough]];
+    case 0x224:  // LD HF, VD
+        pc = 0x224;
+        if (X::interpret<Quirks>(c, 0xFD30)) { return n + 1; }
+        if (++n == budget) { pc = 0x226; return n; }
+        [[fallthrough]];
+    case 0x226:  // SCU 4
+        pc = 0x226;
+        if (X::interpret<Quirks>(c, 0x00D4)) { return n + 1; }
+        if (++n == budget) { pc = 0x228; return n; }
+        [[fallthrough]];
+    case 0x228:  // ADD V1, 0x98
+        V[0x1] = static_cast<uint8_t>(V[0x1] + 0x98);
+        if (++n == budget) { pc = 0x22A; return n; }
+        [[fallthrough]];
+    case 0x22A:  // LD I, 0xD3B0
+        I = 0xD3B0;
+        if (++n == budget) { pc = 0x22E; return n; }
+        [[fallthrough]];
+    case 0x22E:  // DRW V1, V1, F
+        pc = 0x22E;
+        if (X::interpret<Quirks>(c, 0xD11F)) { return n + 1; }
+        if (++n == budget) { pc = 0x230; return n; }
+        [[fallthrough]];
+    case 0x230:  // RET
+        X::ret(c);
+        return n + 1;
+    default:
+        return 0;  // Not an instruction boundary
+    }
+}
+
+const CompiledBlock BLOCKS[] = {
+    {0x200, 0x202, block_200},
+    {0x202, 0x204, block_202},
+    {0x204, 0x206, block_204},
+    {0x206, 0x208, block_206},
+    {0x208, 0x20A, block_208},
+    {0x20A, 0x20C, block_20A},
+    {0x20C, 0x20E, block_20C},
+    {0x20E, 0x210, block_20E},
+    {0x210, 0x212, block_210},
+    {0x212, 0x214, block_212},
+    {0x214, 0x216, block_214},
+    {0x216, 0x218, block_216},
+    {0x218, 0x21A, block_218},
+    {0x21A, 0x21C, block_21A},
+    {0x21C, 0x21E, block_21C},
+    {0x21E, 0x220, block_21E},
+    {0x220, 0x232, block_220},
+};
+
+const uint8_t IMAGE[] = {
+    0x22, 0x02, 0x22, 0x04, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0A, 0x22, 0x0C, 0x22, 0x0E, 0x22, 0x10,
+    0x22, 0x12, 0x22, 0x14, 0x22, 0x16, 0x22, 0x18, 0x22, 0x1A, 0x22, 0x1C, 0x22, 0x1E, 0x22, 0x20,
+    0x68, 0x51, 0x89, 0x93, 0xFD, 0x30, 0x00, 0xD4, 0x71, 0x98, 0xF0, 0x00, 0xD3, 0xB0, 0xD1, 0x1F,
+    0x00, 0xEE, 0xFD, 0x3A, 0x68, 0x7B, 0x76, 0xE9, 0x13, 0x92, 0x60, 0x8A, 0xB2, 0x2E, 0x41, 0x93,
+    0x68, 0x5C, 0x6A, 0x3E, 0xA6, 0xBF, 0x60, 0x9E, 0xB2, 0x4C, 0xFA, 0x18, 0x5D, 0x50, 0x12, 0x48,
+    0x68, 0xA3, 0xF0, 0x15, 0x12, 0x96, 0xD4, 0x3F, 0x6C, 0x5F, 0x66, 0x25, 0x12, 0x12, 0x22, 0x76,
+    0x38, 0xCC, 0x5D, 0x20, 0x3A, 0x0E, 0x95, 0x50, 0xD9, 0x55, 0xC2, 0x9A, 0x3A, 0x4D, 0xAD, 0xA7,
+    0x42, 0xF3, 0xD9, 0x7F, 0x00, 0xE0, 0xD0, 0x6A, 0x63, 0x4E, 0xEB, 0x9E, 0xD3, 0x26, 0x59, 0x92,
+    0x83, 0x12, 0x12, 0xB0, 0xF0, 0x00, 0x94, 0x2E, 0x78, 0x8B, 0x79, 0x54, 0x67, 0x2D, 0x72, 0x3B,
+    0x00, 0xE0, 0x13, 0x4C, 0xDC, 0x82, 0x6E, 0x99, 0xC0, 0x84, 0xDF, 0xEA, 0x00, 0xDC, 0x12, 0x7E,
+    0xEF, 0xA1, 0xCB, 0x6E, 0x4A, 0x3A, 0xF0, 0x00, 0xA6, 0x9A, 0x81, 0xB5, 0x75, 0xAD, 0xF6, 0x33,
+    0x8A, 0xA4, 0x60, 0x6C, 0xB2, 0x94, 0xF0, 0x00, 0x49, 0x43, 0x13, 0x60, 0x00, 0xC6, 0xDB, 0xDA,
+    0x00, 0xEE, 0xF0, 0x00, 0xEE, 0x11, 0xFA, 0x30, 0x00, 0xFE, 0x55, 0x82, 0x60, 0xB2, 0xB2, 0x82,
+    0x44, 0x46, 0x00, 0xCA, 0x8C, 0x40, 0x51, 0x10, 0xE3, 0x9E, 0x56, 0x63, 0xF0, 0x00, 0xB0, 0x52,
+    0x00, 0xD7, 0x87, 0xD1, 0x00, 0xE0, 0xD4, 0xEE, 0x13, 0xE4, 0x76, 0x13, 0x77, 0x15, 0xEC, 0x9E,
+    0xA3, 0xDA, 0x77, 0x24, 0x23, 0x4E, 0x13, 0x28, 0xAC, 0x10, 0x63, 0x25, 0x00, 0xE0, 0x13, 0xA8,
+    0xA3, 0x87, 0xE1, 0x9E, 0xCD, 0xA5, 0x78, 0x23, 0x93, 0x60, 0x7C, 0x53, 0x86, 0x37, 0x12, 0x74,
+    0x60, 0x10, 0xB2, 0xEC, 0x00, 0xE0, 0xFB, 0x18, 0x9C, 0xB0, 0xA5, 0x0C, 0x45, 0xDC, 0x23, 0x90,
+    0xA3, 0xCA, 0x60, 0x36, 0xB2, 0x72, 0xD4, 0xD0, 0x13, 0x74, 0x3E, 0xC9, 0x80, 0x14, 0xF0, 0x02,
+    0x23, 0xF8, 0xC9, 0xE6, 0xF0, 0x02, 0x64, 0xD0, 0x12, 0xFE, 0xE4, 0xA1, 0x12, 0x4A, 0x13, 0x8C,
+    0x5B, 0x30, 0x68, 0xA7, 0x51, 0x20, 0x8F, 0x04, 0x88, 0x85, 0x13, 0x4C, 0x00, 0xFE, 0xE6, 0xA1,
+    0xA1, 0x31, 0x6F, 0x13, 0xA7, 0xF2, 0x84, 0x54, 0xF5, 0x07, 0xFD, 0x3A, 0x9D, 0x30, 0x00, 0xEE,
+    0x94, 0x70, 0x00, 0xE0, 0x22, 0xC2, 0x87, 0x8E, 0x00, 0xFE, 0xA9, 0xB2, 0x83, 0xD6, 0x52, 0x72,
+    0x48, 0x7F, 0xA4, 0xC3, 0xCD, 0xA0, 0x81, 0x04, 0xF2, 0x0A, 0xCC, 0x2F, 0x12, 0x16, 0x8F, 0xA7,
+    0x45, 0x0E, 0x12, 0xC0, 0xAD, 0xF5, 0x81, 0xFE, 0x12, 0x12, 0x5A, 0x40, 0xF9, 0x29, 0x12, 0x34,
+    0x13, 0xC0, 0xC4, 0x3F, 0x13, 0xD2, 0x13, 0x9C, 0x8F, 0xC5, 0x23, 0x0C, 0x12, 0x92, 0xFA, 0x30,
+    0xC8, 0x71, 0x13, 0x6E, 0x6C, 0x60, 0x22, 0x80, 0x7A, 0xB8, 0x93, 0xF0, 0xE8, 0xA1, 0x5A, 0x90,
+    0xA2, 0x48, 0x23, 0xAA, 0x13, 0x8A, 0x60, 0x3E, 0xB2, 0xAC, 0xC1, 0x4D, 0xD8, 0x06, 0x23, 0x3E,
+    0xDE, 0x4F, 0x13, 0x30, 0x6B, 0xF3, 0x3F, 0x61, 0x70, 0xF9, 0x60, 0x8C, 0xB2, 0x8E, 0xA2, 0x4C,
+    0xFF, 0x30, 0xD1, 0x3E, 0xDA, 0x54, 0xC7, 0x93, 0xD6, 0xAF, 0xC8, 0xE6, 0x44, 0xF0, 0x84, 0xC7,
+    0xA7, 0x44, 0x7B, 0xA7, 0x00, 0xFB, 0x45, 0xCF, 0xCE, 0xCA, 0x3E, 0xE0, 0xE0, 0xA1, 0x61, 0x24,
+    0x60, 0x3C, 0xB2, 0xFA, 0x89, 0x37, 0x12, 0x72, 0xED, 0x9E, 0x12, 0xDE, 0x12, 0x00, 0x12, 0x00,
+};
+
+const CompiledRom ROM = {
+    0x25B96D26D36040CCULL, 512, QuirkProfile::XoChip, "rom7-xochip.ch8",
+    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE
+};
+
+const CompiledRomRegistrar REGISTRAR(&ROM);
+
+}  // namespace
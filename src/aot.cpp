@@ -0,0 +1,43 @@
+#include "aot.h"
+#include <cstring> // For memcmp
+#include <vector>  // For the registry
+
+/*
+ * Registry of compiled ROMs
+ *
+ * WHY a function-local static?
+ * Generated files register from their own static constructors, which
+ * may run before this file's globals are constructed. A local static is
+ * created on first use, whichever file gets there first.
+ */
+static std::vector<const CompiledRom*>& registry() {
+    static std::vector<const CompiledRom*> roms;
+    return roms;
+}
+
+void registerCompiledRom(const CompiledRom* rom) {
+    registry().push_back(rom);
+}
+
+bool hasCompiledRoms() {
+    return !registry().empty();
+}
+
+const CompiledRom* findCompiledRom(uint64_t romHash, std::size_t romSize, QuirkProfile profile) {
+    for (const CompiledRom* rom : registry()) {
+        if (rom->romHash == romHash && rom->romSize == romSize && rom->profile == profile) {
+            return rom;
+        }
+    }
+    return nullptr;
+}
+
+const CompiledRom* findCompiledRomIn(const uint8_t* memory, std::size_t capacity, QuirkProfile profile) {
+    for (const CompiledRom* rom : registry()) {
+        if (rom->profile == profile && rom->romSize <= capacity &&
+            std::memcmp(memory, rom->image, rom->romSize) == 0) {
+            return rom;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,94 @@
+#ifndef AOT_H
+#define AOT_H
+
+#include <cstddef>   // For std::size_t
+#include <cstdint>   // For fixed-width integer types
+#include "chip8.h"   // Compiled code works directly on Chip8 state
+
+/*
+ * Ahead-of-Time Compiled ROMs
+ *
+ * chip8_recompile turns a ROM into a C++ file (one function per basic
+ * block, see cfg.h). Generated files in aot/ are built into the emulator
+ * and the headless runner; each registers itself here at startup.
+ * Chip8::loadROM hashes the ROM and, when a compiled version for the
+ * same bytes and quirk profile exists, runs it instead of interpreting.
+ *
+ * WHY ahead of time and not a JIT?
+ * The C++ compiler sees whole blocks with constant opcodes, so register
+ * moves, ALU ops and branches become plain machine code with full
+ * optimization, and nothing writable is ever executed (no W^X concerns,
+ * works where JITs are forbidden).
+ *
+ * WHAT STAYS INTERPRETED:
+ * - Instructions a block calls back into the interpreter for (drawing,
+ *   stores, keys, timers, random numbers): one call, exact semantics.
+ * - Code the analyzer didn't reach (BNNN targets, code loaded at runtime)
+ *   and blocks it flagged as self-modified.
+ * - Blocks overwritten at runtime: every store that lands on compiled
+ *   code drops the blocks it touches, and the interpreter takes over there.
+ *   Chip8::loadState() keeps the compiled ROM and re-checks every block
+ *   against the ROM image, so a restored state gets back exactly the
+ *   blocks its memory still matches.
+ *
+ * A block function runs from the current PC (any instruction inside the
+ * block is a valid entry) for at most `budget` instructions and returns
+ * how many it ran; 0 means "not mine, interpret".
+ */
+
+struct CompiledBlock {
+    uint16_t start;
+    uint32_t end;                                   // One past the last byte
+    uint32_t (*run)(Chip8& chip8, uint32_t budget);
+};
+
+struct CompiledRom {
+    uint64_t romHash;          // hashBytes() over the ROM file
+    uint32_t romSize;
+    QuirkProfile profile;      // Semantics the code was generated for
+    const char* name;          // ROM file name, for log messages
+    const CompiledBlock* blocks;
+    std::size_t blockCount;
+    const uint8_t* image;      // The ROM bytes (romSize): blocks are only used
+                               // while memory still holds their bytes
+};
+
+void registerCompiledRom(const CompiledRom* rom);
+bool hasCompiledRoms();
+const CompiledRom* findCompiledRom(uint64_t romHash, std::size_t romSize, QuirkProfile profile);
+// A compiled ROM whose whole image is at memory (ROM start, capacity bytes), or nullptr
+const CompiledRom* findCompiledRomIn(const uint8_t* memory, std::size_t capacity, QuirkProfile profile);
+
+// Static object in each generated file: registers the ROM before main()
+struct CompiledRomRegistrar {
+    explicit CompiledRomRegistrar(const CompiledRom* rom) { registerCompiledRom(rom); }
+};
+
+/*
+ * The generated code's view of Chip8 internals (Chip8 befriends this
+ * struct so the registers can stay private to everyone else)
+ */
+struct CompiledRomAccess {
+    static std::array<uint8_t, Chip8::REGISTER_COUNT>& V(Chip8& c) { return c.V; }
+    static uint16_t& I(Chip8& c) { return c.I; }
+    static uint16_t& pc(Chip8& c) { return c.pc; }
+
+    // 2NNN: push the CALL's own address (00EE adds 2), like the interpreter
+    static void call(Chip8& c, uint16_t from, uint16_t to) {
+        c.stack[c.sp & Chip8::STACK_MASK] = from;
+        ++c.sp;
+        c.pc = to;
+    }
+    static void ret(Chip8& c) {
+        --c.sp;
+        c.pc = static_cast<uint16_t>(c.stack[c.sp & Chip8::STACK_MASK] + 2);
+    }
+
+    // Run one instruction with the interpreter (pc must point at it).
+    // Returns true if the block must stop: the instruction overwrote
+    // compiled code, or FX0A is now waiting for a key.
+    template <typename Quirks>
+    static bool interpret(Chip8& c, uint16_t opcode);
+};
+
+#endif // AOT_H
@@ -0,0 +1,118 @@
+#include "beeper.h"
+#include <algorithm>  // For std::min, std::max
+#include <cmath>      // For std::pow, std::floor
+
+Beeper::Beeper(int sampleRate)
+    : sampleRate(sampleRate),
+      samplesPerTick(sampleRate / TICK_RATE),
+      rampStep(1.0f / (sampleRate / 500.0f)),  // 2ms fade in/out
+      current(),
+      samplesLeft(0),
+      heldTicks(0),
+      phase(0.0),
+      gain(0.0f),
+      underruns(0) {
+}
+
+/*
+ * Push Tick (emulation thread)
+ *
+ * Call right after Chip8::updateTimers(). If the audio thread is far
+ * behind and the ring is full, the tick is dropped: render() would skip
+ * it anyway to keep latency bounded.
+ */
+void Beeper::pushTick(const Chip8& chip8) {
+    SoundTick tick;
+    tick.on = chip8.shouldBeep();
+    tick.usePattern = chip8.hasAudioPattern();
+    tick.pitch = chip8.getAudioPitch();
+    tick.pattern = chip8.getAudioPattern();
+    ticks.tryPush(tick);
+}
+
+/*
+ * Start Next Tick (audio thread)
+ *
+ * Normally pops one tick. If more than MAX_QUEUED_TICKS are waiting the
+ * audio is lagging, so the oldest ones are skipped. If none are waiting
+ * the previous tick is held (the emulator is only briefly late, e.g. a
+ * slow frame); after HOLD_TICKS the sound is switched off.
+ */
+void Beeper::startNextTick() {
+    samplesLeft = samplesPerTick;
+
+    SoundTick next;
+    bool got = false;
+    while (ticks.size() > MAX_QUEUED_TICKS && ticks.tryPop(next)) {
+        got = true;  // Skip stale ticks
+    }
+    if (ticks.tryPop(next)) {
+        got = true;
+    }
+
+    if (got) {
+        current = next;
+        heldTicks = 0;
+    } else if (++heldTicks > HOLD_TICKS) {
+        current.on = false;
+        underruns.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/*
+ * One Sample (audio thread), in the range -1..1 before volume
+ *
+ * Square wave: phase counts cycles; the first half of each cycle is high.
+ * XO-CHIP pattern: phase counts pattern bits; the playback rate is
+ *   4000 * 2^((pitch - 64) / 48) bits per second (pitch 64 = 4000Hz)
+ *   and each bit is +1 or -1.
+ */
+float Beeper::sample() {
+    if (current.usePattern) {
+        double rate = 4000.0 * std::pow(2.0, (current.pitch - 64) / 48.0);
+        phase += rate / sampleRate;
+        if (phase >= 128.0) {
+            phase -= 128.0 * std::floor(phase / 128.0);
+        }
+        int bit = static_cast<int>(phase);
+        bool high = (current.pattern[bit >> 3] >> (7 - (bit & 7))) & 1;
+        return high ? 1.0f : -1.0f;
+    }
+
+    phase += SQUARE_FREQ_HZ / sampleRate;
+    if (phase >= 1.0) {
+        phase -= std::floor(phase);
+    }
+    return phase < 0.5 ? 1.0f : -1.0f;
+}
+
+/*
+ * Render (audio thread)
+ *
+ * Called by the audio device with a buffer to fill. The volume moves
+ * towards its target (on or off) by rampStep per sample, so state changes
+ * become short fades instead of clicks.
+ */
+void Beeper::render(int16_t* out, unsigned int frames) {
+    for (unsigned int i = 0; i < frames; ++i) {
+        if (samplesLeft == 0) {
+            startNextTick();
+        }
+        --samplesLeft;
+
+        float target = current.on ? 1.0f : 0.0f;
+        if (gain < target) {
+            gain = std::min(target, gain + rampStep);
+        } else if (gain > target) {
+            gain = std::max(target, gain - rampStep);
+        }
+
+        // Keep the oscillator still while silent, so every beep starts
+        // from the same point of the wave
+        if (gain == 0.0f) {
+            out[i] = 0;
+            continue;
+        }
+        out[i] = static_cast<int16_t>(sample() * gain * AMPLITUDE);
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef BEEPER_H
+#define BEEPER_H
+
+#include "chip8.h"
+#include "spsc_ring.h"
+#include <array>    // For the XO-CHIP pattern copy
+#include <atomic>   // For the underrun counter
+#include <cstdint>  // For fixed-width integer types
+
+/*
+ * Beeper: Procedural CHIP-8 Sound
+ *
+ * CHIP-8 has a single sound source: a buzzer that is on while the sound
+ * timer is non-zero. XO-CHIP replaces the buzzer tone with a 128-sample
+ * 1-bit pattern (F002) played at a programmable rate (FX3A).
+ *
+ * Everything is synthesised here, so there are no sound files to load.
+ *
+ * TWO THREADS:
+ * - The emulation loop calls pushTick() once per 60Hz timer tick. It
+ *   copies the sound state into a lock-free ring and returns; it never
+ *   waits for the audio device.
+ * - The audio device calls render() from its own thread whenever it
+ *   needs samples. Each tick covers exactly sampleRate / 60 samples
+ *   (735 at 44.1kHz), so the sound starts and stops on tick boundaries
+ *   no matter how unevenly the frames are rendered.
+ *
+ * NO CLICKS OR GAPS:
+ * - Oscillator phase carries across ticks, so a tone that stays on for
+ *   several ticks is one continuous wave
+ * - Switching on/off ramps the volume over a few milliseconds instead
+ *   of jumping (a jump is what you hear as a click)
+ * - If the emulator falls behind (ring empty), the last tick is held for
+ *   a little while, then faded out, instead of cutting to silence
+ * - If the emulator runs ahead, old ticks are skipped so latency stays
+ *   bounded (MAX_QUEUED_TICKS)
+ */
+
+// One 60Hz tick of sound state, as it travels to the audio thread
+struct SoundTick {
+    bool on;                          // Sound timer > 0
+    bool usePattern;                  // XO-CHIP pattern loaded (F002)
+    uint8_t pitch;                    // FX3A value
+    std::array<uint8_t, 16> pattern;  // 128 one-bit samples, MSB first
+};
+
+class Beeper {
+public:
+    static constexpr int DEFAULT_SAMPLE_RATE = 44100;
+    static constexpr int TICK_RATE = 60;               // Timer ticks per second
+    static constexpr double SQUARE_FREQ_HZ = 440.0;    // Classic buzzer tone
+    static constexpr int16_t AMPLITUDE = 6000;         // Well below full scale
+    static constexpr int MAX_QUEUED_TICKS = 4;         // ~67ms of latency at most
+    static constexpr int HOLD_TICKS = 2;               // Underrun tolerance
+
+    explicit Beeper(int sampleRate = DEFAULT_SAMPLE_RATE);
+
+    // Emulation thread: record this tick's sound state (never blocks)
+    void pushTick(const Chip8& chip8);
+
+    // Audio thread: fill out with frames mono 16-bit samples
+    void render(int16_t* out, unsigned int frames);
+
+    int getSampleRate() const { return sampleRate; }
+    uint32_t getUnderruns() const { return underruns.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr std::size_t QUEUE_CAPACITY = 64;  // ~1s of ticks
+    SpscRing<SoundTick, QUEUE_CAPACITY> ticks;
+
+    int sampleRate;
+    int samplesPerTick;
+    float rampStep;                   // Gain change per sample
+
+    // Audio-thread state (only render() touches these)
+    SoundTick current;
+    int samplesLeft;                  // Samples until the next tick starts
+    int heldTicks;                    // Consecutive ticks with no new data
+    double phase;                     // Square: cycles, pattern: bit position
+    float gain;                       // 0 = silent, 1 = full volume
+
+    std::atomic<uint32_t> underruns;
+
+    void startNextTick();
+    float sample();
+};
+
+#endif // BEEPER_H
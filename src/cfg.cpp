@@ -0,0 +1,543 @@
+#include "cfg.h"
+#include "chip8.h"    // For ROM_START_ADDRESS
+#include <algorithm>  // For sort, unique, lower_bound
+
+const char* blockExitName(BlockExit exit) {
+    switch (exit) {
+        case BlockExit::Fallthrough: return "fallthrough";
+        case BlockExit::Jump:        return "jump";
+        case BlockExit::Call:        return "call";
+        case BlockExit::Return:      return "return";
+        case BlockExit::Skip:        return "skip";
+        case BlockExit::Indirect:    return "indirect";
+        case BlockExit::Exit:        return "exit";
+    }
+    return "unknown";
+}
+
+const BasicBlock* ControlFlowGraph::findBlock(uint16_t address) const {
+    auto it = std::lower_bound(blocks.begin(), blocks.end(), address,
+                               [](const BasicBlock& block, uint16_t a) { return block.start < a; });
+    return (it != blocks.end() && it->start == address) ? &*it : nullptr;
+}
+
+bool ControlFlowGraph::isFreeOfSelfModification() const {
+    for (const StoreSite& store : stores) {
+        if (!store.known) {
+            return false;
+        }
+    }
+    for (const BasicBlock& block : blocks) {
+        if (block.selfModified) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==================== ROM VIEW ====================
+
+/*
+ * The ROM as it sits in memory: addresses, not offsets
+ */
+struct RomView {
+    const uint8_t* bytes;
+    uint32_t start;
+    uint32_t end;
+
+    bool contains(uint32_t address, uint32_t length) const {
+        return address >= start && address + length <= end;
+    }
+    uint16_t word(uint32_t address) const {
+        return static_cast<uint16_t>((bytes[address - start] << 8) | bytes[address - start + 1]);
+    }
+};
+
+/*
+ * What one instruction does to control flow
+ */
+struct Flow {
+    uint16_t opcode;
+    uint32_t length;   // 2, or 4 for XO-CHIP F000 NNNN
+    BlockExit exit;    // Fallthrough = just continues
+    uint16_t target;   // Jump / call target
+};
+
+template <typename Quirks>
+static uint32_t lengthAt(const RomView& rom, uint32_t address) {
+    if (Quirks::XOCHIP_OPCODES && rom.contains(address, 4) && rom.word(address) == 0xF000) {
+        return 4;
+    }
+    return 2;
+}
+
+template <typename Quirks>
+static Flow decodeFlow(const RomView& rom, uint32_t address) {
+    Flow flow;
+    flow.opcode = rom.word(address);
+    flow.length = lengthAt<Quirks>(rom, address);
+    flow.exit = BlockExit::Fallthrough;
+    flow.target = flow.opcode & 0x0FFF;
+
+    const uint16_t op = flow.opcode;
+    switch (op & 0xF000) {
+        case 0x0000:
+            if (op == 0x00EE) {
+                flow.exit = BlockExit::Return;
+            } else if (op == 0x00FD && Quirks::SUPERCHIP_OPCODES) {
+                flow.exit = BlockExit::Exit;
+            }
+            break;
+        case 0x1000: flow.exit = BlockExit::Jump; break;
+        case 0x2000: flow.exit = BlockExit::Call; break;
+        case 0x3000:
+        case 0x4000: flow.exit = BlockExit::Skip; break;
+        case 0x5000:
+            // Like the interpreter: every 5XYN skips except XO-CHIP's 5XY2/5XY3
+            if (!(Quirks::XOCHIP_OPCODES && ((op & 0x000F) == 0x2 || (op & 0x000F) == 0x3))) {
+                flow.exit = BlockExit::Skip;
+            }
+            break;
+        case 0x9000: flow.exit = BlockExit::Skip; break;
+        case 0xB000: flow.exit = BlockExit::Indirect; break;
+        case 0xE000:
+            if ((op & 0x00FF) == 0x9E || (op & 0x00FF) == 0xA1) {
+                flow.exit = BlockExit::Skip;
+            }
+            break;
+    }
+    return flow;
+}
+
+// ==================== STORE TRACKING ====================
+
+/*
+ * Follows I through the code so stores get a static target when possible
+ *
+ * Per block entry this is one of: not reached yet, a known value, or
+ * unknown (paths disagree, or I came from a register). Merging two
+ * states only ever moves towards "unknown", so the fixed point below
+ * is reached after a few sweeps.
+ *
+ * A known value can also be relative: an offset from whatever I held
+ * when the current subroutine was entered. That is how a subroutine is
+ * summarized (see PASS 3), so a call site knows I after the call.
+ */
+struct IndexTracker {
+    bool reached = false;
+    bool known = false;
+    bool relative = false;   // value is an offset from I at subroutine entry
+    uint32_t value = 0;
+};
+
+static const IndexTracker UNKNOWN_INDEX{true, false, false, 0};
+
+static bool sameIndex(const IndexTracker& a, const IndexTracker& b) {
+    return a.reached == b.reached && a.known == b.known && a.relative == b.relative && a.value == b.value;
+}
+
+static IndexTracker meet(const IndexTracker& a, const IndexTracker& b) {
+    if (!a.reached) {
+        return b;
+    }
+    if (!b.reached || (a.known && b.known && a.relative == b.relative && a.value == b.value)) {
+        return a;
+    }
+    return UNKNOWN_INDEX;
+}
+
+// I on return from a call: the callee's summary applied to I at the call
+static IndexTracker afterCall(const IndexTracker& callee, const IndexTracker& atCall) {
+    if (!callee.reached || !callee.known || !callee.relative) {
+        return callee;  // Never returns, returns with I unknown, or with a fixed I
+    }
+    if (!atCall.known) {
+        return UNKNOWN_INDEX;
+    }
+    IndexTracker result = atCall;
+    result.value = (atCall.value + callee.value) & 0xFFFF;
+    return result;
+}
+
+// Stores are only recorded when a list is given (the fixed point sweeps pass nullptr)
+template <typename Quirks>
+static void trackIndex(const RomView& rom, uint32_t address, const Flow& flow,
+                       IndexTracker& index, std::vector<StoreSite>* stores) {
+    const uint16_t op = flow.opcode;
+    const uint32_t x = (op >> 8) & 0xF;
+    const uint32_t y = (op >> 4) & 0xF;
+
+    auto store = [&](uint32_t length) {
+        if (stores == nullptr) {
+            return;
+        }
+        StoreSite site;
+        site.pc = static_cast<uint16_t>(address);
+        site.known = index.known;
+        site.target = {index.value, index.value + length};
+        stores->push_back(site);
+    };
+    auto advanceAfterLoadStore = [&]() {
+        if (Quirks::LOAD_STORE_INCREMENT == IndexIncrement::ByXPlusOne) {
+            index.value += x + 1;
+        } else if (Quirks::LOAD_STORE_INCREMENT == IndexIncrement::ByX) {
+            index.value += x;
+        }
+        index.value &= 0xFFFF;
+    };
+
+    if ((op & 0xF000) == 0xA000) {
+        index.known = true;
+        index.relative = false;
+        index.value = op & 0x0FFF;
+    } else if (flow.length == 4) {
+        index.known = true;
+        index.relative = false;
+        index.value = rom.word(address + 2);
+    } else if (Quirks::XOCHIP_OPCODES && (op & 0xF00F) == 0x5002) {
+        store((x > y ? x - y : y - x) + 1);
+    } else if ((op & 0xF000) == 0xF000) {
+        switch (op & 0x00FF) {
+            case 0x1E:
+            case 0x29:
+            case 0x30:
+                index.known = false;  // Depends on a register
+                break;
+            case 0x33:
+                store(3);
+                break;
+            case 0x55:
+                store(x + 1);
+                advanceAfterLoadStore();
+                break;
+            case 0x65:
+                advanceAfterLoadStore();
+                break;
+        }
+    }
+}
+
+// Runs one block's instructions over an entry state, returns the exit state
+template <typename Quirks>
+static IndexTracker trackBlock(const RomView& rom, const BasicBlock& block, IndexTracker index,
+                               std::vector<StoreSite>* stores) {
+    for (uint32_t pc = block.start; pc < block.end; ) {
+        Flow flow = decodeFlow<Quirks>(rom, pc);
+        trackIndex<Quirks>(rom, pc, flow, index, stores);
+        pc += flow.length;
+    }
+    return index;
+}
+
+// ==================== ANALYSIS ====================
+
+template <typename Quirks>
+static ControlFlowGraph analyze(const uint8_t* bytes, std::size_t size) {
+    const uint32_t start = Chip8::ROM_START_ADDRESS;
+    const uint32_t limit = static_cast<uint32_t>(Quirks::MEMORY_SIZE);
+    const uint32_t clipped = static_cast<uint32_t>(std::min<std::size_t>(size, limit - start));
+    const RomView rom{bytes, start, start + clipped};
+
+    ControlFlowGraph cfg;
+    cfg.entry = static_cast<uint16_t>(start);
+    cfg.romEnd = rom.end;
+
+    // Per-address flags, indexed by address - start
+    std::vector<uint8_t> visited(clipped, 0);
+    std::vector<uint8_t> leader(clipped, 0);
+    std::vector<uint8_t> codeByte(clipped, 0);
+    std::vector<uint16_t> callTargets;
+    std::vector<uint32_t> work;
+
+    auto addLeader = [&](uint32_t address) {
+        if (!rom.contains(address, 2)) {
+            cfg.externalTargets.push_back(static_cast<uint16_t>(address));
+            return;
+        }
+        if (!leader[address - start]) {
+            leader[address - start] = 1;
+            work.push_back(address);
+        }
+    };
+
+    // PASS 1: find every reachable instruction and every block leader
+    addLeader(start);
+    while (!work.empty()) {
+        uint32_t address = work.back();
+        work.pop_back();
+
+        while (rom.contains(address, 2) && !visited[address - start]) {
+            visited[address - start] = 1;
+            Flow flow = decodeFlow<Quirks>(rom, address);
+            uint32_t next = address + flow.length;
+
+            if (flow.exit == BlockExit::Fallthrough) {
+                address = next;
+                if (!rom.contains(address, 2)) {
+                    cfg.externalTargets.push_back(static_cast<uint16_t>(address));
+                }
+                continue;
+            }
+
+            switch (flow.exit) {
+                case BlockExit::Jump:
+                    addLeader(flow.target);
+                    break;
+                case BlockExit::Call:
+                    addLeader(flow.target);
+                    callTargets.push_back(flow.target);
+                    addLeader(next);
+                    break;
+                case BlockExit::Skip:
+                    addLeader(next);
+                    addLeader(next + lengthAt<Quirks>(rom, next));
+                    break;
+                case BlockExit::Indirect:
+                    cfg.indirectJumps.push_back(static_cast<uint16_t>(address));
+                    break;
+                default:
+                    break;  // Return / exit: nothing follows statically
+            }
+            break;
+        }
+    }
+
+    // PASS 2: cut the code into blocks at the leaders
+    for (uint32_t address = start; address < rom.end; ++address) {
+        if (!leader[address - start]) {
+            continue;
+        }
+
+        BasicBlock block;
+        block.start = static_cast<uint16_t>(address);
+        block.exit = BlockExit::Fallthrough;
+        block.callTarget = 0;
+        block.selfModified = false;
+
+        uint32_t pc = address;
+        for (;;) {
+            Flow flow = decodeFlow<Quirks>(rom, pc);
+            uint32_t next = pc + flow.length;
+            for (uint32_t b = pc; b < next; ++b) {
+                codeByte[b - start] = 1;
+            }
+
+            block.exit = flow.exit;
+            if (flow.exit == BlockExit::Jump) {
+                block.successors.push_back(flow.target);
+            } else if (flow.exit == BlockExit::Call) {
+                block.callTarget = flow.target;
+                block.successors.push_back(static_cast<uint16_t>(next));
+            } else if (flow.exit == BlockExit::Skip) {
+                block.successors.push_back(static_cast<uint16_t>(next));
+                block.successors.push_back(static_cast<uint16_t>(next + lengthAt<Quirks>(rom, next)));
+            } else if (flow.exit == BlockExit::Fallthrough &&
+                       rom.contains(next, 2) && !leader[next - start]) {
+                pc = next;
+                continue;  // Still inside the block
+            } else if (flow.exit == BlockExit::Fallthrough) {
+                block.successors.push_back(static_cast<uint16_t>(next));
+            }
+            block.end = next;
+            break;
+        }
+        cfg.blocks.push_back(block);
+    }
+
+    // PASS 3: carry I across block edges until nothing changes.
+    // I is 0 after reset. A call's return address gets what the subroutine
+    // leaves in I: each subroutine is summarized first by running the same
+    // tracking from its entry with I relative to the entry value, and
+    // meeting I over every 00EE it reaches (calls inside it use the
+    // summaries so far, repeated until none changes; recursion included).
+    auto blockIndex = [&](uint16_t address) -> long {
+        const BasicBlock* block = cfg.findBlock(address);
+        return block ? block - cfg.blocks.data() : -1;
+    };
+    std::vector<IndexTracker> summaries(cfg.blocks.size());  // By the callee's block
+    auto summaryOf = [&](uint16_t callTarget) {
+        long t = blockIndex(callTarget);
+        return t < 0 ? UNKNOWN_INDEX : summaries[t];
+    };
+
+    // Fixed point from one block. With enterCalls, I also flows into the
+    // callees (the whole program); without, only within the subroutine.
+    // Returns I met over the returns reached.
+    std::vector<IndexTracker> entryIndex;
+    auto solve = [&](std::size_t first, const IndexTracker& state, bool enterCalls) {
+        entryIndex.assign(cfg.blocks.size(), IndexTracker{});
+        entryIndex[first] = state;
+        IndexTracker returned;
+        std::vector<std::size_t> pending{first};
+        std::vector<uint8_t> queued(cfg.blocks.size(), 0);
+        queued[first] = 1;
+
+        auto propagate = [&](uint16_t target, const IndexTracker& index) {
+            long t = blockIndex(target);
+            if (t < 0) {
+                returned = meet(returned, UNKNOWN_INDEX);  // Unanalyzed code may return with anything
+                return;
+            }
+            IndexTracker merged = meet(entryIndex[t], index);
+            if (!sameIndex(merged, entryIndex[t])) {
+                entryIndex[t] = merged;
+                if (!queued[t]) {
+                    queued[t] = 1;
+                    pending.push_back(static_cast<std::size_t>(t));
+                }
+            }
+        };
+        while (!pending.empty()) {
+            std::size_t b = pending.back();
+            pending.pop_back();
+            queued[b] = 0;
+            const BasicBlock& block = cfg.blocks[b];
+            IndexTracker exitIndex = trackBlock<Quirks>(rom, block, entryIndex[b], nullptr);
+
+            if (block.exit == BlockExit::Call) {
+                if (enterCalls) {
+                    propagate(block.callTarget, exitIndex);
+                }
+                IndexTracker afterReturn = afterCall(summaryOf(block.callTarget), exitIndex);
+                if (afterReturn.reached) {
+                    propagate(block.successors[0], afterReturn);
+                }
+            } else if (block.exit == BlockExit::Return) {
+                returned = meet(returned, exitIndex);
+            } else if (block.exit == BlockExit::Indirect) {
+                returned = meet(returned, UNKNOWN_INDEX);
+            } else {
+                for (uint16_t successor : block.successors) {
+                    propagate(successor, exitIndex);
+                }
+            }
+        }
+        return returned;
+    };
+
+    // Subroutines are re-solved only when a callee's summary changed
+    std::sort(callTargets.begin(), callTargets.end());
+    callTargets.erase(std::unique(callTargets.begin(), callTargets.end()), callTargets.end());
+    std::vector<std::vector<std::size_t>> callers(cfg.blocks.size());  // By the callee's block
+    std::vector<std::size_t> unsolved;
+    std::vector<uint8_t> listed(cfg.blocks.size(), 0);
+    for (uint16_t target : callTargets) {
+        long t = blockIndex(target);
+        if (t >= 0) {
+            unsolved.push_back(static_cast<std::size_t>(t));
+            listed[t] = 1;
+        }
+    }
+    while (!unsolved.empty()) {
+        std::size_t sub = unsolved.back();
+        unsolved.pop_back();
+        listed[sub] = 0;
+        IndexTracker summary = solve(sub, IndexTracker{true, true, true, 0}, false);
+        for (std::size_t b = 0; b < cfg.blocks.size(); ++b) {
+            long callee = cfg.blocks[b].exit == BlockExit::Call ? blockIndex(cfg.blocks[b].callTarget) : -1;
+            if (callee >= 0 && entryIndex[b].reached &&
+                std::find(callers[callee].begin(), callers[callee].end(), sub) == callers[callee].end()) {
+                callers[callee].push_back(sub);
+            }
+        }
+        if (!sameIndex(summary, summaries[sub])) {
+            summaries[sub] = summary;
+            for (std::size_t caller : callers[sub]) {
+                if (!listed[caller]) {
+                    listed[caller] = 1;
+                    unsolved.push_back(caller);
+                }
+            }
+        }
+    }
+    if (!cfg.blocks.empty()) {
+        solve(0, IndexTracker{true, true, false, 0}, true);
+    }
+
+    // PASS 4: record every store with the I known on its block's entry
+    for (std::size_t b = 0; b < cfg.blocks.size(); ++b) {
+        IndexTracker entry = entryIndex[b].reached ? entryIndex[b] : UNKNOWN_INDEX;
+        trackBlock<Quirks>(rom, cfg.blocks[b], entry, &cfg.stores);
+    }
+
+    // Blocks overlapped by a known store
+    for (BasicBlock& block : cfg.blocks) {
+        for (const StoreSite& store : cfg.stores) {
+            if (store.known && store.target.start < block.end && block.start < store.target.end) {
+                block.selfModified = true;
+                break;
+            }
+        }
+    }
+
+    // Data: ROM bytes that are not part of any reachable instruction
+    for (uint32_t address = start; address < rom.end; ) {
+        if (codeByte[address - start]) {
+            ++address;
+            continue;
+        }
+        MemoryRange range{address, address};
+        while (address < rom.end && !codeByte[address - start]) {
+            ++address;
+        }
+        range.end = address;
+        cfg.dataRegions.push_back(range);
+    }
+
+    // Call graph: blocks reachable from each entry without returning
+    std::vector<uint16_t> entries{static_cast<uint16_t>(start)};
+    for (uint16_t target : callTargets) {
+        if (target != start && rom.contains(target, 2)) {
+            entries.push_back(target);
+        }
+    }
+
+    std::vector<uint8_t> seen(clipped, 0);
+    for (uint16_t entry : entries) {
+        if (cfg.findBlock(entry) == nullptr) {
+            continue;  // Empty ROM
+        }
+        Subroutine routine;
+        routine.entry = entry;
+        std::fill(seen.begin(), seen.end(), 0);
+
+        std::vector<uint16_t> pending{entry};
+        seen[entry - start] = 1;
+        while (!pending.empty()) {
+            const BasicBlock* block = cfg.findBlock(pending.back());
+            pending.pop_back();
+            routine.blocks.push_back(block->start);
+            if (block->exit == BlockExit::Call) {
+                routine.callees.push_back(block->callTarget);
+            }
+            for (uint16_t successor : block->successors) {
+                if (rom.contains(successor, 2) && !seen[successor - start]) {
+                    seen[successor - start] = 1;
+                    pending.push_back(successor);
+                }
+            }
+        }
+
+        std::sort(routine.blocks.begin(), routine.blocks.end());
+        std::sort(routine.callees.begin(), routine.callees.end());
+        routine.callees.erase(std::unique(routine.callees.begin(), routine.callees.end()),
+                              routine.callees.end());
+        cfg.subroutines.push_back(std::move(routine));
+    }
+
+    std::sort(cfg.externalTargets.begin(), cfg.externalTargets.end());
+    cfg.externalTargets.erase(std::unique(cfg.externalTargets.begin(), cfg.externalTargets.end()),
+                              cfg.externalTargets.end());
+    std::sort(cfg.indirectJumps.begin(), cfg.indirectJumps.end());
+    return cfg;
+}
+
+ControlFlowGraph analyzeControlFlow(const uint8_t* rom, std::size_t size, QuirkProfile profile) {
+    switch (profile) {
+        case QuirkProfile::Chip48:    return analyze<Chip48Quirks>(rom, size);
+        case QuirkProfile::SuperChip: return analyze<SuperChipQuirks>(rom, size);
+        case QuirkProfile::XoChip:    return analyze<XoChipQuirks>(rom, size);
+        case QuirkProfile::Chip8:
+        default:                      return analyze<Chip8Quirks>(rom, size);
+    }
+}
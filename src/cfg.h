@@ -0,0 +1,110 @@
+#ifndef CFG_H
+#define CFG_H
+
+#include <cstddef>   // For std::size_t
+#include <cstdint>   // For fixed-width integer types
+#include <vector>    // For block and range lists
+#include "quirks.h"  // For QuirkProfile
+
+/*
+ * Static Control Flow Recovery
+ *
+ * Walks a ROM from ROM_START_ADDRESS without running it and splits the
+ * reachable code into BASIC BLOCKS: straight-line runs of instructions
+ * that are only entered at the top and only left at the bottom.
+ *
+ * WHAT ENDS A BLOCK?
+ *   1NNN        jump       one successor (NNN)
+ *   2NNN        call       successor = return address, NNN is a subroutine
+ *   00EE        return     no static successor
+ *   00FD        exit       no successor
+ *   BNNN        indirect   target depends on V0 (or VX), unknown statically
+ *   3XNN 4XNN 5XY0 9XY0 EX9E EXA1
+ *               skip       two successors (next and next-but-one)
+ * A block also ends right before any address something jumps to.
+ *
+ * Everything in the ROM that no path reaches as an instruction is DATA
+ * (sprites, tables, padding).
+ *
+ * SELF-MODIFYING CODE:
+ * Stores (FX33, FX55, 5XY2) write at I. I is tracked from "LD I, NNN"
+ * onwards across blocks and through calls (each subroutine is summarized
+ * by what it leaves in I), so many stores have a known target; if a known
+ * target overlaps code, that block is marked selfModified. Stores whose
+ * I is not known statically (after FX1E, where paths disagree...) are
+ * listed separately: their presence means self-modification can't be
+ * ruled out, they don't mean it happens.
+ *
+ * USES:
+ * - predecoding / ahead-of-time compilation (blocks are the unit)
+ * - knowing which bytes are data, so code caches can ignore writes there
+ * - finding ROMs that modify their own code before optimizing them
+ */
+
+enum class BlockExit {
+    Fallthrough,   // Next instruction starts another block (or leaves the ROM)
+    Jump,          // 1NNN
+    Call,          // 2NNN
+    Return,        // 00EE
+    Skip,          // Conditional skip
+    Indirect,      // BNNN
+    Exit           // 00FD
+};
+
+const char* blockExitName(BlockExit exit);
+
+// Half-open address range [start, end)
+struct MemoryRange {
+    uint32_t start;
+    uint32_t end;
+};
+
+struct BasicBlock {
+    uint16_t start;
+    uint32_t end;                      // One past the last instruction byte
+    BlockExit exit;
+    std::vector<uint16_t> successors;  // Static successors (a call's is its return address)
+    uint16_t callTarget;               // Subroutine entered by a Call exit
+    bool selfModified;                 // A known store overlaps this block
+};
+
+struct Subroutine {
+    uint16_t entry;                    // ROM_START_ADDRESS for the main program
+    std::vector<uint16_t> blocks;      // Block starts reachable without returning
+    std::vector<uint16_t> callees;     // Subroutines called from those blocks
+};
+
+struct StoreSite {
+    uint16_t pc;                       // Address of the store instruction
+    bool known;                        // Target known statically?
+    MemoryRange target;                // Only valid if known
+};
+
+struct ControlFlowGraph {
+    uint16_t entry;
+    uint32_t romEnd;                            // ROM_START_ADDRESS + ROM size
+    std::vector<BasicBlock> blocks;             // Sorted by start address
+    std::vector<Subroutine> subroutines;        // Main program first, then by entry
+    std::vector<MemoryRange> dataRegions;       // ROM bytes never reached as code
+    std::vector<uint16_t> indirectJumps;        // BNNN sites
+    std::vector<uint16_t> externalTargets;      // Jump/call/skip targets outside the ROM
+    std::vector<StoreSite> stores;              // Every reachable FX33/FX55/5XY2
+
+    // Block starting at address, or nullptr
+    const BasicBlock* findBlock(uint16_t address) const;
+
+    // True if no store could possibly target code (all known, none overlapping)
+    bool isFreeOfSelfModification() const;
+};
+
+/*
+ * Analyze a ROM image as loaded at ROM_START_ADDRESS
+ *
+ * @param rom:     ROM bytes
+ * @param size:    ROM size (clipped to the profile's memory)
+ * @param profile: Decides which opcodes exist, F000's length and how
+ *                 FX55 moves I
+ */
+ControlFlowGraph analyzeControlFlow(const uint8_t* rom, std::size_t size, QuirkProfile profile);
+
+#endif // CFG_H
@@ -1,17 +1,166 @@
 #include "chip8.h"
+#include "aot.h"        // For compiled ROMs
+#include "debugger.h"   // For the debug engines
+#include "trace.h"      // For traced cycles
 #include <fstream>      // For file I/O
 #include <iostream>     // For error messages
 #include <cstring>      // For memset
-#include <random>       // For RNG instruction
+#include <cstddef>      // For offsetof (layout checks)
+#include <algorithm>    // For std::min
+
+// SIMD intrinsics for the sprite kernel (see blitSpriteRows)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Returned for rows that do not exist (out of range, or absent planes)
+static constexpr uint64_t BLANK_ROW[Chip8::ROW_WORDS] = {};
 
 /*
  * CHIP-8 Constructor
  * 
- * Default constructor - actual initialization happens in initialize()
- * This is good practice: constructors should be lightweight
+ * Puts the machine in its power-on state (see reset()). It prints
+ * nothing: the core is also a library (libchip8.h), and the frontends
+ * print their own banners.
  */
 Chip8::Chip8() {
-    initialize();
+    // Hot state layout (see HOT STATE in chip8.h). Checked here because
+    // offsetof needs the complete class and access to private members.
+    static_assert(alignof(Chip8) == HOT_LINE, "Chip8 must start on a cache line");
+    static_assert(offsetof(Chip8, V) == 0, "V must open the hot line");
+    static_assert(offsetof(Chip8, soundTimer) < HOT_LINE, "hot state must fit in one cache line");
+    static_assert(offsetof(Chip8, stack) + sizeof(stack) <= HOT_LINE, "the stack must stay in the hot line");
+    static_assert(offsetof(Chip8, memory) == HOT_LINE, "bulky arrays go after the hot line");
+    
+    rplFlags.fill(0);  // Persistent flags start cleared once, not on reset
+    extraPlaneHash = 0;
+    displayHashStale = false;
+    planeMask = 1;
+    debugger = nullptr;
+    tracer = nullptr;
+    compiledRom = nullptr;
+    compiledRomsEnabled = true;
+    setQuirkProfile(QuirkProfile::Chip8);  // Original behaviour by default
+    reset();
+}
+
+/*
+ * Select Quirk Profile
+ * 
+ * Points the engine pointers at the interpreter instantiation for the
+ * profile. Taking the address of cycle<Chip48Quirks> etc. is also what
+ * makes the compiler generate those instantiations (one per profile).
+ * 
+ * Only behaviour changes; machine state (memory, registers) is kept,
+ * so this can be called before or after loadROM(). Entering or leaving
+ * XO-CHIP moves the low 4KB between the inline array and the 64KB buffer
+ * and allocates or frees the extra bitplanes.
+ */
+void Chip8::setQuirkProfile(QuirkProfile profile) {
+    quirkProfile = profile;
+    
+    // Compiled code only matches the profile it was generated for
+    if (compiledRom != nullptr && compiledRom->profile != profile) {
+        compiledRom = nullptr;
+        compiledEntry.clear();
+    }
+    
+    bool wasExtended = !extendedMemory.empty();
+    bool extended = (profile == QuirkProfile::XoChip);
+    if (extended && !wasExtended) {
+        extendedMemory.assign(XO_MEMORY_SIZE + MEMORY_GUARD, 0);
+        std::copy(memory.begin(), memory.begin() + MEMORY_SIZE, extendedMemory.begin());
+        extraPlanes.assign((PLANE_COUNT - 1) * PLANE_WORDS, 0);
+        extraPlaneHash = 0;
+        // Same bytes, but the 4KB guard bytes stayed behind
+        memoryHash ^= hashMemoryRange(memory.data(), MEMORY_SIZE, MEMORY_GUARD);
+    } else if (!extended && wasExtended) {
+        std::copy(extendedMemory.begin(), extendedMemory.begin() + MEMORY_SIZE, memory.begin());
+        std::vector<uint8_t>().swap(extendedMemory);   // Release the 64KB
+        std::vector<uint64_t>().swap(extraPlanes);
+        extraPlaneHash = 0;
+        planeMask = 1;
+        dirtyRows = ALL_ROWS_DIRTY;
+        drawFlag = true;
+        rehashMemory();   // Everything above 4KB is gone: one 4KB scan
+    }
+    
+    selectEnginesForProfile();
+}
+
+void Chip8::selectEnginesForProfile() {
+    switch (quirkProfile) {
+        case QuirkProfile::Chip48:    selectEngines<Chip48Quirks>();    break;
+        case QuirkProfile::SuperChip: selectEngines<SuperChipQuirks>(); break;
+        case QuirkProfile::XoChip:    selectEngines<XoChipQuirks>();    break;
+        case QuirkProfile::Chip8:
+        default:                      selectEngines<Chip8Quirks>();     break;
+    }
+}
+
+/*
+ * Select Engines
+ * 
+ * Each profile has three engine pairs:
+ * - release:  cycle / runCyclesFor, exactly the interpreter, nothing else
+ * - debug:    debugCycle / runDebugCyclesFor, which ask the debugger
+ *             before every instruction and feed the tracer after it
+ * - compiled: compiledCycle / runCompiledFor, for ROMs with built-in
+ *             compiled code (see aot.h)
+ * The choice is made here, once, so the release loop has no
+ * "is a debugger or tracer attached?" branch. Debugging wins over
+ * compiled code: breakpoints need to see every instruction.
+ */
+template <typename Quirks>
+void Chip8::selectEngines() {
+    if (debugger != nullptr || tracer != nullptr) {
+        cycleEngine = &Chip8::debugCycle<Quirks>;
+        runEngine = &Chip8::runDebugCyclesFor<Quirks>;
+    } else if (compiledRom != nullptr) {
+        cycleEngine = &Chip8::compiledCycle<Quirks>;
+        runEngine = &Chip8::runCompiledFor<Quirks>;
+    } else {
+        cycleEngine = &Chip8::cycle<Quirks>;
+        runEngine = &Chip8::runCyclesFor<Quirks>;
+    }
+}
+
+/*
+ * Attach Debugger
+ * 
+ * @param debugger: Debugger to consult, or nullptr for full-speed runs
+ * 
+ * The debugger is not owned and must outlive the attachment.
+ */
+void Chip8::attachDebugger(Debugger* newDebugger) {
+    debugger = newDebugger;
+    setQuirkProfile(quirkProfile);  // Re-pick the engines for this profile
+}
+
+/*
+ * Attach Tracer
+ * 
+ * @param tracer: Open TraceWriter, or nullptr to stop tracing
+ * 
+ * Not owned, like the debugger.
+ */
+void Chip8::attachTracer(TraceWriter* newTracer) {
+    tracer = newTracer;
+    setQuirkProfile(quirkProfile);
+}
+
+/*
+ * Seed the Random Number Generator
+ * 
+ * @param seed: Any value; 0 is replaced by the default seed because
+ *              xorshift can never leave the all-zero state
+ */
+void Chip8::seedRandom(uint32_t seed) {
+    rngState = (seed != 0) ? seed : DEFAULT_RNG_SEED;
 }
 
 /*
@@ -23,8 +172,11 @@ Chip8::Chip8() {
  * 3. Load font data into memory
  * 4. Set PC to ROM start address
  * 5. Clear display, stack, and input states
+ * 
+ * The SUPER-CHIP RPL flags (FX75/FX85) are deliberately kept, since
+ * games use them to remember high scores across restarts.
  */
-void Chip8::initialize() {
+void Chip8::reset() {
     // Set program counter to start of ROM area
     // WHY 0x200? The first 512 bytes (0x000-0x1FF) were reserved
     // for the CHIP-8 interpreter on original systems
@@ -39,10 +191,11 @@ void Chip8::initialize() {
     // Reset stack pointer
     sp = 0;
     
-    // Clear display
-    // std::array's fill() is safer than memset for C++ types
-    display.fill(0);
-    drawFlag = true;  // Draw the cleared screen
+    // Clear display and return to the standard 64x32 mode
+    highResolution = false;
+    exited = false;
+    planeMask = 1;  // XO-CHIP: draw to plane 0 only
+    clearDisplay();
     
     // Clear stack
     stack.fill(0);
@@ -57,15 +210,43 @@ void Chip8::initialize() {
     // WHY std::copy? It's type-safe and works with iterators
     // Could also use: std::memcpy(memory.data(), fontset.data(), FONTSET_SIZE);
     std::copy(fontset.begin(), fontset.end(), memory.begin());
+    std::copy(bigFontset.begin(), bigFontset.end(), memory.begin() + BIG_FONT_ADDRESS);
+    
+    // XO-CHIP: the 64KB buffer starts as a copy of the freshly reset 4KB
+    if (!extendedMemory.empty()) {
+        std::fill(extendedMemory.begin(), extendedMemory.end(), 0);
+        std::copy(memory.begin(), memory.begin() + MEMORY_SIZE, extendedMemory.begin());
+    }
+    constexpr uint64_t RESET_MEMORY_HASH = resetMemoryHash();  // No scan, for either size
+    memoryHash = RESET_MEMORY_HASH;
+    
+    // Reset XO-CHIP audio (silent pattern, 4000Hz)
+    audioPattern.fill(0);
+    audioPitch = DEFAULT_AUDIO_PITCH;
+    audioPatternLoaded = false;
     
     // Reset timers
     delayTimer = 0;
     soundTimer = 0;
     
+    // Reset random numbers (same seed = same run)
+    rngState = DEFAULT_RNG_SEED;
+    
     // Clear key states
-    keys.fill(false);
+    keys = 0;
+    waitingForKey = false;
+    waitRegister = 0;
+    waitKey = NO_KEY;
     
-    std::cout << "[CHIP-8] System initialized\n";
+    unknownOpcodeCount = 0;
+    lastUnknownOpcode = 0;
+    
+    // Memory was cleared: any compiled code no longer matches it
+    if (compiledRom != nullptr) {
+        compiledRom = nullptr;
+        compiledEntry.clear();
+        selectEnginesForProfile();
+    }
 }
 
 /*
@@ -74,10 +255,13 @@ void Chip8::initialize() {
  * CHIP-8 ROMs are loaded starting at address 0x200
  * 
  * @param filename: Path to the .ch8 ROM file
- * @return: true if successful, false on error
+ * @return: true if successful, false if the file cannot be read or does
+ *          not fit (it prints nothing: loadROMFile() in report.h is the
+ *          same load with the usual console messages)
  * 
  * ROM SIZE LIMITS:
  * - Memory: 0x200 to 0xFFF = 3584 bytes available
+ * - XO-CHIP: 0x200 to 0xFFFF = 65024 bytes available
  * - Most ROMs are much smaller (typically 1-2KB)
  */
 bool Chip8::loadROM(const std::string& filename) {
@@ -85,7 +269,6 @@ bool Chip8::loadROM(const std::string& filename) {
     std::ifstream file(filename, std::ios::binary | std::ios::ate);
     
     if (!file.is_open()) {
-        std::cerr << "[ERROR] Failed to open ROM: " << filename << "\n";
         return false;
     }
     
@@ -95,10 +278,8 @@ bool Chip8::loadROM(const std::string& filename) {
     
     // Check if ROM fits in available memory
     // Memory from 0x200 to 0xFFF = 4096 - 512 = 3584 bytes
-    if (size > (MEMORY_SIZE - ROM_START_ADDRESS)) {
-        std::cerr << "[ERROR] ROM too large: " << size << " bytes\n";
-        std::cerr << "[ERROR] Maximum size: " << (MEMORY_SIZE - ROM_START_ADDRESS) << " bytes\n";
-        file.close();
+    std::streamsize capacity = static_cast<std::streamsize>(activeMemorySize()) - ROM_START_ADDRESS;
+    if (size < 0 || size > capacity) {
         return false;
     }
     
@@ -108,16 +289,249 @@ bool Chip8::loadROM(const std::string& filename) {
     // Read file directly into memory starting at 0x200
     // WHY reinterpret_cast<char*>? read() expects char*, but we have uint8_t*
     // This is safe because uint8_t and unsigned char are guaranteed to have same size
-    file.read(reinterpret_cast<char*>(&memory[ROM_START_ADDRESS]), size);
+    const std::size_t romSize = static_cast<std::size_t>(size);
+    memoryHash ^= hashMemoryRange(activeMemory(), ROM_START_ADDRESS, romSize);  // Old bytes out
+    file.read(reinterpret_cast<char*>(activeMemory() + ROM_START_ADDRESS), size);
+    memoryHash ^= hashMemoryRange(activeMemory(), ROM_START_ADDRESS, romSize);  // New bytes in
     
     file.close();
     
-    std::cout << "[CHIP-8] Loaded ROM: " << filename << "\n";
-    std::cout << "[CHIP-8] ROM size: " << size << " bytes\n";
+    attachCompiledRom(romSize);
+    return true;
+}
+
+/*
+ * Load a ROM from a memory buffer
+ * 
+ * Same as loading from a file, but for ROMs that are already in memory
+ * (benchmark workloads, embedding, fuzzing).
+ * 
+ * @param data: ROM bytes
+ * @param size: Number of bytes
+ * @return: true if successful, false if the ROM does not fit
+ */
+bool Chip8::loadROM(const uint8_t* data, std::size_t size) {
+    if (size > activeMemorySize() - ROM_START_ADDRESS) {
+        return false;
+    }
     
+    memoryHash ^= hashMemoryRange(activeMemory(), ROM_START_ADDRESS, size);  // Old bytes out
+    std::copy(data, data + size, activeMemory() + ROM_START_ADDRESS);
+    memoryHash ^= hashMemoryRange(activeMemory(), ROM_START_ADDRESS, size);  // New bytes in
+    attachCompiledRom(size);
     return true;
 }
 
+/*
+ * Attach Compiled ROM
+ * 
+ * Looks the ROM just loaded up in the compiled ROM registry (by content
+ * hash, size and profile) and switches engines accordingly. Without any
+ * compiled ROMs built in this is one empty-vector check.
+ */
+void Chip8::attachCompiledRom(std::size_t romSize) {
+    const CompiledRom* found = nullptr;
+    if (compiledRomsEnabled && hasCompiledRoms()) {
+        const uint8_t* rom = activeMemory() + ROM_START_ADDRESS;
+        found = findCompiledRom(hashBytes(rom, romSize), romSize, quirkProfile);
+    }
+    if (found == nullptr && compiledRom == nullptr) {
+        return;  // Nothing to switch
+    }
+    
+    compiledRom = found;
+    compiledEntry.clear();
+    if (compiledRom != nullptr) {
+        compiledEntry.assign(activeMemorySize(), nullptr);
+        mapCompiledBlocks();
+    }
+    selectEnginesForProfile();
+}
+
+/*
+ * Reattach Compiled ROM
+ * 
+ * A loaded state may have different code than the machine had before:
+ * an older rollback snapshot from before a block was overwritten, or a
+ * state from another machine (the explorer's workers, VecEnv's envs).
+ * The compiled ROM stays attached and every block is checked against
+ * the ROM image again. A machine with no compiled ROM yet looks for one
+ * whose whole image is in memory, like loadROM() would have found it.
+ * With no compiled ROMs built in this is one empty-vector check.
+ */
+void Chip8::reattachCompiledRom() {
+    if (compiledRom == nullptr) {
+        if (!compiledRomsEnabled || !hasCompiledRoms()) {
+            return;
+        }
+        compiledRom = findCompiledRomIn(activeMemory() + ROM_START_ADDRESS,
+                                        activeMemorySize() - ROM_START_ADDRESS, quirkProfile);
+        if (compiledRom == nullptr) {
+            return;
+        }
+        compiledEntry.assign(activeMemorySize(), nullptr);
+    }
+    
+    if (mapCompiledBlocks() == 0) {
+        compiledRom = nullptr;   // Some other program: nothing left to run compiled
+        compiledEntry.clear();
+    }
+    selectEnginesForProfile();
+}
+
+/*
+ * Map Compiled Blocks
+ * 
+ * Points compiledEntry at every block whose bytes in memory still equal
+ * the ROM image, and clears the entries of every other block (the
+ * interpreter runs those). Only block ranges are touched: the cost is
+ * one compare of the compiled code, not of the whole memory.
+ * 
+ * @return: number of blocks mapped
+ */
+std::size_t Chip8::mapCompiledBlocks() {
+    const uint8_t* ram = activeMemory();
+    const uint32_t romEnd = ROM_START_ADDRESS + compiledRom->romSize;
+    std::size_t mapped = 0;
+    
+    for (std::size_t b = 0; b < compiledRom->blockCount; ++b) {
+        const CompiledBlock& block = compiledRom->blocks[b];
+        for (uint32_t a = block.start; a < block.end && a < compiledEntry.size(); ++a) {
+            compiledEntry[a] = nullptr;
+        }
+    }
+    for (std::size_t b = 0; b < compiledRom->blockCount; ++b) {
+        const CompiledBlock& block = compiledRom->blocks[b];
+        if (block.start < ROM_START_ADDRESS || block.end > romEnd ||
+            std::memcmp(ram + block.start, compiledRom->image + (block.start - ROM_START_ADDRESS),
+                        block.end - block.start) != 0) {
+            continue;   // Overwritten (or not in the ROM at all): interpret
+        }
+        for (uint32_t a = block.start; a < block.end && a < compiledEntry.size(); ++a) {
+            compiledEntry[a] = &block;
+        }
+        ++mapped;
+    }
+    return mapped;
+}
+
+/*
+ * Check Code Write
+ * 
+ * @param storeOpcode: Instruction that just ran
+ * @param index: I before it ran (FX55 may have moved I since)
+ * @return: true if it was a store that overwrote compiled code
+ * 
+ * Every block the store touched is dropped from compiledEntry, so the
+ * interpreter runs that code (as modified) from now on.
+ */
+bool Chip8::checkCodeWrite(uint16_t storeOpcode, uint16_t index) {
+    uint32_t length;
+    if ((storeOpcode & 0xF0FF) == 0xF033) {
+        length = 3;
+    } else if ((storeOpcode & 0xF0FF) == 0xF055) {
+        length = ((storeOpcode >> 8) & 0xF) + 1;
+    } else if (quirkProfile == QuirkProfile::XoChip && (storeOpcode & 0xF00F) == 0x5002) {
+        int x = (storeOpcode >> 8) & 0xF;
+        int y = (storeOpcode >> 4) & 0xF;
+        length = static_cast<uint32_t>(x > y ? x - y : y - x) + 1;
+    } else {
+        return false;
+    }
+    
+    index &= static_cast<uint16_t>(activeMemorySize() - 1);  // Where the store really went
+    bool hit = false;
+    for (uint32_t a = index; a < index + length && a < compiledEntry.size(); ++a) {
+        const CompiledBlock* block = compiledEntry[a];
+        if (block == nullptr) {
+            continue;
+        }
+        for (uint32_t b = block->start; b < block->end && b < compiledEntry.size(); ++b) {
+            if (compiledEntry[b] == block) {
+                compiledEntry[b] = nullptr;
+            }
+        }
+        hit = true;
+    }
+    return hit;
+}
+
+/*
+ * Active Memory
+ * 
+ * The 64KB XO-CHIP buffer while that profile is selected, otherwise the
+ * inline 4KB array. Only used outside the interpreter loop (ROM loading);
+ * the interpreter uses ramFor<Quirks>(), which is decided at compile time.
+ */
+uint8_t* Chip8::activeMemory() {
+    return extendedMemory.empty() ? memory.data() : extendedMemory.data();
+}
+
+const uint8_t* Chip8::activeMemory() const {
+    return extendedMemory.empty() ? memory.data() : extendedMemory.data();
+}
+
+/*
+ * Read Memory / Peek Opcode
+ * 
+ * Inspection helpers: read without side effects. Addresses beyond the
+ * active memory read as 0.
+ */
+uint8_t Chip8::readMemory(uint16_t address) const {
+    if (address >= activeMemorySize()) {
+        return 0;
+    }
+    return activeMemory()[address];
+}
+
+uint16_t Chip8::peekOpcode() const {
+    // Same addressing as the fetch: masked PC, second byte may be a guard byte
+    const uint8_t* ram = activeMemory();
+    const std::size_t at = pc & (activeMemorySize() - 1);
+    return static_cast<uint16_t>((ram[at] << 8) | ram[at + 1]);
+}
+
+std::size_t Chip8::activeMemorySize() const {
+    return extendedMemory.empty() ? MEMORY_SIZE : XO_MEMORY_SIZE;
+}
+
+/*
+ * Hash Memory Range
+ * 
+ * XOR of memoryByteHash() over ram[start, start + size). Zero bytes
+ * contribute nothing, so the scan tests 8 bytes at a time and only mixes
+ * the words that have a non-zero byte: mostly empty memory is cheap.
+ */
+uint64_t Chip8::hashMemoryRange(const uint8_t* ram, std::size_t start, std::size_t size) {
+    uint64_t h = 0;
+    const std::size_t end = start + size;
+    for (std::size_t i = start; i < end; i += sizeof(uint64_t)) {
+        const std::size_t chunk = std::min(sizeof(uint64_t), end - i);
+        uint64_t word = 0;
+        std::memcpy(&word, ram + i, chunk);
+        if (word == 0) {
+            continue;
+        }
+        for (std::size_t b = i; b < i + chunk; ++b) {
+            h ^= memoryByteHash(b, ram[b]);
+        }
+    }
+    return h;
+}
+
+/*
+ * Rehash Memory
+ * 
+ * Recomputes memoryHash from scratch. Only needed when the memory is
+ * swapped wholesale (leaving XO-CHIP keeps the low 4KB); reset() uses
+ * the precomputed reset hash, loadROM() swaps only the bytes it writes,
+ * guest stores go through storeByte() and loadState() restores the
+ * saved hash.
+ */
+void Chip8::rehashMemory() {
+    memoryHash = hashMemoryRange(activeMemory(), 0, activeMemorySize() + MEMORY_GUARD);
+}
+
 /*
  * Emulate One CPU Cycle
  * 
@@ -130,6 +544,169 @@ bool Chip8::loadROM(const std::string& filename) {
  * Modern emulators often run much faster or use configurable speed
  */
 void Chip8::emulateCycle() {
+    if (waitingForKey) {
+        return;  // FX0A: blocked until setKey() reports a release
+    }
+    (this->*cycleEngine)();  // cycle<Quirks>() for the selected profile
+}
+
+/*
+ * Run Many Cycles
+ * 
+ * @param count: Number of instructions to execute
+ * @return: Number of instructions executed
+ * 
+ * Prefer this over calling emulateCycle() in a loop: the profile's
+ * engine is selected once for the whole batch, and the inner loop calls
+ * cycle<Quirks>() directly so the compiler can inline it.
+ * 
+ * The batch stops early when FX0A starts waiting for a key: the return
+ * value is then smaller than count and isWaitingForKey() is true.
+ * Calling it again while waiting returns 0 without doing anything.
+ */
+uint32_t Chip8::runCycles(uint32_t count) {
+    if (waitingForKey) {
+        return 0;
+    }
+    return (this->*runEngine)(count);
+}
+
+template <typename Quirks>
+uint32_t Chip8::runCyclesFor(uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        cycle<Quirks>();
+        if (waitingForKey) {
+            return i + 1;  // FX0A: nothing more can happen until a key
+        }
+    }
+    return count;
+}
+
+/*
+ * Debug Engines
+ * 
+ * Same loop as runCyclesFor/cycle, plus one debugger check before each
+ * instruction and one trace record after it. When the debugger reports
+ * a break the instruction is NOT executed, so the machine state shown is
+ * the state at the breakpoint. Either attachment may be nullptr.
+ * 
+ * @return: Instructions executed (less than count after a break)
+ */
+template <typename Quirks>
+uint32_t Chip8::runDebugCyclesFor(uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        if (debugger != nullptr && debugger->check(*this)) {
+            return i;
+        }
+        tracedCycle<Quirks>();
+        if (waitingForKey) {
+            return i + 1;
+        }
+    }
+    return count;
+}
+
+template <typename Quirks>
+void Chip8::debugCycle() {
+    if (debugger == nullptr || !debugger->check(*this)) {
+        tracedCycle<Quirks>();
+    }
+}
+
+/*
+ * Compiled Engines
+ * 
+ * Run compiled blocks where the PC has one, the interpreter everywhere
+ * else. Blocks are given the remaining budget, so runCycles() executes
+ * exactly as many instructions as with the interpreter. Every
+ * interpreted instruction is checked for stores into compiled code.
+ */
+template <typename Quirks>
+uint32_t Chip8::runCompiledFor(uint32_t count) {
+    uint32_t done = 0;
+    while (done < count) {
+        const CompiledBlock* block = (pc < compiledEntry.size()) ? compiledEntry[pc] : nullptr;
+        uint32_t executed = (block != nullptr) ? block->run(*this, count - done) : 0;
+        if (executed == 0) {
+            compiledCycle<Quirks>();
+            executed = 1;
+        }
+        done += executed;
+        if (waitingForKey) {
+            break;
+        }
+    }
+    return done;
+}
+
+template <typename Quirks>
+void Chip8::compiledCycle() {
+    const uint16_t index = I;
+    cycle<Quirks>();
+    checkCodeWrite(opcode, index);
+}
+
+/*
+ * Interpreter Entry for Compiled Blocks
+ * 
+ * Explicitly instantiated below for every profile, because the generated
+ * files can't see executeOpcode's definition.
+ */
+template <typename Quirks>
+bool CompiledRomAccess::interpret(Chip8& c, uint16_t opcode) {
+    const uint16_t index = c.I;
+    c.opcode = opcode;
+    c.executeOpcode<Quirks>();
+    return c.checkCodeWrite(opcode, index) || c.waitingForKey;
+}
+
+template bool CompiledRomAccess::interpret<Chip8Quirks>(Chip8&, uint16_t);
+template bool CompiledRomAccess::interpret<Chip48Quirks>(Chip8&, uint16_t);
+template bool CompiledRomAccess::interpret<SuperChipQuirks>(Chip8&, uint16_t);
+template bool CompiledRomAccess::interpret<XoChipQuirks>(Chip8&, uint16_t);
+
+/*
+ * Traced Cycle
+ * 
+ * Runs one instruction and records which register it changed. Comparing
+ * a register snapshot is cheaper than teaching every opcode to report
+ * its writes, and keeps executeOpcode identical for all engines.
+ * VX is found before VF (V is scanned in order and VF is last), so
+ * "ADD V3, V4" records V3 even though VF changed too.
+ */
+template <typename Quirks>
+void Chip8::tracedCycle() {
+    if (tracer == nullptr) {
+        cycle<Quirks>();
+        return;
+    }
+
+    const uint16_t startPC = pc;
+    const std::array<uint8_t, REGISTER_COUNT> before = V;
+    const uint16_t beforeI = I;
+    cycle<Quirks>();
+
+    uint8_t reg = TRACE_NO_REGISTER;
+    uint16_t value = 0;
+    for (uint8_t r = 0; r < REGISTER_COUNT; ++r) {
+        if (V[r] != before[r]) {
+            reg = r;
+            value = V[r];
+            break;
+        }
+    }
+    if (reg == TRACE_NO_REGISTER && I != beforeI) {
+        reg = TRACE_REGISTER_I;
+        value = I;
+    }
+    tracer->record(startPC, opcode, reg, value);
+}
+
+/*
+ * One Fetch-Decode-Execute Cycle for a Given Quirk Profile
+ */
+template <typename Quirks>
+void Chip8::cycle() {
     // FETCH: Get the opcode
     // CHIP-8 opcodes are 2 bytes, stored big-endian
     // 
@@ -148,10 +725,17 @@ void Chip8::emulateCycle() {
     // 
     // WHY << 8? Shifts bits left by 8 positions, moving byte to high position
     // WHY |? Combines the two bytes without affecting existing bits
-    opcode = (memory[pc] << 8) | memory[pc + 1];
+    // 
+    // ramFor<Quirks>() is the inline 4KB array for every profile except
+    // XO-CHIP, chosen at compile time (no extra indirection per fetch).
+    // The PC is masked, so a PC past 0xFFF wraps instead of reading past
+    // the array (pc + 1 may land in the guard bytes)
+    const uint8_t* ram = ramFor<Quirks>();
+    const uint16_t at = pc & addressMask<Quirks>();
+    opcode = (ram[at] << 8) | ram[at + 1];
     
     // DECODE & EXECUTE: Process the opcode
-    executeOpcode();
+    executeOpcode<Quirks>();
     
     // Note: PC increment is handled by executeOpcode() because
     // some instructions (jumps, calls) modify PC directly
@@ -192,7 +776,13 @@ void Chip8::emulateCycle() {
  * 
  * Extract NNN (last 12 bits):
  *   opcode & 0x0FFF = 0x6A15 & 0x0FFF = 0x0A15
+ * 
+ * QUIRKS:
+ * Instructions that behave differently between CHIP-8 variants test
+ * Quirks::SOMETHING, a compile-time constant (see quirks.h). Each
+ * profile gets its own copy of this function with those tests resolved.
  */
+template <typename Quirks>
 void Chip8::executeOpcode() {
     // Extract common operands used by many instructions
     // These are calculated once here to avoid repetition
@@ -212,26 +802,72 @@ void Chip8::executeOpcode() {
     // NNN: Last 12 bits, memory address
     uint16_t NNN = opcode & 0x0FFF;
     
+    // Memory for this profile (4KB array, or 64KB for XO-CHIP)
+    uint8_t* ram = ramFor<Quirks>();
+    
     // Decode based on first nibble
     // We'll use a switch statement for clarity and efficiency
     switch (opcode & 0xF000) {
         case 0x0000:
             // Multiple opcodes start with 0x0
+            if (Quirks::SUPERCHIP_OPCODES && (NN & 0xF0) == 0xC0) {
+                scrollDown(N);  // 00CN: Scroll display N rows down
+                pc += 2;
+                break;
+            }
+            if (Quirks::XOCHIP_OPCODES && (NN & 0xF0) == 0xD0) {
+                scrollUp(N);    // 00DN: Scroll display N rows up (XO-CHIP)
+                pc += 2;
+                break;
+            }
             switch (NN) {
-                case 0x00E0:  // 00E0: Clear screen
-                    display.fill(0);
-                    drawFlag = true;
+                case 0x00E0:  // 00E0: Clear screen (selected planes)
+                    clearPlanes(planeMask);
                     pc += 2;
                     break;
                     
                 case 0x00EE:  // 00EE: Return from subroutine
                     --sp;  // Decrement stack pointer
-                    pc = stack[sp];  // Get return address
+                    pc = stack[sp & STACK_MASK];  // Get return address (ring, never out of range)
                     pc += 2;  // Move past the CALL instruction
                     break;
                     
+                case 0x00FB:  // 00FB: Scroll right 4 pixels (SUPER-CHIP)
+                case 0x00FC:  // 00FC: Scroll left 4 pixels (SUPER-CHIP)
+                    if (Quirks::SUPERCHIP_OPCODES) {
+                        if (NN == 0xFB) {
+                            scrollRight(4);
+                        } else {
+                            scrollLeft(4);
+                        }
+                    } else {
+                        countUnknownOpcode();  // Not in this profile
+                    }
+                    pc += 2;
+                    break;
+                    
+                case 0x00FD:  // 00FD: Exit interpreter (SUPER-CHIP)
+                    // PC stays on this instruction: the machine halts here
+                    if (Quirks::SUPERCHIP_OPCODES) {
+                        exited = true;
+                    } else {
+                        countUnknownOpcode();
+                        pc += 2;
+                    }
+                    break;
+                    
+                case 0x00FE:  // 00FE: 64x32 mode (SUPER-CHIP)
+                case 0x00FF:  // 00FF: 128x64 mode (SUPER-CHIP)
+                    if (Quirks::SUPERCHIP_OPCODES) {
+                        setHighResolution(NN == 0xFF);
+                    } else {
+                        countUnknownOpcode();
+                    }
+                    pc += 2;
+                    break;
+                    
                 default:
-                    std::cerr << "[ERROR] Unknown opcode: 0x" << std::hex << opcode << "\n";
+                    countUnknownOpcode();
                     pc += 2;
             }
             break;
@@ -241,21 +877,38 @@ void Chip8::executeOpcode() {
             break;
             
         case 0x2000:  // 2NNN: Call subroutine at NNN
-            stack[sp] = pc;  // Store current PC
+            stack[sp & STACK_MASK] = pc;  // Store current PC
             ++sp;  // Increment stack pointer
             pc = NNN;  // Jump to subroutine
             break;
             
         case 0x3000:  // 3XNN: Skip next instruction if VX == NN
-            pc += (V[X] == NN) ? 4 : 2;
+            pc += (V[X] == NN) ? skipLength<Quirks>() : 2;
             break;
             
         case 0x4000:  // 4XNN: Skip next instruction if VX != NN
-            pc += (V[X] != NN) ? 4 : 2;
+            pc += (V[X] != NN) ? skipLength<Quirks>() : 2;
             break;
             
-        case 0x5000:  // 5XY0: Skip next instruction if VX == VY
-            pc += (V[X] == V[Y]) ? 4 : 2;
+        case 0x5000:
+            if (Quirks::XOCHIP_OPCODES && (N == 0x2 || N == 0x3)) {
+                // 5XY2: Save VX..VY to memory[I..] / 5XY3: Load VX..VY
+                // The range may run downwards (X > Y); I is not changed
+                int step = (X <= Y) ? 1 : -1;
+                int count = (X <= Y) ? Y - X + 1 : X - Y + 1;
+                const uint16_t base = I & addressMask<Quirks>();
+                for (int i = 0; i < count; ++i) {
+                    int r = X + i * step;
+                    if (N == 0x2) {
+                        storeByte(ram, base + i, V[r]);
+                    } else {
+                        V[r] = ram[base + i];
+                    }
+                }
+                pc += 2;
+            } else {  // 5XY0: Skip next instruction if VX == VY
+                pc += (V[X] == V[Y]) ? skipLength<Quirks>() : 2;
+            }
             break;
             
         case 0x6000:  // 6XNN: Set VX to NN
@@ -270,14 +923,71 @@ void Chip8::executeOpcode() {
             
         case 0x8000:
             // Arithmetic and logic operations (8XYN family)
-            // We'll implement these in the next phase
-            // Placeholder for now:
-            std::cerr << "[TODO] Implement 0x8XYN opcodes\n";
+            // The flag is written LAST, so if X is F the flag wins
+            switch (N) {
+                case 0x0:  // 8XY0: VX = VY
+                    V[X] = V[Y];
+                    break;
+                    
+                case 0x1:  // 8XY1: VX |= VY
+                    V[X] |= V[Y];
+                    if (Quirks::LOGIC_RESETS_VF) V[0xF] = 0;
+                    break;
+                    
+                case 0x2:  // 8XY2: VX &= VY
+                    V[X] &= V[Y];
+                    if (Quirks::LOGIC_RESETS_VF) V[0xF] = 0;
+                    break;
+                    
+                case 0x3:  // 8XY3: VX ^= VY
+                    V[X] ^= V[Y];
+                    if (Quirks::LOGIC_RESETS_VF) V[0xF] = 0;
+                    break;
+                    
+                case 0x4: {  // 8XY4: VX += VY, VF = carry
+                    // Add in 16 bits so the 9th bit (carry) survives
+                    uint16_t sum = V[X] + V[Y];
+                    V[X] = static_cast<uint8_t>(sum);
+                    V[0xF] = sum > 0xFF ? 1 : 0;
+                    break;
+                }
+                    
+                case 0x5: {  // 8XY5: VX -= VY, VF = NOT borrow
+                    uint8_t noBorrow = V[X] >= V[Y] ? 1 : 0;
+                    V[X] -= V[Y];
+                    V[0xF] = noBorrow;
+                    break;
+                }
+                    
+                case 0x6: {  // 8XY6: Shift right, VF = bit shifted out
+                    uint8_t source = Quirks::SHIFT_USES_VY ? V[Y] : V[X];
+                    V[X] = source >> 1;
+                    V[0xF] = source & 0x01;
+                    break;
+                }
+                    
+                case 0x7: {  // 8XY7: VX = VY - VX, VF = NOT borrow
+                    uint8_t noBorrow = V[Y] >= V[X] ? 1 : 0;
+                    V[X] = V[Y] - V[X];
+                    V[0xF] = noBorrow;
+                    break;
+                }
+                    
+                case 0xE: {  // 8XYE: Shift left, VF = bit shifted out
+                    uint8_t source = Quirks::SHIFT_USES_VY ? V[Y] : V[X];
+                    V[X] = static_cast<uint8_t>(source << 1);
+                    V[0xF] = (source & 0x80) >> 7;
+                    break;
+                }
+                    
+                default:
+                    countUnknownOpcode();
+            }
             pc += 2;
             break;
             
         case 0x9000:  // 9XY0: Skip next instruction if VX != VY
-            pc += (V[X] != V[Y]) ? 4 : 2;
+            pc += (V[X] != V[Y]) ? skipLength<Quirks>() : 2;
             break;
             
         case 0xA000:  // ANNN: Set index register I to NNN
@@ -285,21 +995,617 @@ void Chip8::executeOpcode() {
             pc += 2;
             break;
             
-        // More opcodes will be implemented in the next phase
-        // Placeholders for now:
-        
-        case 0xB000:  // BNNN: Jump to address NNN + V0
-        case 0xC000:  // CXNN: Set VX to random number AND NN
-        case 0xD000:  // DXYN: Draw sprite
+        case 0xB000:
+            if (Quirks::JUMP_USES_VX) {
+                pc = NNN + V[X];  // BXNN: Jump to XNN + VX
+            } else {
+                pc = NNN + V[0];  // BNNN: Jump to NNN + V0
+            }
+            break;
+            
+        case 0xC000:  // CXNN: VX = random byte AND NN
+            V[X] = nextRandom() & NN;
+            pc += 2;
+            break;
+            
+        case 0xD000:  // DXYN: Draw N-byte sprite from memory[I] at (VX, VY)
+            // VF = 1 if any lit pixel was turned off (collision), else 0
+            // DXY0 is a 16x16 sprite on SUPER-CHIP and draws nothing otherwise
+            if (N == 0 && !Quirks::SUPERCHIP_OPCODES) {
+                V[0xF] = 0;
+            } else {
+                V[0xF] = drawSprites<Quirks>(V[X], V[Y], N) ? 1 : 0;
+            }
+            pc += 2;
+            break;
+            
         case 0xE000:  // Input handling
-        case 0xF000:  // Various operations
+            switch (NN) {
+                case 0x9E:  // EX9E: Skip next instruction if key VX is pressed
+                    pc += ((keys >> (V[X] & 0xF)) & 1) ? skipLength<Quirks>() : 2;
+                    break;
+                    
+                case 0xA1:  // EXA1: Skip next instruction if key VX is NOT pressed
+                    pc += ((keys >> (V[X] & 0xF)) & 1) ? 2 : skipLength<Quirks>();
+                    break;
+                    
+                default:
+                    countUnknownOpcode();
+                    pc += 2;
+            }
+            break;
+            
+        case 0xF000:  // Timers, memory and misc (FXNN family)
+            switch (NN) {
+                case 0x00:  // F000 NNNN: I = 16-bit address in the next word (XO-CHIP)
+                    if (Quirks::XOCHIP_OPCODES && X == 0) {
+                        const uint16_t at = pc & addressMask<Quirks>();
+                        I = static_cast<uint16_t>((ram[at + 2] << 8) | ram[at + 3]);
+                        pc += 2;  // Skip the address word (+2 more below)
+                    } else {
+                        countUnknownOpcode();  // Not in this profile
+                    }
+                    break;
+                    
+                case 0x01:  // FN01: Select drawing planes N (XO-CHIP)
+                    if (Quirks::XOCHIP_OPCODES) {
+                        planeMask = X;
+                    } else {
+                        countUnknownOpcode();
+                    }
+                    break;
+                    
+                case 0x02:  // F002: Load the 16-byte audio pattern from memory[I] (XO-CHIP)
+                    if (Quirks::XOCHIP_OPCODES && X == 0) {
+                        const uint8_t* pattern = ram + (I & addressMask<Quirks>());
+                        std::copy(pattern, pattern + audioPattern.size(), audioPattern.begin());
+                        audioPatternLoaded = true;
+                    } else {
+                        countUnknownOpcode();
+                    }
+                    break;
+                    
+                case 0x3A:  // FX3A: Audio pitch = VX (XO-CHIP)
+                    if (Quirks::XOCHIP_OPCODES) {
+                        audioPitch = V[X];
+                    } else {
+                        countUnknownOpcode();
+                    }
+                    break;
+                    
+                case 0x07:  // FX07: VX = delay timer
+                    V[X] = delayTimer;
+                    break;
+                    
+                case 0x15:  // FX15: delay timer = VX
+                    delayTimer = V[X];
+                    break;
+                    
+                case 0x18:  // FX18: sound timer = VX
+                    soundTimer = V[X];
+                    break;
+                    
+                case 0x1E:  // FX1E: I += VX
+                    I += V[X];
+                    break;
+                    
+                case 0x29:  // FX29: I = address of font sprite for digit VX
+                    // Each font character is 5 bytes, starting at 0x000
+                    I = (V[X] & 0xF) * 5;
+                    break;
+                    
+                case 0x30:  // FX30: I = address of big font digit VX (SUPER-CHIP)
+                    if (Quirks::SUPERCHIP_OPCODES) {
+                        I = BIG_FONT_ADDRESS + (V[X] & 0xF) * 10;
+                    } else {
+                        countUnknownOpcode();
+                    }
+                    break;
+                    
+                case 0x75:  // FX75: Save V0..VX to the RPL flags (SUPER-CHIP)
+                    if (Quirks::SUPERCHIP_OPCODES) {
+                        for (int r = 0; r <= X; ++r) {
+                            rplFlags[r] = V[r];
+                        }
+                    } else {
+                        countUnknownOpcode();
+                    }
+                    break;
+                    
+                case 0x85:  // FX85: Load V0..VX from the RPL flags (SUPER-CHIP)
+                    if (Quirks::SUPERCHIP_OPCODES) {
+                        for (int r = 0; r <= X; ++r) {
+                            V[r] = rplFlags[r];
+                        }
+                    } else {
+                        countUnknownOpcode();
+                    }
+                    break;
+                    
+                case 0x33:  // FX33: Store BCD of VX at I, I+1, I+2
+                    // Example: VX = 254 -> memory[I..I+2] = 2, 5, 4
+                    {
+                        const uint16_t bcd = I & addressMask<Quirks>();
+                        storeByte(ram, bcd, V[X] / 100);
+                        storeByte(ram, bcd + 1, (V[X] / 10) % 10);
+                        storeByte(ram, bcd + 2, V[X] % 10);
+                    }
+                    break;
+                    
+                case 0x55:  // FX55: Store V0..VX at memory[I..I+X]
+                    for (int r = 0; r <= X; ++r) {
+                        storeByte(ram, (I & addressMask<Quirks>()) + r, V[r]);
+                    }
+                    if (Quirks::LOAD_STORE_INCREMENT == IndexIncrement::ByXPlusOne) I += X + 1;
+                    if (Quirks::LOAD_STORE_INCREMENT == IndexIncrement::ByX) I += X;
+                    break;
+                    
+                case 0x65:  // FX65: Load V0..VX from memory[I..I+X]
+                    for (int r = 0; r <= X; ++r) {
+                        V[r] = ram[(I & addressMask<Quirks>()) + r];
+                    }
+                    if (Quirks::LOAD_STORE_INCREMENT == IndexIncrement::ByXPlusOne) I += X + 1;
+                    if (Quirks::LOAD_STORE_INCREMENT == IndexIncrement::ByX) I += X;
+                    break;
+                    
+                case 0x0A:  // FX0A: Wait for a key press and release, VX = key
+                    // PC moves on now; execution resumes there once
+                    // setKey() sees the release (see isWaitingForKey)
+                    waitingForKey = true;
+                    waitRegister = X;
+                    waitKey = NO_KEY;
+                    break;
+                    
+                default:
+                    countUnknownOpcode();
+            }
+            pc += 2;
+            break;
+            
         default:
-            std::cerr << "[TODO] Opcode not yet implemented: 0x" 
-                      << std::hex << opcode << "\n";
+            // Unreachable: every first nibble is handled above
+            countUnknownOpcode();
             pc += 2;
     }
 }
 
+/*
+ * Blit Sprite Rows (SIMD kernel)
+ * 
+ * XORs count pre-shifted sprite masks into count consecutive display rows
+ * and returns the OR of (row AND mask) over all rows.
+ * 
+ * COLLISION IN ONE REDUCTION:
+ * A pixel "collides" when the sprite turns it off, i.e. it was 1 in the
+ * row AND 1 in the sprite. (row & mask) is non-zero exactly when some
+ * pixel of that row collides, so OR-ing all of them together answers
+ * "did anything collide?" with no per-pixel branches.
+ * 
+ * Each row is a uint64_t, so one 128-bit SSE2/NEON register processes
+ * two sprite rows at once (four with AVX2). A 15-row sprite is 8 vector
+ * steps instead of 120 per-pixel updates. Leftover rows use plain
+ * 64-bit integer ops, which are the same algorithm one row at a time.
+ */
+static uint64_t blitSpriteRows(uint64_t* rows, const uint64_t* masks, int count) {
+    uint64_t hits = 0;
+    int i = 0;
+    
+#if defined(__AVX2__)
+    __m256i acc4 = _mm256_setzero_si256();
+    for (; i + 4 <= count; i += 4) {
+        __m256i row = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows + i));
+        __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks + i));
+        acc4 = _mm256_or_si256(acc4, _mm256_and_si256(row, mask));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(rows + i), _mm256_xor_si256(row, mask));
+    }
+    alignas(32) uint64_t lanes4[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes4), acc4);
+    hits |= lanes4[0] | lanes4[1] | lanes4[2] | lanes4[3];
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 2 <= count; i += 2) {
+        __m128i row = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + i));
+        __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks + i));
+        acc = _mm_or_si128(acc, _mm_and_si128(row, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(rows + i), _mm_xor_si128(row, mask));
+    }
+    alignas(16) uint64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    hits |= lanes[0] | lanes[1];
+#elif defined(__ARM_NEON)
+    uint64x2_t acc = vdupq_n_u64(0);
+    for (; i + 2 <= count; i += 2) {
+        uint64x2_t row = vld1q_u64(rows + i);
+        uint64x2_t mask = vld1q_u64(masks + i);
+        acc = vorrq_u64(acc, vandq_u64(row, mask));
+        vst1q_u64(rows + i, veorq_u64(row, mask));
+    }
+    hits |= vgetq_lane_u64(acc, 0) | vgetq_lane_u64(acc, 1);
+#endif
+
+    // Scalar tail (or the whole sprite on targets without SIMD)
+    for (; i < count; ++i) {
+        hits |= rows[i] & masks[i];
+        rows[i] ^= masks[i];
+    }
+    
+    return hits;
+}
+
+/*
+ * Place Sprite Row
+ * 
+ * @param left: Sprite row with its leftmost pixel at bit 63
+ * @param x: Column of the leftmost pixel (already < screen width)
+ * @param out: The two display words the row covers
+ * 
+ * A display row is 128 bits split over two words, so shifting the sprite
+ * right by x may carry bits from word 0 into word 1:
+ *   x < 64:   word 0 = left >> x,  word 1 = the bits that fell off
+ *   x >= 64:  word 0 = 0,          word 1 = left >> (x - 64)
+ * In 64-pixel mode word 1 is unused; the overflow is dropped (clip) or
+ * rotated back to x = 0 (wrap). In 128-pixel mode only x > 64 can
+ * overflow the right edge (sprites are at most 16 pixels wide).
+ */
+template <bool WrapSprites>
+static inline void placeSpriteRow(uint64_t left, int x, bool hires, uint64_t* out) {
+    if (!hires) {
+        out[0] = left >> x;
+        if (WrapSprites && x != 0) {
+            out[0] |= left << (64 - x);  // Rotate the overflow back in
+        }
+        out[1] = 0;
+    } else if (x < 64) {
+        out[0] = left >> x;
+        out[1] = (x != 0) ? left << (64 - x) : 0;
+    } else {
+        out[0] = (WrapSprites && x != 64) ? left << (128 - x) : 0;
+        out[1] = left >> (x - 64);
+    }
+}
+
+/*
+ * Draw Sprite (DXYN kernel)
+ * 
+ * @param plane: Bitplane to draw into (display, or an XO-CHIP extra plane)
+ * @param hash: That plane's running hash (framebufferHash or extraPlaneHash)
+ * @param slotBase: Hash slot of the plane's first word
+ * @param sprite: Sprite bytes (normally memory + I)
+ * @param x, y: Sprite origin (wrapped into the screen)
+ * @param height: Number of sprite rows (bytes read from sprite);
+ *                0 means a 16x16 sprite (two bytes per row, SUPER-CHIP)
+ * @return: true if any lit pixel was turned off
+ * 
+ * STEP 1 - Build row masks:
+ *   A sprite row is one byte, MSB = leftmost pixel. Placing it at bit 63
+ *   (byte << 56) puts it at x = 0; shifting right by x moves it to column x.
+ *   Example: byte 0xF0 at x = 62 on the 64-pixel screen
+ *     0xF0 << 56       = 1111 0000 0000 ... (pixels 0-3)
+ *     >> 62            = ... 0000 0011      (pixels 62-63, the rest fell off)
+ *   In wrap mode the bits that fell off (left << (64 - x)) re-enter at x = 0,
+ *   which is simply a rotate right. Every sprite row becomes two words,
+ *   one per half of a 128-pixel display row (see placeSpriteRow).
+ * 
+ * STEP 2 - Blit:
+ *   Rows below the screen are dropped (clip) or continue at row 0 (wrap),
+ *   so the sprite covers at most two contiguous runs of display rows.
+ *   Display rows are contiguous pairs of words, so each run is one
+ *   blitSpriteRows call over 2 * rows words: a 128-bit SIMD register
+ *   now covers exactly one full display row.
+ * 
+ * STEP 3 - Hash:
+ *   Each touched word changed from (word ^ mask) to word, so the framebuffer
+ *   hash swaps the old word's contribution for the new one (see hash.h).
+ *   Words with a zero mask did not change and cost nothing: in 64x32 mode
+ *   that is every right-hand word, and a blank sprite row is all of them.
+ * 
+ * WrapSprites is a template parameter so each mode compiles to its own
+ * branch-free kernel instead of testing a flag for every row.
+ */
+template <bool WrapSprites>
+bool Chip8::drawSprite(uint64_t* plane, uint64_t& hash, int slotBase,
+                       const uint8_t* sprite, uint8_t x, uint8_t y, uint8_t height) {
+    const int width = getWidth();
+    const int screenHeight = getHeight();
+    x %= width;
+    y %= screenHeight;
+    
+    // DXY0: 16 rows of 16 pixels, stored as two bytes per row
+    const bool wide = (height == 0);
+    int rows = wide ? 16 : height;
+    if (!WrapSprites && y + rows > screenHeight) {
+        rows = screenHeight - y;  // Clip at the bottom edge
+    }
+    
+    // STEP 1: Two pre-shifted 64-bit masks per sprite row
+    alignas(32) uint64_t masks[16 * ROW_WORDS];
+    for (int i = 0; i < rows; ++i) {
+        uint64_t left = wide
+            ? static_cast<uint64_t>((sprite[2 * i] << 8) | sprite[2 * i + 1]) << 48
+            : static_cast<uint64_t>(sprite[i]) << 56;
+        placeSpriteRow<WrapSprites>(left, x, highResolution, &masks[i * ROW_WORDS]);
+    }
+    
+    // STEP 2: Blit the (at most two) contiguous runs of rows
+    int firstRun = (y + rows > screenHeight) ? screenHeight - y : rows;
+    uint64_t hits = blitSpriteRows(&plane[y * ROW_WORDS], masks, firstRun * ROW_WORDS);
+    dirtyRows |= ((uint64_t{1} << firstRun) - 1) << y;
+    
+    if (WrapSprites && firstRun < rows) {
+        int wrapped = rows - firstRun;
+        hits |= blitSpriteRows(&plane[0], masks + firstRun * ROW_WORDS, wrapped * ROW_WORDS);
+        dirtyRows |= (uint64_t{1} << wrapped) - 1;
+    }
+    
+    // STEP 3: Incremental hash update from the XOR deltas
+    for (int i = 0; i < rows; ++i) {
+        int row = (y + i) % screenHeight;
+        for (int w = 0; w < ROW_WORDS; ++w) {
+            int word = row * ROW_WORDS + w;
+            uint64_t mask = masks[i * ROW_WORDS + w];
+            if (mask == 0) {
+                continue;  // Word unchanged: nothing to swap
+            }
+            hash ^= hashSlot(slotBase + word, plane[word] ^ mask) ^ hashSlot(slotBase + word, plane[word]);
+        }
+    }
+    
+    drawFlag = true;
+    return hits != 0;
+}
+
+/*
+ * Draw Sprites (DXYN over the selected planes)
+ * 
+ * Classic profiles have one plane, so this is a single drawSprite call.
+ * XO-CHIP draws into every plane selected by FN01, in plane order, each
+ * with its own slice of sprite data: with planes 0 and 1 selected,
+ * plane 0 reads N bytes from I and plane 1 the N bytes after that.
+ * A collision on any plane sets VF.
+ */
+template <typename Quirks>
+bool Chip8::drawSprites(uint8_t x, uint8_t y, uint8_t height) {
+    const uint8_t* sprite = ramFor<Quirks>() + (I & addressMask<Quirks>());
+    
+    if (!Quirks::XOCHIP_OPCODES) {
+        return drawSprite<Quirks::WRAP_SPRITES>(display.data(), framebufferHash, 0,
+                                                sprite, x, y, height);
+    }
+    
+    const int bytes = (height == 0) ? 32 : height;
+    bool hit = false;
+    for (int p = 0; p < PLANE_COUNT; ++p) {
+        if ((planeMask >> p) & 1) {
+            uint64_t& hash = (p == 0) ? framebufferHash : extraPlaneHash;
+            hit |= drawSprite<Quirks::WRAP_SPRITES>(planeData(p), hash, p * PLANE_WORDS,
+                                                    sprite, x, y, height);
+            sprite += bytes;
+        }
+    }
+    return hit;
+}
+
+/*
+ * Skip Length
+ * 
+ * A taken skip normally hops over one 2-byte instruction. XO-CHIP's
+ * F000 NNNN is 4 bytes long, so skipping it must hop 4 bytes, otherwise
+ * the address word would be executed as an instruction.
+ */
+template <typename Quirks>
+uint16_t Chip8::skipLength() {
+    if (Quirks::XOCHIP_OPCODES) {
+        const uint8_t* ram = ramFor<Quirks>();
+        uint16_t next = (pc + 2) & addressMask<Quirks>();
+        if (ram[next] == 0xF0 && ram[next + 1] == 0x00) {
+            return 6;
+        }
+    }
+    return 4;
+}
+
+// ==================== SUPER-CHIP SCREEN OPERATIONS ====================
+
+/*
+ * Clear Display
+ * 
+ * Blanks every plane (both modes) and marks every row dirty.
+ */
+void Chip8::clearDisplay() {
+    // std::array's fill() is safer than memset for C++ types
+    display.fill(0);
+    std::fill(extraPlanes.begin(), extraPlanes.end(), 0);
+    drawFlag = true;  // Draw the cleared screen
+    dirtyRows = ALL_ROWS_DIRTY;  // Every row must be converted once
+    framebufferHash = emptyFramebufferHash();
+    extraPlaneHash = 0;
+    displayHashStale = false;
+}
+
+/*
+ * Clear Planes (00E0)
+ * 
+ * Only the planes selected by the mask are cleared, so XO-CHIP programs
+ * can wipe one layer and keep the other. With one plane this is
+ * exactly clearDisplay().
+ */
+void Chip8::clearPlanes(uint8_t mask) {
+    if ((mask & 1) != 0) {
+        display.fill(0);
+        framebufferHash = emptyFramebufferHash();
+    }
+    
+    if (!extraPlanes.empty() && (mask >> 1) != 0) {
+        for (int p = 1; p < PLANE_COUNT; ++p) {
+            if ((mask >> p) & 1) {
+                std::fill(planeData(p), planeData(p) + PLANE_WORDS, 0);
+            }
+        }
+        displayHashStale = true;
+    }
+    
+    drawFlag = true;
+    dirtyRows = ALL_ROWS_DIRTY;
+}
+
+/*
+ * Switch Resolution (00FE / 00FF)
+ * 
+ * Like SUPER-CHIP 1.1, switching modes also clears the screen, so the
+ * framebuffer never holds pixels outside the visible area.
+ */
+void Chip8::setHighResolution(bool enabled) {
+    highResolution = enabled;
+    clearDisplay();
+}
+
+/*
+ * Rehash Display
+ * 
+ * Recomputes both display hashes from the planes: 256 mixes per plane,
+ * which is several times the cost of a scroll's own word moves. So
+ * scrolls only call displayMoved(), and the work is done here once,
+ * when a hash is actually read (getFramebufferHash(), getStateHash()).
+ * A ROM that scrolls every instruction but is hashed once per frame
+ * pays for one rehash per frame.
+ * 
+ * Extra planes contribute hashSlot(slot, word) ^ hashSlot(slot, 0), which
+ * is 0 for a blank word. That is what keeps extraPlaneHash at 0 (and the
+ * classic hashes unchanged) until an XO-CHIP program draws in them.
+ */
+void Chip8::refreshDisplayHash() const {
+    uint64_t h = 0;
+    for (int word = 0; word < PLANE_WORDS; ++word) {
+        h ^= hashSlot(word, display[word]);
+    }
+    framebufferHash = h;
+    
+    uint64_t extra = 0;
+    for (std::size_t i = 0; i < extraPlanes.size(); ++i) {
+        int slot = PLANE_WORDS + static_cast<int>(i);
+        extra ^= hashSlot(slot, extraPlanes[i]) ^ hashSlot(slot, 0);
+    }
+    extraPlaneHash = extra;
+    displayHashStale = false;
+}
+
+void Chip8::rehashDisplay() {
+    refreshDisplayHash();
+    dirtyRows = ALL_ROWS_DIRTY;
+    drawFlag = true;
+}
+
+void Chip8::displayMoved() {
+    displayHashStale = true;   // DXYN keeps patching it; the next read starts over
+    dirtyRows = ALL_ROWS_DIRTY;
+    drawFlag = true;
+}
+
+/*
+ * Scroll Down / Up (00CN / 00DN)
+ * 
+ * @param rows: Number of rows (0-15); rows scrolled in are blank
+ * 
+ * Rows are whole words, so each selected plane is one overlapping block
+ * move (std::copy_backward/std::copy, like memmove) plus a fill.
+ */
+void Chip8::scrollDown(int rows) {
+    const int height = getHeight();
+    if (rows > height) {
+        rows = height;
+    }
+    
+    for (int p = 0; p < PLANE_COUNT; ++p) {
+        if (((planeMask >> p) & 1) == 0) {
+            continue;
+        }
+        uint64_t* first = planeData(p);
+        uint64_t* last = first + height * ROW_WORDS;
+        std::copy_backward(first, last - rows * ROW_WORDS, last);
+        std::fill(first, first + rows * ROW_WORDS, 0);
+    }
+    displayMoved();
+}
+
+void Chip8::scrollUp(int rows) {
+    const int height = getHeight();
+    if (rows > height) {
+        rows = height;
+    }
+    
+    for (int p = 0; p < PLANE_COUNT; ++p) {
+        if (((planeMask >> p) & 1) == 0) {
+            continue;
+        }
+        uint64_t* first = planeData(p);
+        uint64_t* last = first + height * ROW_WORDS;
+        std::copy(first + rows * ROW_WORDS, last, first);
+        std::fill(last - rows * ROW_WORDS, last, 0);
+    }
+    displayMoved();
+}
+
+/*
+ * Scroll Right / Left (00FB / 00FC)
+ * 
+ * @param pixels: Shift distance (1-63)
+ * 
+ * In 128-pixel mode a row is a 128-bit number split over two words,
+ * so shifting it right moves the low bits of word 0 into the top of
+ * word 1 (and the reverse for a left shift). Pixels pushed past the
+ * edge are lost.
+ */
+void Chip8::scrollRight(int pixels) {
+    const int height = getHeight();
+    for (int p = 0; p < PLANE_COUNT; ++p) {
+        if (((planeMask >> p) & 1) == 0) {
+            continue;
+        }
+        for (int y = 0; y < height; ++y) {
+            uint64_t* row = planeData(p) + y * ROW_WORDS;
+            if (highResolution) {
+                row[1] = (row[1] >> pixels) | (row[0] << (64 - pixels));
+            }
+            row[0] >>= pixels;
+        }
+    }
+    displayMoved();
+}
+
+void Chip8::scrollLeft(int pixels) {
+    const int height = getHeight();
+    for (int p = 0; p < PLANE_COUNT; ++p) {
+        if (((planeMask >> p) & 1) == 0) {
+            continue;
+        }
+        for (int y = 0; y < height; ++y) {
+            uint64_t* row = planeData(p) + y * ROW_WORDS;
+            if (highResolution) {
+                row[0] = (row[0] << pixels) | (row[1] >> (64 - pixels));
+                row[1] <<= pixels;
+            } else {
+                row[0] <<= pixels;
+            }
+        }
+    }
+    displayMoved();
+}
+
+/*
+ * Next Random Byte (xorshift32)
+ * 
+ * Three shift-XOR steps scramble the 32-bit state; the top byte is
+ * the result. Period is 2^32 - 1, plenty for CXNN.
+ */
+uint8_t Chip8::nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return static_cast<uint8_t>(rngState >> 24);
+}
+
 /*
  * Update Timers
  * 
@@ -326,29 +1632,265 @@ void Chip8::updateTimers() {
  * 
  * @param key: Which key (0x0 to 0xF)
  * @param pressed: true if pressed, false if released
+ * 
+ * Frontends may call this every frame with the current state; only
+ * changes (edges) matter to FX0A. A key that was already held when FX0A
+ * started does not count until it is released and pressed again.
  */
 void Chip8::setKey(uint8_t key, bool pressed) {
-    if (key < KEY_COUNT) {
-        keys[key] = pressed;
+    if (key >= KEY_COUNT) {
+        return;
+    }
+    
+    const uint16_t bit = static_cast<uint16_t>(1u << key);
+    const bool wasPressed = (keys & bit) != 0;
+    if (waitingForKey) {
+        if (pressed && !wasPressed && waitKey == NO_KEY) {
+            waitKey = key;  // First new press during the wait
+        } else if (!pressed && wasPressed && waitKey == key) {
+            V[waitRegister] = key;  // Released: FX0A completes
+            waitingForKey = false;
+        }
+    }
+    
+    keys = pressed ? (keys | bit) : (keys & ~bit);
+}
+
+/*
+ * Set All Keys
+ * 
+ * @param mask: bit K set = key K pressed
+ * 
+ * For callers that poll the whole keypad at once (batch environments,
+ * the C API). Only keys that changed go through setKey(), so FX0A sees
+ * exactly the presses and releases it would have seen one key at a time.
+ */
+void Chip8::setKeys(uint16_t mask) {
+    uint16_t changed = static_cast<uint16_t>(keys ^ mask);
+    for (uint8_t key = 0; changed != 0; ++key, changed >>= 1) {
+        if (changed & 1) {
+            setKey(key, (mask >> key) & 1);
+        }
     }
 }
 
 /*
  * Get Pixel State
  * 
- * @param x: X coordinate (0-63)
- * @param y: Y coordinate (0-31)
+ * @param x: X coordinate (0-63, or 0-127 in hi-res mode)
+ * @param y: Y coordinate (0-31, or 0-63 in hi-res mode)
  * @return: true if pixel is on, false if off
  * 
- * 1D INDEX CALCULATION:
- * For a 2D array stored as 1D, the formula is: y * WIDTH + x
+ * PACKED ROW LOOKUP:
+ * Row y is ROW_WORDS uint64_t words; pixel x lives in word x / 64 at
+ * bit 63 - (x % 64)
  * 
- * Example: Get pixel at (5, 3)
- * Index = 3 * 64 + 5 = 197
+ * Example: Get pixel at (70, 3)
+ * (display[3 * 2 + 1] >> 57) & 1
  */
 bool Chip8::getPixel(uint8_t x, uint8_t y) const {
-    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) {
+    if (x >= getWidth() || y >= getHeight()) {
         return false;  // Out of bounds
     }
-    return display[y * DISPLAY_WIDTH + x] != 0;
+    uint64_t word = display[y * ROW_WORDS + (x >> 6)];
+    return ((word >> (63 - (x & 63))) & 1) != 0;
+}
+
+/*
+ * Get Packed Row
+ * 
+ * @param y: Row (0-31, or 0-63 in hi-res mode)
+ * @return: Pointer to ROW_WORDS words of row y; bit 63 of word 0 = x 0.
+ *          Only the first getWidth() / 64 words are meaningful. Rows out
+ *          of range read as blank.
+ * 
+ * Lets renderers and recorders convert a whole row without 128 getPixel calls
+ */
+const uint64_t* Chip8::getRow(uint8_t y) const {
+    if (y >= DISPLAY_HEIGHT) {
+        return BLANK_ROW;
+    }
+    return &display[y * ROW_WORDS];
+}
+
+/*
+ * Get Packed Row of a Bitplane (XO-CHIP)
+ * 
+ * @param plane: 0-3; plane 0 is the same as getRow()
+ * @return: Same layout as getRow(); planes that do not exist read as blank
+ */
+const uint64_t* Chip8::getPlaneRow(int plane, uint8_t y) const {
+    if (plane == 0) {
+        return getRow(y);
+    }
+    if (plane < 0 || plane >= getPlaneCount() || y >= DISPLAY_HEIGHT) {
+        return BLANK_ROW;
+    }
+    return &extraPlanes[(plane - 1) * PLANE_WORDS + y * ROW_WORDS];
+}
+
+// ==================== SAVE STATES ====================
+
+/*
+ * Visit State
+ * 
+ * Calls visit(pointer, bytes) for every part of the machine state, in
+ * save-state order. saveState() copies out of these pointers, loadState()
+ * copies into them, stateSize() adds up the sizes, so the three can never
+ * disagree about the layout.
+ * 
+ * Not part of the state: the quirk profile (checked, not restored),
+ * attached debugger/tracer, compiled code (loadState() re-checks its
+ * blocks against the loaded memory), and the derived display
+ * hashes and dirty rows (recomputed by loadState()). The memory hash is
+ * saved instead: recomputing it would scan all 4KB (or 64KB) on every
+ * load, which rollback and the explorer do thousands of times.
+ */
+template <typename Self, typename Visit>
+void Chip8::visitState(Self& self, Visit&& visit) {
+    visit(self.V.data(), sizeof(self.V));
+    visit(&self.I, sizeof(self.I));
+    visit(&self.pc, sizeof(self.pc));
+    visit(&self.opcode, sizeof(self.opcode));
+    visit(&self.keys, sizeof(self.keys));
+    visit(&self.waitingForKey, sizeof(self.waitingForKey));
+    visit(&self.waitRegister, sizeof(self.waitRegister));
+    visit(&self.waitKey, sizeof(self.waitKey));
+    visit(self.stack.data(), sizeof(self.stack));
+    visit(&self.sp, sizeof(self.sp));
+    visit(&self.delayTimer, sizeof(self.delayTimer));
+    visit(&self.soundTimer, sizeof(self.soundTimer));
+    visit(self.activeMemory(), self.activeMemorySize() + MEMORY_GUARD);
+    visit(self.display.data(), sizeof(self.display));
+    visit(self.extraPlanes.data(), self.extraPlanes.size() * sizeof(uint64_t));
+    visit(&self.planeMask, sizeof(self.planeMask));
+    visit(&self.highResolution, sizeof(self.highResolution));
+    visit(&self.exited, sizeof(self.exited));
+    visit(self.rplFlags.data(), sizeof(self.rplFlags));
+    visit(self.audioPattern.data(), sizeof(self.audioPattern));
+    visit(&self.audioPitch, sizeof(self.audioPitch));
+    visit(&self.audioPatternLoaded, sizeof(self.audioPatternLoaded));
+    visit(&self.rngState, sizeof(self.rngState));
+    visit(&self.memoryHash, sizeof(self.memoryHash));
+}
+
+/*
+ * State Hash
+ * 
+ * XOR of the running memory and display hashes with one hashSlot() per
+ * 64-bit word of everything else visitState() covers, packed by hand:
+ * 13 small mixes, whatever the memory size. Two machines that would save
+ * the same state (ignoring the last opcode, which the next fetch
+ * overwrites) get the same hash, on any thread or run.
+ * 
+ * The quirk profile is not mixed in: compare hashes within one profile.
+ */
+uint64_t Chip8::getStateHash() const {
+    static_assert(sizeof(V) + sizeof(stack) + sizeof(rplFlags) + sizeof(audioPattern) == 10 * 8,
+                  "register arrays must fill words 0-9 exactly");
+    uint64_t words[11] = {};
+    std::memcpy(&words[0], V.data(), sizeof(V));                 // 0-1
+    std::memcpy(&words[2], stack.data(), sizeof(stack));         // 2-5
+    std::memcpy(&words[6], rplFlags.data(), sizeof(rplFlags));   // 6-7
+    std::memcpy(&words[8], audioPattern.data(), sizeof(audioPattern));   // 8-9
+    words[10] = static_cast<uint64_t>(rngState) | (static_cast<uint64_t>(audioPitch) << 32) |
+                (static_cast<uint64_t>(audioPatternLoaded) << 40);
+    
+    const uint64_t registers = static_cast<uint64_t>(I) | (static_cast<uint64_t>(pc) << 16) |
+                               (static_cast<uint64_t>(keys) << 32) |
+                               (static_cast<uint64_t>(waitingForKey) << 48) |
+                               (static_cast<uint64_t>(waitRegister) << 52) |
+                               (static_cast<uint64_t>(waitKey) << 56);
+    const uint64_t misc = static_cast<uint64_t>(sp) | (static_cast<uint64_t>(delayTimer) << 8) |
+                          (static_cast<uint64_t>(soundTimer) << 16) |
+                          (static_cast<uint64_t>(highResolution) << 24) |
+                          (static_cast<uint64_t>(planeMask) << 32) |
+                          (static_cast<uint64_t>(exited) << 40);
+    
+    if (displayHashStale) {
+        refreshDisplayHash();
+    }
+    uint64_t h = memoryHash ^ framebufferHash ^ extraPlaneHash ^
+                 hashSlot(REGISTER_HASH_SLOT, registers) ^ hashSlot(REGISTER_HASH_SLOT + 1, misc);
+    for (int i = 0; i < 11; ++i) {
+        h ^= hashSlot(REGISTER_HASH_SLOT + 2 + static_cast<uint64_t>(i), words[i]);
+    }
+    return h;
+}
+
+/*
+ * Save State Size
+ * 
+ * @return: bytes saveState() writes for the current profile (about 5KB,
+ *          or 67KB for XO-CHIP with its 64KB memory and extra planes)
+ */
+std::size_t Chip8::stateSize() const {
+    std::size_t size = STATE_HEADER_SIZE;
+    visitState(*this, [&](const void*, std::size_t bytes) { size += bytes; });
+    return size;
+}
+
+/*
+ * Save State
+ * 
+ * Copies the whole machine into a caller-provided buffer. No allocation
+ * and no I/O, so it is cheap enough to call every frame (rollback,
+ * embedding through the C API in libchip8.h).
+ * 
+ * The format is a raw copy of this build's fields behind a small header
+ * (magic, version, profile): good for snapshots within one program, not
+ * an interchange format between versions or machines.
+ * 
+ * @param out: at least stateSize() bytes
+ * @return: false if the buffer is too small
+ */
+bool Chip8::saveState(uint8_t* out, std::size_t size) const {
+    if (size < stateSize()) {
+        return false;
+    }
+    const uint32_t magic = STATE_MAGIC;
+    std::memcpy(out, &magic, sizeof(magic));
+    out[4] = STATE_VERSION;
+    out[5] = static_cast<uint8_t>(quirkProfile);
+    out[6] = 0;
+    out[7] = 0;
+    
+    uint8_t* at = out + STATE_HEADER_SIZE;
+    visitState(*this, [&](const void* field, std::size_t bytes) {
+        std::memcpy(at, field, bytes);
+        at += bytes;
+    });
+    return true;
+}
+
+/*
+ * Load State
+ * 
+ * Restores a state written by saveState(). The machine must already be
+ * running the same quirk profile: switching to or from XO-CHIP would
+ * allocate or free its 64KB memory, and loading never allocates.
+ * 
+ * @return: false (machine unchanged) for a wrong size, header or profile
+ */
+bool Chip8::loadState(const uint8_t* in, std::size_t size) {
+    uint32_t magic = 0;
+    if (size != stateSize()) {
+        return false;
+    }
+    std::memcpy(&magic, in, sizeof(magic));
+    if (magic != STATE_MAGIC || in[4] != STATE_VERSION ||
+        in[5] != static_cast<uint8_t>(quirkProfile)) {
+        return false;
+    }
+    
+    const uint8_t* at = in + STATE_HEADER_SIZE;
+    visitState(*this, [&](void* field, std::size_t bytes) {
+        std::memcpy(field, at, bytes);
+        at += bytes;
+    });
+    waitRegister &= 0xF;   // Used as an index into V
+    
+    reattachCompiledRom();   // Compiled blocks the loaded memory still holds
+    rehashDisplay();       // Hashes, dirty rows and draw flag follow the display
+    return true;
 }
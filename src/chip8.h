@@ -3,7 +3,17 @@
 
 #include <cstdint>  // For fixed-width integer types
 #include <array>    // For std::array (safer than C arrays)
-#include <string>   // For ROM loading error messages
+#include <cstddef>  // For std::size_t
+#include <string>   // For ROM file paths
+#include <vector>   // For XO-CHIP memory and bitplanes
+#include "hash.h"   // For framebuffer hashing
+#include "quirks.h" // For compile-time quirk profiles
+
+class Debugger;     // See debugger.h
+class TraceWriter;  // See trace.h
+struct CompiledBlock;       // See aot.h
+struct CompiledRom;
+struct CompiledRomAccess;
 
 /*
  * CHIP-8 Emulator Class
@@ -12,11 +22,12 @@
  * designed in the 1970s for programming simple video games on 8-bit computers.
  * 
  * ARCHITECTURE OVERVIEW:
- * - 4KB (4096 bytes) of RAM
+ * - 4KB (4096 bytes) of RAM (64KB with the XO-CHIP profile)
  * - 16 general-purpose 8-bit registers (V0-VF)
  * - One 16-bit index register (I)
  * - One 16-bit program counter (PC)
- * - 64x32 monochrome display
+ * - 64x32 monochrome display (128x64 in SUPER-CHIP hi-res mode,
+ *   up to 4 bitplanes with XO-CHIP)
  * - Two 8-bit timers (delay and sound)
  * - 16-level stack for subroutine calls
  */
@@ -28,33 +39,157 @@ public:
     ~Chip8() = default;
 
     // Core emulation functions
-    void initialize();                    // Reset the emulator to initial state
+    void reset();                         // Reset the emulator to initial state
+    [[deprecated("use reset(); the core no longer logs")]]
+    void initialize() { reset(); }        // Old name for reset()
     bool loadROM(const std::string& filename);  // Load a CHIP-8 program into memory
+    bool loadROM(const uint8_t* data, std::size_t size);  // Load from a buffer
     void emulateCycle();                  // Execute one fetch-decode-execute cycle
+    uint32_t runCycles(uint32_t count);   // Execute count cycles, returns cycles run
+                                          // (fewer if FX0A starts waiting for a key)
+    
+    // FX0A: true while the program is blocked until a key is pressed and
+    // released. No cycles run in this state, so the frontend can sleep
+    // until the next input event instead of spinning.
+    bool isWaitingForKey() const { return waitingForKey; }
+    
+    // Quirk profile: selects the interpreter instantiation (see quirks.h).
+    // Call once before running a ROM; the hot loop has no quirk branches.
+    void setQuirkProfile(QuirkProfile profile);
+    QuirkProfile getQuirkProfile() const { return quirkProfile; }
+    
+    // Seed for CXNN's random numbers (runs are reproducible per seed)
+    void seedRandom(uint32_t seed);
+    
+    // Debugging: attaching a debugger switches to the debug engines, which
+    // check breakpoints before every instruction. Detach (nullptr) to get
+    // the release engines back; they contain no debugger checks at all.
+    void attachDebugger(Debugger* debugger);
+    Debugger* getDebugger() const { return debugger; }
+    
+    // Tracing: record every executed instruction into a binary trace.
+    // Also runs on the debug engines; nullptr detaches.
+    void attachTracer(TraceWriter* tracer);
+    TraceWriter* getTracer() const { return tracer; }
+    
+    // Ahead-of-time compiled ROMs (see aot.h): loadROM() switches to
+    // compiled code when the ROM and profile match a built-in one.
+    // Disable before loadROM() to always interpret (e.g. to compare).
+    void setCompiledRomsEnabled(bool enabled) { compiledRomsEnabled = enabled; }
+    const CompiledRom* getCompiledRom() const { return compiledRom; }
+    
+    // Machine state inspection (debuggers, tracers, analysis tools)
+    uint8_t getV(int index) const { return V[index & 0xF]; }
+    uint16_t getI() const { return I; }
+    uint16_t getPC() const { return pc; }
+    uint8_t getSP() const { return sp; }
+    uint16_t getStackEntry(int index) const { return stack[index & 0xF]; }
+    uint8_t getDelayTimer() const { return delayTimer; }
+    uint8_t getSoundTimer() const { return soundTimer; }
+    uint8_t getPlaneMask() const { return planeMask; }
+    std::size_t getMemorySize() const { return activeMemorySize(); }
+    uint8_t readMemory(uint16_t address) const;  // Active memory (4KB or 64KB)
+    uint16_t peekOpcode() const;                 // Next instruction, not executed
+    
     
     // Timer management (should be called at 60Hz)
     void updateTimers();
+    bool timersActive() const { return delayTimer > 0 || soundTimer > 0; }
     
     // Input handling
     void setKey(uint8_t key, bool pressed);  // Set key state (0-F)
+    void setKeys(uint16_t mask);             // All 16 at once, bit K = key K
+    uint16_t getKeys() const { return keys; }  // Bit K set = key K pressed
     
     // Graphics access
     bool getPixel(uint8_t x, uint8_t y) const;  // Get pixel state at (x,y)
+    const uint64_t* getRow(uint8_t y) const;    // ROW_WORDS packed words, bit 63 of word 0 = x 0
     bool shouldDraw() const { return drawFlag; }
     void clearDrawFlag() { drawFlag = false; }
     
+    // Current resolution: 64x32 normally, 128x64 after 00FF (SUPER-CHIP)
+    bool isHighResolution() const { return highResolution; }
+    int getWidth() const { return highResolution ? HIRES_WIDTH : LORES_WIDTH; }
+    int getHeight() const { return highResolution ? HIRES_HEIGHT : LORES_HEIGHT; }
+    
+    // Dirty-row tracking (bit N set = display row N changed since last fetch)
+    uint64_t getDirtyRows() const { return dirtyRows; }
+    uint64_t takeDirtyRows() {               // Fetch and clear in one call
+        uint64_t rows = dirtyRows;
+        dirtyRows = 0;
+        return rows;
+    }
+    
+    // XO-CHIP bitplanes: plane 0 is what getRow() returns; planes 1-3
+    // only exist with the xochip profile (blank rows otherwise)
+    int getPlaneCount() const { return extraPlanes.empty() ? 1 : PLANE_COUNT; }
+    const uint64_t* getPlaneRow(int plane, uint8_t y) const;
+    
+    // 64-bit hash of the current display contents, all planes. O(1) after
+    // draws and clears, which keep it up to date; the first call after a
+    // scroll rehashes the display once. Equal displays always have equal hashes.
+    uint64_t getFramebufferHash() const {
+        if (displayHashStale) {
+            refreshDisplayHash();
+        }
+        return framebufferHash ^ extraPlaneHash ^ (highResolution ? HIRES_HASH_SALT : 0);
+    }
+    
+    // 64-bit hash of the whole machine: memory, registers, stack, timers,
+    // display, keys and the rest of what saveState() keeps (not the last
+    // opcode). O(1): memory and display hashes are kept up to date by every
+    // write (a scroll defers the display part to the next hash read), the
+    // few registers are mixed in on the call. Equal states always
+    // have equal hashes (loop detection, search dedup, replay checks).
+    uint64_t getStateHash() const;
+    
+    // True once the program executed 00FD (SUPER-CHIP "exit interpreter")
+    bool hasExited() const { return exited; }
+    
     // Audio access
     bool shouldBeep() const { return soundTimer > 0; }
+    
+    // XO-CHIP audio: a 128-sample 1-bit pattern (F002) played at a rate
+    // set by FX3A: 4000 * 2^((pitch - 64) / 48) samples per second
+    bool hasAudioPattern() const { return audioPatternLoaded; }
+    const std::array<uint8_t, 16>& getAudioPattern() const { return audioPattern; }
+    uint8_t getAudioPitch() const { return audioPitch; }
+    
+    // Unknown opcodes executed since reset(), and the most recent one.
+    // SUPER-CHIP/XO-CHIP opcodes count too on profiles without them.
+    // Chip8 never prints (it is also embedded through libchip8.h): it
+    // records what happened and the frontends report it (see report.h).
+    uint32_t getUnknownOpcodeCount() const { return unknownOpcodeCount; }
+    uint16_t getLastUnknownOpcode() const { return lastUnknownOpcode; }
+    
+    // Save states: the whole machine in a caller-provided buffer, with no
+    // allocation (rollback, embedding). The size depends on the profile;
+    // loadState() only accepts states saved under the current profile.
+    std::size_t stateSize() const;
+    bool saveState(uint8_t* out, std::size_t size) const;
+    bool loadState(const uint8_t* in, std::size_t size);
 
     // Constants for CHIP-8 specifications
     static constexpr int MEMORY_SIZE = 4096;    // 4KB of RAM
+    static constexpr int XO_MEMORY_SIZE = 65536;  // XO-CHIP address space
     static constexpr int REGISTER_COUNT = 16;   // V0-VF registers
     static constexpr int STACK_SIZE = 16;       // 16 levels of nesting
     static constexpr int KEY_COUNT = 16;        // 0-F hexadecimal keypad
-    static constexpr int DISPLAY_WIDTH = 64;    // Display width in pixels
-    static constexpr int DISPLAY_HEIGHT = 32;   // Display height in pixels
+    static constexpr int LORES_WIDTH = 64;      // Standard display width in pixels
+    static constexpr int LORES_HEIGHT = 32;     // Standard display height in pixels
+    static constexpr int HIRES_WIDTH = 128;     // SUPER-CHIP hi-res width
+    static constexpr int HIRES_HEIGHT = 64;     // SUPER-CHIP hi-res height
+    static constexpr int DISPLAY_WIDTH = HIRES_WIDTH;    // Framebuffer size (largest mode)
+    static constexpr int DISPLAY_HEIGHT = HIRES_HEIGHT;
+    static constexpr int ROW_WORDS = DISPLAY_WIDTH / 64; // uint64_t words per display row
     static constexpr int FONTSET_SIZE = 80;     // 16 chars * 5 bytes each
+    static constexpr int BIG_FONTSET_SIZE = 160;  // 16 chars * 10 bytes each (SUPER-CHIP)
+    static constexpr uint16_t BIG_FONT_ADDRESS = FONTSET_SIZE;  // Right after the small font
+    static constexpr int RPL_FLAG_COUNT = 16;   // FX75/FX85 persistent flags
+    static constexpr int PLANE_COUNT = 4;       // XO-CHIP bitplanes (FN01 mask is 4 bits)
+    static constexpr uint8_t DEFAULT_AUDIO_PITCH = 64;  // FX3A value for 4000Hz playback
     static constexpr uint16_t ROM_START_ADDRESS = 0x200;  // Programs start at 0x200
+    static constexpr uint64_t ALL_ROWS_DIRTY = ~uint64_t{0};  // One bit per display row
 
 private:
     /*
@@ -79,19 +214,30 @@ private:
      *    - With unsigned char, integer promotion rules can cause surprises
      */
 
-    // ==================== MEMORY ====================
+    // ==================== HOT STATE ====================
     /*
-     * CHIP-8 Memory Map:
-     * 0x000-0x1FF: Reserved for interpreter (we store font data here)
-     * 0x200-0xFFF: Program ROM and work RAM
+     * Everything the interpreter reads or writes on a typical cycle comes
+     * first and shares ONE 64-byte cache line:
      * 
-     * We use std::array instead of C-style arrays for:
-     * - Bounds checking in debug mode (with .at())
-     * - No implicit pointer decay
-     * - Works with modern C++ algorithms
-     * - Size is part of the type
+     *   offset  0  V0-VF        16 bytes
+     *          16  I, pc, opcode, keys
+     *          24  FX0A wait state
+     *          28  stack        32 bytes
+     *          60  sp, delay and sound timers
+     * 
+     * WHY?
+     * The big arrays (4KB memory, 1KB display) used to sit between the
+     * registers, so one cycle touched registers on three or four different
+     * lines. Running one machine that hardly matters (it all stays in L1),
+     * but a batch of thousands of machines evicts each one between turns,
+     * and then every line of hot state is a cache miss. Packed and aligned
+     * (alignas makes the whole Chip8 64-byte aligned), resuming a machine
+     * costs one miss plus the memory it actually touches.
+     * 
+     * The Chip8 constructor static_asserts this layout, so adding a member
+     * in the wrong place fails to compile instead of quietly costing a line.
      */
-    std::array<uint8_t, MEMORY_SIZE> memory;
+    static constexpr std::size_t HOT_LINE = 64;
 
     // ==================== REGISTERS ====================
     /*
@@ -103,7 +249,7 @@ private:
      * - Carry/borrow flag (arithmetic)
      * - Should NOT be used by programs as general-purpose storage
      */
-    std::array<uint8_t, REGISTER_COUNT> V;
+    alignas(HOT_LINE) std::array<uint8_t, REGISTER_COUNT> V;
 
     /*
      * Index Register (I): 16-bit register used for memory addressing
@@ -122,28 +268,79 @@ private:
      */
     uint16_t pc;
 
-    // ==================== GRAPHICS ====================
+    // ==================== CURRENT OPCODE ====================
     /*
-     * Display Buffer: 64x32 monochrome pixels
+     * Opcode: Current 16-bit instruction being executed
+     * - CHIP-8 instructions are 2 bytes (16 bits)
+     * - Fetched from memory at address PC and PC+1
+     * - Format: ANNN where A is the operation, NNN are operands
      * 
-     * We use a 1D array instead of 2D because:
-     * 1. Memory layout is contiguous (better cache performance)
-     * 2. Easier to clear (single memset)
-     * 3. Index calculation is simple: y * WIDTH + x
+     * Example: 0x6A15
+     * - Broken down as: 6 A 15
+     * - Meaning: "Set register VA to value 0x15"
+     */
+    uint16_t opcode;
+
+    // ==================== INPUT ====================
+    /*
+     * Keyboard State: 16 keys (0x0-0xF), one bit each
+     * - Bit K is set while key K is pressed
+     * - Original CHIP-8 used a hexadecimal keypad:
+     *   1 2 3 C
+     *   4 5 6 D
+     *   7 8 9 E
+     *   A 0 B F
      * 
-     * Each uint8_t represents one pixel (0 = off, 1 = on)
-     * We could use a bitfield (8 pixels per byte) for memory efficiency,
-     * but clarity and simplicity are more important for learning.
+     * WHY a bitmask? 16 keys fit in 2 bytes instead of 16, which is what
+     * lets the whole hot state share one cache line
      */
-    std::array<uint8_t, DISPLAY_WIDTH * DISPLAY_HEIGHT> display;
+    uint16_t keys;
+    static_assert(KEY_COUNT <= 16, "keys needs one bit per key");
     
     /*
-     * Draw Flag: Signals when the display needs to be redrawn
-     * - Set to true when any DRAW instruction (DXYN) is executed
-     * - The main loop checks this and renders when true
-     * - Reset to false after rendering
+     * FX0A Wait State
+     * - waitingForKey: set by FX0A, cleared when a key is released
+     * - waitRegister: the X of FX0A, receives the key number
+     * - waitKey: first key pressed during the wait (NO_KEY until then)
+     * 
+     * WHY wait for the release?
+     * The original COSMAC VIP interpreter returned on release. Returning
+     * on press makes menus skip ahead: the same press is still down when
+     * the next EX9E/FX0A runs.
      */
-    bool drawFlag;
+    bool waitingForKey;
+    uint8_t waitRegister;
+    uint8_t waitKey;
+    static constexpr uint8_t NO_KEY = 0xFF;
+
+    // ==================== STACK ====================
+    /*
+     * Stack: Used for subroutine calls (CALL instruction)
+     * - Stores return addresses when entering subroutines
+     * - 16 levels deep (can nest 16 subroutine calls)
+     * - Each entry is 16-bit (stores a memory address)
+     * 
+     * Example flow:
+     * 1. CALL 0x300: Push current PC to stack, jump to 0x300
+     * 2. RETURN: Pop address from stack, jump back
+     */
+    std::array<uint16_t, STACK_SIZE> stack;
+    
+    /*
+     * Stack Pointer: Points to the top of the stack
+     * - Starts at 0 (empty stack)
+     * - Increments on CALL (push)
+     * - Decrements on RETURN (pop)
+     * 
+     * Entries are addressed as stack[sp & STACK_MASK], so the stack is a
+     * ring: a 17th nested CALL overwrites the oldest return address and
+     * a RETURN on an empty stack reads entry 15, instead of touching
+     * whatever follows the array. No branch, and sp still counts depth
+     * (it wraps at 256, a multiple of 16, so the ring stays consistent).
+     */
+    uint8_t sp;
+    static constexpr int STACK_MASK = STACK_SIZE - 1;
+    static_assert((STACK_SIZE & STACK_MASK) == 0, "stack wrap needs a power-of-two size");
 
     // ==================== TIMERS ====================
     /*
@@ -161,39 +358,152 @@ private:
      */
     uint8_t soundTimer;
 
-    // ==================== STACK ====================
+    // ==================== MEMORY ====================
     /*
-     * Stack: Used for subroutine calls (CALL instruction)
-     * - Stores return addresses when entering subroutines
-     * - 16 levels deep (can nest 16 subroutine calls)
-     * - Each entry is 16-bit (stores a memory address)
+     * CHIP-8 Memory Map:
+     * 0x000-0x1FF: Reserved for interpreter (we store font data here)
+     * 0x200-0xFFF: Program ROM and work RAM
      * 
-     * Example flow:
-     * 1. CALL 0x300: Push current PC to stack, jump to 0x300
-     * 2. RETURN: Pop address from stack, jump back
+     * We use std::array instead of C-style arrays for:
+     * - Bounds checking in debug mode (with .at())
+     * - No implicit pointer decay
+     * - Works with modern C++ algorithms
+     * - Size is part of the type
+     * 
+     * MEMORY-SAFE ADDRESSING:
+     * Every guest address is masked to the memory size (a power of two)
+     * before use: the fetch uses pc & 0xFFF and loads/stores use I & 0xFFF,
+     * so an address past the end wraps around like a 12-bit address bus.
+     * Multi-byte accesses start at the masked address and may run up to
+     * MEMORY_GUARD bytes past the end, into spare bytes instead of the
+     * registers. One AND per access replaces a compare and branch.
      */
-    std::array<uint16_t, STACK_SIZE> stack;
+    static constexpr int MEMORY_GUARD = 128;  // Longest access: 16x16 sprite on 4 planes
+    alignas(HOT_LINE) std::array<uint8_t, MEMORY_SIZE + MEMORY_GUARD> memory;  // Own line onwards
     
     /*
-     * Stack Pointer: Points to the top of the stack
-     * - Starts at 0 (empty stack)
-     * - Increments on CALL (push)
-     * - Decrements on RETURN (pop)
-     * - Should never exceed STACK_SIZE-1 or go below 0
+     * XO-CHIP Memory: 64KB, allocated only while the xochip profile is
+     * selected (empty otherwise)
+     * 
+     * WHY not just make memory 64KB?
+     * The 4KB array lives inside the object, right next to the registers,
+     * and fits in L1 cache. Growing it for every profile would make every
+     * Chip8 16 times larger to support one extension. Instead the memory
+     * size is part of the quirk profile (Quirks::MEMORY_SIZE) and
+     * ramFor<Quirks>() picks the array at compile time, so the classic
+     * profiles generate exactly the same code as before.
+     * 
+     * It has the same MEMORY_GUARD spare bytes after 0xFFFF.
      */
-    uint8_t sp;
+    std::vector<uint8_t> extendedMemory;
+    
+    /*
+     * Memory Hash: XOR of memoryByteHash(index, byte) over the active
+     * memory and its guard bytes
+     * - Every guest store (5XY2, FX33, FX55) goes through storeByte(),
+     *   which updates it from the old and new byte: two mixes per byte
+     *   stored, instead of rehashing 4KB (or 64KB) to hash a state
+     * - Zero bytes contribute 0, so a freshly reset machine (only the
+     *   fonts set) has the same compile-time constant for 4KB and 64KB,
+     *   and loadROM() only swaps in the bytes it writes
+     * - Saved with the state, so loadState() stays a plain copy
+     */
+    uint64_t memoryHash;
+    static constexpr uint64_t MEMORY_HASH_SLOT = uint64_t{1} << 32;     // Past every display slot
+    static constexpr uint64_t REGISTER_HASH_SLOT = uint64_t{2} << 32;
 
-    // ==================== INPUT ====================
+    // ==================== GRAPHICS ====================
     /*
-     * Keyboard State: 16 keys (0x0-0xF)
-     * - True if key is currently pressed, false otherwise
-     * - Original CHIP-8 used a hexadecimal keypad:
-     *   1 2 3 C
-     *   4 5 6 D
-     *   7 8 9 E
-     *   A 0 B F
+     * Display Buffer: up to 128x64 monochrome pixels, bit-packed
+     * 
+     * Each display row is TWO uint64_t words (128 pixels = 128 bits):
+     * - Word 0 holds pixels 0-63, word 1 pixels 64-127
+     * - Within a word the MOST significant bit is the leftmost pixel
+     * - This matches sprite bytes, whose most significant bit is leftmost
+     * 
+     * In the standard 64x32 mode only rows 0-31 and word 0 are used.
+     * In SUPER-CHIP hi-res mode (00FF) all 64 rows x 2 words are used.
+     * 
+     * WHY packed rows instead of one byte per pixel?
+     * DXYN XORs an 8- or 16-pixel-wide sprite row into the screen. With
+     * packed rows that is a shift plus one XOR per word, and the collision
+     * check is a single AND, instead of one read-compare-write per pixel.
+     * Scrolling is whole-word moves and shifts for the same reason.
+     * The whole 128x64 screen is only 1KB (16 cache lines).
+     */
+    std::array<uint64_t, DISPLAY_HEIGHT * ROW_WORDS> display;
+    static_assert(DISPLAY_WIDTH == 64 * ROW_WORDS, "display rows are whole uint64_t words");
+    
+    /*
+     * Resolution Mode: false = 64x32, true = 128x64 (SUPER-CHIP 00FF)
      */
-    std::array<bool, KEY_COUNT> keys;
+    bool highResolution;
+    
+    /*
+     * Exited: Set by 00FD. The program counter then stays on the 00FD
+     * instruction, so further cycles do nothing.
+     */
+    bool exited;
+    
+    /*
+     * Draw Flag: Signals when the display needs to be redrawn
+     * - Set to true when any DRAW instruction (DXYN) is executed
+     * - The main loop checks this and renders when true
+     * - Reset to false after rendering
+     */
+    bool drawFlag;
+
+    /*
+     * Dirty Rows: One bit per display row that changed since the last fetch
+     * - Bit N set means row N must be re-read by consumers
+     * - Set by 00E0/scrolls/mode switches (all rows) and DXYN (only the
+     *   rows the sprite covers)
+     * - Consumers call takeDirtyRows() once per frame and only convert
+     *   the rows that changed (most game frames touch a handful of rows)
+     * 
+     * WHY a 64-bit mask? The tallest mode is exactly 64 rows, so the whole
+     * "what changed" question fits in one register
+     */
+    uint64_t dirtyRows;
+    static_assert(DISPLAY_HEIGHT <= 64, "dirtyRows needs one bit per display row");
+
+    /*
+     * Framebuffer Hash: XOR of hashSlot(word index, word) over all words
+     * - Updated from the XOR deltas DXYN already computes, so keeping it
+     *   current costs two mixes per changed word, not a rescan of the screen
+     * - Regression tools compare this instead of dumping images
+     * - getFramebufferHash() folds in the resolution, so a blank 64x32
+     *   screen and a blank 128x64 screen hash differently
+     * - Scrolls move every word, so they only set displayHashStale and the
+     *   next hash read recomputes both display hashes (mutable for that):
+     *   a ROM scrolling every instruction pays for one rehash per read,
+     *   not one per scroll
+     */
+    mutable uint64_t framebufferHash;
+    mutable bool displayHashStale;
+    
+    /*
+     * XO-CHIP Planes 1-3: same layout as display (plane 0), stored back to
+     * back on the heap and only allocated for the xochip profile
+     * - planeMask (FN01) selects which planes DXYN, 00E0 and scrolls touch
+     * - extraPlaneHash covers these words; it is 0 while they are blank,
+     *   so the classic profiles never pay for it
+     */
+    std::vector<uint64_t> extraPlanes;
+    mutable uint64_t extraPlaneHash;
+    uint8_t planeMask;
+    static constexpr int PLANE_WORDS = DISPLAY_HEIGHT * ROW_WORDS;
+    
+    static constexpr uint64_t HIRES_HASH_SALT = 0x5C4E3D2B1A098877ULL;
+
+    // Hash of an all-black display, computed at compile time
+    static constexpr uint64_t emptyFramebufferHash() {
+        uint64_t h = 0;
+        for (int word = 0; word < DISPLAY_HEIGHT * ROW_WORDS; ++word) {
+            h ^= hashSlot(word, 0);
+        }
+        return h;
+    }
 
     // ==================== FONT DATA ====================
     /*
@@ -229,22 +539,218 @@ private:
         0xF0, 0x80, 0xF0, 0x80, 0x80  // F
     };
 
-    // ==================== CURRENT OPCODE ====================
     /*
-     * Opcode: Current 16-bit instruction being executed
-     * - CHIP-8 instructions are 2 bytes (16 bits)
-     * - Fetched from memory at address PC and PC+1
-     * - Format: ANNN where A is the operation, NNN are operands
+     * Big Font (SUPER-CHIP): digits 0-F as 8x10 bitmaps (10 bytes each)
+     * - Stored right after the small font, at BIG_FONT_ADDRESS (0x050)
+     * - Used by FX30, meant for hi-res scores and titles
+     */
+    static constexpr std::array<uint8_t, BIG_FONTSET_SIZE> bigFontset = {
+        0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, // 0
+        0x18, 0x38, 0x58, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, // 1
+        0x3E, 0x7F, 0xC3, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF, // 2
+        0x3C, 0x7E, 0xC3, 0x03, 0x0E, 0x0E, 0x03, 0xC3, 0x7E, 0x3C, // 3
+        0x06, 0x0E, 0x1E, 0x36, 0x66, 0xC6, 0xFF, 0xFF, 0x06, 0x06, // 4
+        0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFE, 0x03, 0xC3, 0x7E, 0x3C, // 5
+        0x3E, 0x7C, 0xC0, 0xC0, 0xFC, 0xFE, 0xC3, 0xC3, 0x7E, 0x3C, // 6
+        0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x60, 0x60, // 7
+        0x3C, 0x7E, 0xC3, 0xC3, 0x7E, 0x7E, 0xC3, 0xC3, 0x7E, 0x3C, // 8
+        0x3C, 0x7E, 0xC3, 0xC3, 0x7F, 0x3F, 0x03, 0x03, 0x3E, 0x7C, // 9
+        0x3C, 0x7E, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, // A
+        0xFC, 0xFE, 0xC3, 0xC3, 0xFE, 0xFE, 0xC3, 0xC3, 0xFE, 0xFC, // B
+        0x3C, 0x7E, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x7E, 0x3C, // C
+        0xFC, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xFC, // D
+        0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, // E
+        0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0  // F
+    };
+    static_assert(BIG_FONT_ADDRESS + BIG_FONTSET_SIZE <= ROM_START_ADDRESS,
+                  "both fonts must fit below the program area");
+
+    /*
+     * RPL User Flags (SUPER-CHIP FX75/FX85)
+     * - 16 bytes that survive reset(), like the HP-48's RPL registers
+     *   that SUPER-CHIP games used to keep high scores between runs
+     */
+    std::array<uint8_t, RPL_FLAG_COUNT> rplFlags;
+    
+    /*
+     * XO-CHIP Audio State
+     * - audioPattern: 16 bytes = 128 one-bit samples, loaded by F002
+     * - audioPitch: playback rate selector, set by FX3A
+     * The frontend plays the pattern while the sound timer is non-zero.
+     */
+    std::array<uint8_t, 16> audioPattern;
+    uint8_t audioPitch;
+    bool audioPatternLoaded;
+
+    // ==================== QUIRKS & RANDOMNESS ====================
+    /*
+     * Selected quirk profile and the interpreter instantiation for it.
      * 
-     * Example: 0x6A15
-     * - Broken down as: 6 A 15
-     * - Meaning: "Set register VA to value 0x15"
+     * WHY member function pointers?
+     * Each profile is a separate template instantiation of the interpreter.
+     * setQuirkProfile() stores pointers to the right instantiation once, so
+     * emulateCycle()/runCycles() jump straight into code that was compiled
+     * for that profile, with every quirk decided at compile time.
      */
-    uint16_t opcode;
+    QuirkProfile quirkProfile;
+    void (Chip8::*cycleEngine)();
+    uint32_t (Chip8::*runEngine)(uint32_t);
+
+    /*
+     * Random Number State (xorshift32) for CXNN
+     * - Kept inside the emulator (not a global generator) so two machines
+     *   with the same seed and inputs always produce the same run
+     * - Must never be 0 (xorshift would get stuck there)
+     */
+    uint32_t rngState;
+    static constexpr uint32_t DEFAULT_RNG_SEED = 0x2545F491;
+
+    /*
+     * Attached debugger, or nullptr
+     * Only the debug engines (debugCycle/runDebugCyclesFor) read it, so
+     * a release run never even loads this pointer.
+     */
+    Debugger* debugger;
+    TraceWriter* tracer;  // Same deal: only the debug engines read it
+
+    /*
+     * Compiled ROM, or nullptr
+     * compiledEntry maps every address covered by a compiled block to
+     * that block (nullptr = interpret). Stores that hit compiled code
+     * clear the blocks they touch, so the table is also the "is this
+     * byte compiled code?" test.
+     */
+    friend struct CompiledRomAccess;
+    const CompiledRom* compiledRom;
+    std::vector<const CompiledBlock*> compiledEntry;
+    bool compiledRomsEnabled;
+    
+    // Diagnostics, not machine state (not saved, not hashed)
+    uint32_t unknownOpcodeCount;
+    uint16_t lastUnknownOpcode;
 
     // Private helper functions for opcode execution
     // (We'll implement these in chip8.cpp)
+    template <typename Quirks>
+    void selectEngines();  // Point cycleEngine/runEngine at this profile
+    
+    template <typename Quirks>
     void executeOpcode();  // Decode and execute current opcode
+    
+    template <typename Quirks>
+    void cycle();          // Fetch + executeOpcode<Quirks>()
+    
+    template <typename Quirks>
+    uint32_t runCyclesFor(uint32_t count);  // Tight loop over cycle<Quirks>()
+    
+    template <typename Quirks>
+    void debugCycle();     // Debugger check, then tracedCycle<Quirks>()
+    
+    template <typename Quirks>
+    uint32_t runDebugCyclesFor(uint32_t count);  // Stops at breakpoints
+    
+    template <typename Quirks>
+    void tracedCycle();    // cycle<Quirks>(), recorded if a tracer is attached
+    
+    template <typename Quirks>
+    void compiledCycle();  // cycle<Quirks>(), then drop overwritten compiled code
+    
+    template <typename Quirks>
+    uint32_t runCompiledFor(uint32_t count);  // Compiled blocks, interpreter in between
+    
+    void selectEnginesForProfile();  // selectEngines<> for quirkProfile
+    void attachCompiledRom(std::size_t romSize);  // Look up the ROM just loaded
+    void reattachCompiledRom();        // After loadState(): keep the blocks memory still holds
+    std::size_t mapCompiledBlocks();   // compiledEntry for matching blocks, returns their count
+    bool checkCodeWrite(uint16_t storeOpcode, uint16_t index);  // Store hit compiled code?
+    
+    uint8_t nextRandom();  // Next xorshift32 byte
+    
+    // Memory for a profile: the inline 4KB array or the XO-CHIP 64KB buffer
+    template <typename Quirks>
+    uint8_t* ramFor() {
+        return Quirks::MEMORY_SIZE > MEMORY_SIZE ? extendedMemory.data() : memory.data();
+    }
+    // Guest address -> array index (0xFFF, or 0xFFFF for XO-CHIP)
+    template <typename Quirks>
+    static constexpr uint16_t addressMask() {
+        static_assert((Quirks::MEMORY_SIZE & (Quirks::MEMORY_SIZE - 1)) == 0,
+                      "address masking needs a power-of-two memory size");
+        return static_cast<uint16_t>(Quirks::MEMORY_SIZE - 1);
+    }
+    uint8_t* activeMemory();           // Same, for the selected profile
+    const uint8_t* activeMemory() const;
+    std::size_t activeMemorySize() const;
+    
+    // Bytes a taken skip jumps over (XO-CHIP skips F000 NNNN as one instruction)
+    template <typename Quirks>
+    uint16_t skipLength();
+    
+    // Plane 0 is display; planes 1-3 live in extraPlanes
+    uint64_t* planeData(int plane) {
+        return plane == 0 ? display.data() : &extraPlanes[(plane - 1) * PLANE_WORDS];
+    }
+    
+    // DXYN kernel: XOR a sprite into one plane, returns true on collision
+    // (height 0 draws a 16x16 sprite). hash is the plane's running hash.
+    template <bool WrapSprites>
+    bool drawSprite(uint64_t* plane, uint64_t& hash, int slotBase,
+                    const uint8_t* sprite, uint8_t x, uint8_t y, uint8_t height);
+    
+    // DXYN over every plane selected by planeMask
+    template <typename Quirks>
+    bool drawSprites(uint8_t x, uint8_t y, uint8_t height);
+    
+    // SUPER-CHIP / XO-CHIP screen operations on the selected planes
+    // (00CN, 00DN, 00FB, 00FC, 00FE/00FF)
+    void scrollDown(int rows);
+    void scrollUp(int rows);
+    void scrollRight(int pixels);
+    void scrollLeft(int pixels);
+    void setHighResolution(bool enabled);
+    void clearDisplay();               // Blank every plane, all rows dirty
+    void clearPlanes(uint8_t mask);    // 00E0: blank the selected planes
+    void rehashDisplay();              // Recompute now, all rows dirty (loadState)
+    void displayMoved();               // After a scroll: hash stale, all rows dirty
+    void refreshDisplayHash() const;   // Recompute both display hashes
+    
+    // Memory hash contribution of one byte (0 for a zero byte)
+    static constexpr uint64_t memoryByteHash(std::size_t index, uint8_t value) {
+        return value != 0 ? hashSlot(MEMORY_HASH_SLOT + index, value) : 0;
+    }
+    // Guest memory write (ram = ramFor<Quirks>()); keeps memoryHash current
+    void storeByte(uint8_t* ram, std::size_t index, uint8_t value) {
+        memoryHash ^= memoryByteHash(index, ram[index]) ^ memoryByteHash(index, value);
+        ram[index] = value;
+    }
+    // memoryHash right after reset(): the fonts are the only non-zero bytes
+    static constexpr uint64_t resetMemoryHash() {
+        uint64_t h = 0;
+        for (int i = 0; i < FONTSET_SIZE; ++i) {
+            h ^= memoryByteHash(i, fontset[i]);
+        }
+        for (int i = 0; i < BIG_FONTSET_SIZE; ++i) {
+            h ^= memoryByteHash(BIG_FONT_ADDRESS + i, bigFontset[i]);
+        }
+        return h;
+    }
+    // XOR of memoryByteHash over ram[start, start + size); calling it before
+    // and after a bulk write swaps the old bytes' contribution for the new
+    static uint64_t hashMemoryRange(const uint8_t* ram, std::size_t start, std::size_t size);
+    void rehashMemory();               // Full recompute (leaving XO-CHIP, checks)
+    
+    // Every unknown-opcode path lands here instead of printing
+    void countUnknownOpcode() {
+        ++unknownOpcodeCount;
+        lastUnknownOpcode = opcode;
+    }
+    
+    // Save state layout: header, then every field visitState() visits
+    static constexpr uint32_t STATE_MAGIC = 0x56533843;  // "C8SV"
+    static constexpr uint8_t STATE_VERSION = 2;   // 2: memory hash saved
+    static constexpr std::size_t STATE_HEADER_SIZE = 8;
+    template <typename Self, typename Visit>
+    static void visitState(Self& self, Visit&& visit);
 };
 
 #endif // CHIP8_H
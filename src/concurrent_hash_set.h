@@ -0,0 +1,102 @@
+#ifndef CONCURRENT_HASH_SET_H
+#define CONCURRENT_HASH_SET_H
+
+#include <atomic>   // For lock-free slots and the count
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+#include <memory>   // For the slot array
+
+/*
+ * Concurrent Hash Set of 64-bit Hashes
+ *
+ * A fixed-size set that any number of threads can insert into and query
+ * at the same time without locks, for "have we seen this state before?"
+ * (see explorer.h). The keys are already hashes, so they are used as
+ * table positions directly.
+ *
+ * HOW IT WORKS:
+ * - Open addressing with linear probing over an array of atomic slots
+ * - 0 marks an empty slot; a key of 0 is stored as 1 instead (one
+ *   collision in 2^64, the same odds as any other pair of hashes)
+ * - insert() claims an empty slot with one compare-and-swap. If another
+ *   thread claimed it first, the CAS hands back the winner's key: the
+ *   same key means "already present", anything else means keep probing
+ * - Keys are never removed, so a slot only ever changes once (0 -> key)
+ *   and no thread can see a half-finished entry
+ *
+ * SIZE:
+ * The capacity is fixed at construction (rounded up to a power of two,
+ * 8 bytes per slot). Probing gets slow as the table fills, so inserts
+ * report Full once 3/4 of the slots are taken; the caller decides what
+ * to do (the explorer stops keeping new states).
+ */
+class ConcurrentHashSet {
+public:
+    enum class Insert { Added, Present, Full };
+
+    explicit ConcurrentHashSet(std::size_t capacity) : mask(1), count(0) {
+        while (mask < capacity) {
+            mask <<= 1;
+        }
+        limit = mask / 4 * 3;
+        slots.reset(new std::atomic<uint64_t>[mask]);
+        for (std::size_t i = 0; i < mask; ++i) {
+            slots[i].store(0, std::memory_order_relaxed);
+        }
+        mask -= 1;
+    }
+
+    ConcurrentHashSet(const ConcurrentHashSet&) = delete;
+    ConcurrentHashSet& operator=(const ConcurrentHashSet&) = delete;
+
+    Insert insert(uint64_t key) {
+        key = key != 0 ? key : 1;
+        for (std::size_t i = key & mask;; i = (i + 1) & mask) {
+            uint64_t slot = slots[i].load(std::memory_order_relaxed);
+            if (slot == key) {
+                return Insert::Present;
+            }
+            if (slot != 0) {
+                continue;
+            }
+            // Reserve room first, so the table never fills up completely
+            // and an unsuccessful probe always ends at an empty slot
+            if (count.fetch_add(1, std::memory_order_relaxed) >= limit) {
+                count.fetch_sub(1, std::memory_order_relaxed);
+                return Insert::Full;
+            }
+            if (slots[i].compare_exchange_strong(slot, key, std::memory_order_relaxed)) {
+                return Insert::Added;
+            }
+            count.fetch_sub(1, std::memory_order_relaxed);   // Lost the race for this slot
+            if (slot == key) {
+                return Insert::Present;
+            }
+        }
+    }
+
+    bool contains(uint64_t key) const {
+        key = key != 0 ? key : 1;
+        for (std::size_t i = key & mask;; i = (i + 1) & mask) {
+            uint64_t slot = slots[i].load(std::memory_order_relaxed);
+            if (slot == key) {
+                return true;
+            }
+            if (slot == 0) {
+                return false;
+            }
+        }
+    }
+
+    // Exact once the inserting threads are done, approximate before
+    std::size_t size() const { return count.load(std::memory_order_relaxed); }
+    std::size_t capacity() const { return mask + 1; }
+
+private:
+    std::unique_ptr<std::atomic<uint64_t>[]> slots;
+    std::size_t mask;
+    std::size_t limit;                  // Inserts past this many report Full
+    alignas(64) std::atomic<std::size_t> count;
+};
+
+#endif // CONCURRENT_HASH_SET_H
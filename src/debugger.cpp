@@ -0,0 +1,310 @@
+#include "debugger.h"
+#include <cstdio>     // For snprintf
+#include <cstdlib>    // For strtol
+
+/*
+ * Memory Access of an Opcode
+ *
+ * Decodes the I-relative memory range an instruction will touch:
+ *   DXYN         read   N bytes (32 for a 16x16 DXY0), per selected
+ *                       plane on XO-CHIP
+ *   FX33         write  3 bytes (BCD)
+ *   FX55 / FX65  write / read  X + 1 bytes
+ *   5XY2 / 5XY3  write / read  |X - Y| + 1 bytes (XO-CHIP)
+ *   F002         read   16 bytes (XO-CHIP audio pattern)
+ *
+ * @return: false if the opcode does not access memory through I
+ */
+bool memoryAccessOf(const Chip8& chip8, uint16_t opcode, uint16_t& start,
+                    uint16_t& length, WatchAccess& access) {
+    const QuirkProfile profile = chip8.getQuirkProfile();
+    const bool superChip = profile == QuirkProfile::SuperChip || profile == QuirkProfile::XoChip;
+    const bool xoChip = profile == QuirkProfile::XoChip;
+    const uint8_t X = (opcode & 0x0F00) >> 8;
+    const uint8_t Y = (opcode & 0x00F0) >> 4;
+    const uint8_t N = opcode & 0x000F;
+    const uint8_t NN = opcode & 0x00FF;
+
+    start = chip8.getI() & static_cast<uint16_t>(chip8.getMemorySize() - 1);   // Same mask as the core
+    length = 0;
+
+    switch (opcode & 0xF000) {
+        case 0xD000: {
+            int bytes = (N == 0) ? (superChip ? 32 : 0) : N;
+            if (xoChip) {
+                int planes = 0;
+                for (uint8_t mask = chip8.getPlaneMask(); mask != 0; mask >>= 1) {
+                    planes += mask & 1;
+                }
+                bytes *= planes;
+            }
+            length = static_cast<uint16_t>(bytes);
+            access = WatchAccess::Read;
+            break;
+        }
+
+        case 0x5000:
+            if (xoChip && (N == 0x2 || N == 0x3)) {
+                length = static_cast<uint16_t>((X <= Y ? Y - X : X - Y) + 1);
+                access = (N == 0x2) ? WatchAccess::Write : WatchAccess::Read;
+            }
+            break;
+
+        case 0xF000:
+            if (NN == 0x33) {
+                length = 3;
+                access = WatchAccess::Write;
+            } else if (NN == 0x55 || NN == 0x65) {
+                length = static_cast<uint16_t>(X + 1);
+                access = (NN == 0x55) ? WatchAccess::Write : WatchAccess::Read;
+            } else if (xoChip && opcode == 0xF002) {
+                length = 16;
+                access = WatchAccess::Read;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return length != 0;
+}
+
+int Debugger::addWatchpoint(uint16_t address, uint16_t length, WatchAccess access) {
+    watchpoints.push_back({address, length == 0 ? uint16_t{1} : length, access});
+    return static_cast<int>(watchpoints.size()) - 1;
+}
+
+int Debugger::addCondition(int reg, CompareOp op, uint16_t value) {
+    conditions.push_back({reg, op, value, false});
+    return static_cast<int>(conditions.size()) - 1;
+}
+
+void Debugger::clear() {
+    breakpoints.reset();
+    watchpoints.clear();
+    conditions.clear();
+    broken = false;
+    skipArmed = false;
+}
+
+/*
+ * Check (called before every instruction by the debug engines)
+ *
+ * @return: true to stop before the instruction at PC
+ *
+ * Order: breakpoints, then watchpoints, then conditions. Conditions are
+ * evaluated every time (even when something else stops first) so their
+ * "was it true last time" state never goes stale.
+ */
+bool Debugger::check(const Chip8& chip8) {
+    const uint16_t pc = chip8.getPC() & static_cast<uint16_t>(chip8.getMemorySize() - 1);   // Bus address
+    const bool skip = skipArmed && chip8.getPC() == skipAddress;
+    skipArmed = false;
+
+    int firedCondition = -1;
+    for (std::size_t i = 0; i < conditions.size(); ++i) {
+        Condition& c = conditions[i];
+        uint16_t current = (c.reg == REGISTER_I) ? chip8.getI() : chip8.getV(c.reg);
+        bool now = false;
+        switch (c.op) {
+            case CompareOp::Equal:    now = current == c.value; break;
+            case CompareOp::NotEqual: now = current != c.value; break;
+            case CompareOp::Less:     now = current < c.value;  break;
+            case CompareOp::Greater:  now = current > c.value;  break;
+        }
+        if (now && !c.wasTrue && firedCondition < 0) {
+            firedCondition = static_cast<int>(i);
+        }
+        c.wasTrue = now;
+    }
+
+    if (skip) {
+        return false;  // Resuming from a stop at this instruction
+    }
+
+    if (breakpoints.test(pc)) {
+        stop(chip8, BreakReason::Breakpoint, -1);
+        return true;
+    }
+
+    if (!watchpoints.empty()) {
+        uint16_t start;
+        uint16_t length;
+        WatchAccess access;
+        if (memoryAccessOf(chip8, chip8.peekOpcode(), start, length, access)) {
+            // Ranges [start, start + length) and [w, w + w.length) overlap?
+            uint32_t end = uint32_t{start} + length;
+            for (std::size_t i = 0; i < watchpoints.size(); ++i) {
+                const Watchpoint& w = watchpoints[i];
+                uint32_t watchEnd = uint32_t{w.address} + w.length;
+                bool overlaps = start < watchEnd && w.address < end;
+                bool kindMatches = (static_cast<uint8_t>(w.access) & static_cast<uint8_t>(access)) != 0;
+                if (overlaps && kindMatches) {
+                    stop(chip8, BreakReason::Watchpoint, static_cast<int>(i));
+                    event.address = start > w.address ? start : w.address;
+                    event.access = access;
+                    return true;
+                }
+            }
+        }
+    }
+
+    if (firedCondition >= 0) {
+        stop(chip8, BreakReason::Condition, firedCondition);
+        return true;
+    }
+
+    return false;
+}
+
+void Debugger::stop(const Chip8& chip8, BreakReason reason, int index) {
+    broken = true;
+    event = BreakEvent();
+    event.reason = reason;
+    event.pc = chip8.getPC();
+    event.opcode = chip8.peekOpcode();
+    event.index = index;
+}
+
+/*
+ * Resume after a stop: the stopped instruction runs once unchecked
+ */
+void Debugger::resume() {
+    if (broken) {
+        skipArmed = true;
+        skipAddress = event.pc;
+    }
+    broken = false;
+}
+
+/*
+ * Parse a Condition
+ *
+ * Format: <register><op><value>
+ *   register: V0-VF or I
+ *   op:       ==, !=, <, >
+ *   value:    decimal or 0x-prefixed hex
+ * Examples: "V3==10", "VF!=0", "I>0x300"
+ */
+bool Debugger::parseCondition(const std::string& text, int& reg, CompareOp& op, uint16_t& value) {
+    std::size_t pos = 0;
+    if (text.size() >= 2 && (text[0] == 'V' || text[0] == 'v')) {
+        char digit = text[1];
+        if (digit >= '0' && digit <= '9') {
+            reg = digit - '0';
+        } else if (digit >= 'A' && digit <= 'F') {
+            reg = digit - 'A' + 10;
+        } else if (digit >= 'a' && digit <= 'f') {
+            reg = digit - 'a' + 10;
+        } else {
+            return false;
+        }
+        pos = 2;
+    } else if (!text.empty() && (text[0] == 'I' || text[0] == 'i')) {
+        reg = REGISTER_I;
+        pos = 1;
+    } else {
+        return false;
+    }
+
+    std::string rest = text.substr(pos);
+    std::size_t opLength = 1;
+    if (rest.compare(0, 2, "==") == 0) {
+        op = CompareOp::Equal;
+        opLength = 2;
+    } else if (rest.compare(0, 2, "!=") == 0) {
+        op = CompareOp::NotEqual;
+        opLength = 2;
+    } else if (rest.compare(0, 1, "<") == 0) {
+        op = CompareOp::Less;
+    } else if (rest.compare(0, 1, ">") == 0) {
+        op = CompareOp::Greater;
+    } else {
+        return false;
+    }
+
+    std::string number = rest.substr(opLength);
+    char* end = nullptr;
+    long parsed = std::strtol(number.c_str(), &end, 0);
+    if (number.empty() || *end != '\0' || parsed < 0 || parsed > 0xFFFF) {
+        return false;
+    }
+    value = static_cast<uint16_t>(parsed);
+    return true;
+}
+
+/*
+ * Parse a Watchpoint
+ *
+ * Format: <address>[:<length>][:r|w|rw]   (default length 1, access rw)
+ * Examples: "0x300", "0x300:16", "0x300:16:w"
+ */
+bool Debugger::parseWatchpoint(const std::string& text, uint16_t& address, uint16_t& length,
+                               WatchAccess& access) {
+    char* end = nullptr;
+    long parsed = std::strtol(text.c_str(), &end, 0);
+    if (end == text.c_str() || parsed < 0 || parsed > 0xFFFF) {
+        return false;
+    }
+    address = static_cast<uint16_t>(parsed);
+    length = 1;
+    access = WatchAccess::ReadWrite;
+
+    if (*end == ':') {
+        const char* lengthText = end + 1;
+        parsed = std::strtol(lengthText, &end, 0);
+        if (end == lengthText || parsed <= 0 || parsed > 0xFFFF) {
+            return false;
+        }
+        length = static_cast<uint16_t>(parsed);
+    }
+
+    if (*end == ':') {
+        std::string kind = end + 1;
+        if (kind == "r") {
+            access = WatchAccess::Read;
+        } else if (kind == "w") {
+            access = WatchAccess::Write;
+        } else if (kind != "rw") {
+            return false;
+        }
+    } else if (*end != '\0') {
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Describe the last stop and the machine state, one line each
+ */
+std::string Debugger::describe(const Chip8& chip8) const {
+    static const char* const reasons[] = {"none", "breakpoint", "watchpoint", "condition"};
+    char buffer[160];
+    std::string text;
+
+    std::snprintf(buffer, sizeof(buffer), "%s at 0x%03X (opcode %04X)",
+                  reasons[static_cast<int>(event.reason)], event.pc, event.opcode);
+    text += buffer;
+    if (event.reason == BreakReason::Watchpoint) {
+        std::snprintf(buffer, sizeof(buffer), ", %s of 0x%03X (watch #%d)",
+                      event.access == WatchAccess::Write ? "write" : "read",
+                      event.address, event.index);
+        text += buffer;
+    } else if (event.reason == BreakReason::Condition) {
+        std::snprintf(buffer, sizeof(buffer), " (condition #%d)", event.index);
+        text += buffer;
+    }
+    text += "\n";
+
+    std::snprintf(buffer, sizeof(buffer), "PC=%03X I=%03X SP=%X DT=%02X ST=%02X\n",
+                  chip8.getPC(), chip8.getI(), chip8.getSP(),
+                  chip8.getDelayTimer(), chip8.getSoundTimer());
+    text += buffer;
+    for (int r = 0; r < Chip8::REGISTER_COUNT; ++r) {
+        std::snprintf(buffer, sizeof(buffer), "V%X=%02X%c", r, chip8.getV(r),
+                      r + 1 < Chip8::REGISTER_COUNT ? ' ' : '\n');
+        text += buffer;
+    }
+    return text;
+}
@@ -0,0 +1,134 @@
+#ifndef DEBUGGER_H
+#define DEBUGGER_H
+
+#include "chip8.h"
+#include <bitset>   // For the per-address breakpoint bitmap
+#include <cstdint>  // For fixed-width integer types
+#include <string>   // For parsing and describing breakpoints
+#include <vector>   // For watchpoints and conditions
+
+/*
+ * CHIP-8 Debugger
+ *
+ * Three ways to stop a running program, all checked BEFORE an
+ * instruction executes (so the state you see is the state at the stop):
+ *
+ * 1. BREAKPOINTS: stop when PC reaches an address
+ *      One bit per address in a 64K bitmap (8KB), so the check is a
+ *      single bit test no matter how many breakpoints are set.
+ *
+ * 2. WATCHPOINTS: stop when an instruction will read or write a memory
+ *    range. CHIP-8 only touches memory through I (DXYN, FX33, FX55,
+ *    FX65, and XO-CHIP 5XY2/5XY3/F002), so the debugger decodes the
+ *    next opcode, works out the I-relative range it accesses and
+ *    compares it against each watchpoint.
+ *
+ * 3. CONDITIONS: stop when a register comparison becomes true
+ *    (e.g. "V3 == 10", "I > 0x300"). Only the false -> true change
+ *    stops, otherwise a condition that stays true would stop on every
+ *    instruction.
+ *
+ * BUS ADDRESSES:
+ * The core masks PC and I to the memory size (4KB, or 64KB on XO-CHIP),
+ * and so does the debugger: a breakpoint at 0x300 also stops at PC
+ * 0x1300, and a watchpoint on 0x300 sees FX55 with I = 0x1300.
+ *
+ * ZERO COST WHEN UNUSED:
+ * Chip8 only calls check() from its debug engines, which are selected by
+ * attachDebugger(). Without an attached debugger the release engines run,
+ * and they contain no debugger code at all.
+ *
+ * RESUMING:
+ * After a stop, resume() lets the instruction at the stop address run
+ * once without stopping again, then all checks apply as before.
+ */
+
+enum class WatchAccess : uint8_t {
+    Read = 1,
+    Write = 2,
+    ReadWrite = 3
+};
+
+enum class CompareOp : uint8_t {
+    Equal,
+    NotEqual,
+    Less,
+    Greater
+};
+
+enum class BreakReason : uint8_t {
+    None,
+    Breakpoint,
+    Watchpoint,
+    Condition
+};
+
+// What stopped the program
+struct BreakEvent {
+    BreakReason reason = BreakReason::None;
+    uint16_t pc = 0;           // Address of the instruction not yet run
+    uint16_t opcode = 0;       // That instruction
+    uint16_t address = 0;      // Watchpoint: first accessed address
+    WatchAccess access = WatchAccess::Read;  // Watchpoint: kind of access
+    int index = -1;            // Watchpoint/condition number
+};
+
+class Debugger {
+public:
+    static constexpr int REGISTER_I = 16;  // Condition target for I (0-15 = V0-VF)
+
+    // Breakpoints
+    void addBreakpoint(uint16_t address) { breakpoints.set(address); }
+    void removeBreakpoint(uint16_t address) { breakpoints.reset(address); }
+    bool hasBreakpoint(uint16_t address) const { return breakpoints.test(address); }
+
+    // Watchpoints and conditions return their index (used in BreakEvent)
+    int addWatchpoint(uint16_t address, uint16_t length, WatchAccess access);
+    int addCondition(int reg, CompareOp op, uint16_t value);
+    void clear();
+
+    // Called by Chip8's debug engines before each instruction
+    bool check(const Chip8& chip8);
+
+    // Break state
+    bool hasBreak() const { return broken; }
+    const BreakEvent& lastBreak() const { return event; }
+    void resume();
+
+    // Text helpers for command-line front ends
+    static bool parseCondition(const std::string& text, int& reg, CompareOp& op, uint16_t& value);
+    static bool parseWatchpoint(const std::string& text, uint16_t& address, uint16_t& length,
+                                WatchAccess& access);
+    std::string describe(const Chip8& chip8) const;
+
+private:
+    struct Watchpoint {
+        uint16_t address;
+        uint16_t length;
+        WatchAccess access;
+    };
+
+    struct Condition {
+        int reg;
+        CompareOp op;
+        uint16_t value;
+        bool wasTrue;          // For the false -> true edge
+    };
+
+    std::bitset<65536> breakpoints;
+    std::vector<Watchpoint> watchpoints;
+    std::vector<Condition> conditions;
+
+    BreakEvent event;
+    bool broken = false;
+    bool skipArmed = false;    // Let the instruction at skipAddress run once
+    uint16_t skipAddress = 0;
+
+    void stop(const Chip8& chip8, BreakReason reason, int index);
+};
+
+// Memory range an opcode reads or writes through I (false if none)
+bool memoryAccessOf(const Chip8& chip8, uint16_t opcode, uint16_t& start,
+                    uint16_t& length, WatchAccess& access);
+
+#endif // DEBUGGER_H
@@ -0,0 +1,166 @@
+#include "disassembler.h"
+
+/*
+ * Opcode Patterns, grouped by first nibble (most specific first)
+ */
+static constexpr OpcodeInfo OPCODES[] = {
+    // 0x0: system, screen and SUPER-CHIP / XO-CHIP extensions
+    {0xFFFF, 0x00E0, "CLS", 2},
+    {0xFFFF, 0x00EE, "RET", 2},
+    {0xFFFF, 0x00FB, "SCR", 2},
+    {0xFFFF, 0x00FC, "SCL", 2},
+    {0xFFFF, 0x00FD, "EXIT", 2},
+    {0xFFFF, 0x00FE, "LOW", 2},
+    {0xFFFF, 0x00FF, "HIGH", 2},
+    {0xFFF0, 0x00C0, "SCD %n", 2},
+    {0xFFF0, 0x00D0, "SCU %n", 2},
+    {0xF000, 0x0000, "SYS %a", 2},
+    // 0x1 - 0x4: jumps, calls, immediate skips
+    {0xF000, 0x1000, "JP %a", 2},
+    {0xF000, 0x2000, "CALL %a", 2},
+    {0xF000, 0x3000, "SE V%x, %b", 2},
+    {0xF000, 0x4000, "SNE V%x, %b", 2},
+    // 0x5: register skip, XO-CHIP range save/load
+    {0xF00F, 0x5000, "SE V%x, V%y", 2},
+    {0xF00F, 0x5002, "SAVE V%x - V%y", 2},
+    {0xF00F, 0x5003, "LOAD V%x - V%y", 2},
+    // 0x6 - 0x7: immediates
+    {0xF000, 0x6000, "LD V%x, %b", 2},
+    {0xF000, 0x7000, "ADD V%x, %b", 2},
+    // 0x8: ALU
+    {0xF00F, 0x8000, "LD V%x, V%y", 2},
+    {0xF00F, 0x8001, "OR V%x, V%y", 2},
+    {0xF00F, 0x8002, "AND V%x, V%y", 2},
+    {0xF00F, 0x8003, "XOR V%x, V%y", 2},
+    {0xF00F, 0x8004, "ADD V%x, V%y", 2},
+    {0xF00F, 0x8005, "SUB V%x, V%y", 2},
+    {0xF00F, 0x8006, "SHR V%x, V%y", 2},
+    {0xF00F, 0x8007, "SUBN V%x, V%y", 2},
+    {0xF00F, 0x800E, "SHL V%x, V%y", 2},
+    // 0x9 - 0xD
+    {0xF00F, 0x9000, "SNE V%x, V%y", 2},
+    {0xF000, 0xA000, "LD I, %a", 2},
+    {0xF000, 0xB000, "JP V0, %a", 2},
+    {0xF000, 0xC000, "RND V%x, %b", 2},
+    {0xF000, 0xD000, "DRW V%x, V%y, %n", 2},
+    // 0xE: keys
+    {0xF0FF, 0xE09E, "SKP V%x", 2},
+    {0xF0FF, 0xE0A1, "SKNP V%x", 2},
+    // 0xF: timers, memory, fonts, XO-CHIP
+    {0xFFFF, 0xF000, "LD I, %w", 4},
+    {0xFFFF, 0xF002, "AUDIO", 2},
+    {0xF0FF, 0xF001, "PLANE %x", 2},
+    {0xF0FF, 0xF007, "LD V%x, DT", 2},
+    {0xF0FF, 0xF00A, "LD V%x, K", 2},
+    {0xF0FF, 0xF015, "LD DT, V%x", 2},
+    {0xF0FF, 0xF018, "LD ST, V%x", 2},
+    {0xF0FF, 0xF01E, "ADD I, V%x", 2},
+    {0xF0FF, 0xF029, "LD F, V%x", 2},
+    {0xF0FF, 0xF030, "LD HF, V%x", 2},
+    {0xF0FF, 0xF033, "LD B, V%x", 2},
+    {0xF0FF, 0xF03A, "PITCH V%x", 2},
+    {0xF0FF, 0xF055, "LD [I], V%x", 2},
+    {0xF0FF, 0xF065, "LD V%x, [I]", 2},
+    {0xF0FF, 0xF075, "LD R, V%x", 2},
+    {0xF0FF, 0xF085, "LD V%x, R", 2},
+};
+
+static constexpr std::size_t OPCODE_COUNT = sizeof(OPCODES) / sizeof(OPCODES[0]);
+
+/*
+ * Nibble Index: first pattern and pattern count for each first nibble
+ *
+ * Built at compile time from OPCODES, so adding a pattern only means
+ * adding a line above (the static_assert catches a misplaced one).
+ */
+struct NibbleRange {
+    uint8_t first;
+    uint8_t count;
+};
+
+static constexpr std::array<NibbleRange, 16> buildNibbleIndex() {
+    std::array<NibbleRange, 16> index = {};
+    for (std::size_t i = 0; i < OPCODE_COUNT; ++i) {
+        int nibble = OPCODES[i].value >> 12;
+        if (index[nibble].count == 0) {
+            index[nibble].first = static_cast<uint8_t>(i);
+        }
+        ++index[nibble].count;
+    }
+    return index;
+}
+
+static constexpr bool groupsAreContiguous() {
+    for (std::size_t i = 1; i < OPCODE_COUNT; ++i) {
+        if ((OPCODES[i].value >> 12) < (OPCODES[i - 1].value >> 12)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(groupsAreContiguous(), "OPCODES must be sorted by first nibble");
+static constexpr std::array<NibbleRange, 16> NIBBLE_INDEX = buildNibbleIndex();
+
+const OpcodeInfo* decodeOpcode(uint16_t opcode) {
+    const NibbleRange range = NIBBLE_INDEX[opcode >> 12];
+    for (int i = range.first; i < range.first + range.count; ++i) {
+        if ((opcode & OPCODES[i].mask) == OPCODES[i].value) {
+            return &OPCODES[i];
+        }
+    }
+    return nullptr;
+}
+
+int instructionLength(uint16_t opcode) {
+    return opcode == 0xF000 ? 4 : 2;
+}
+
+// Appends hex digits of value (digits wide) to out
+static void putHex(char*& out, char* end, uint32_t value, int digits) {
+    static const char HEX[] = "0123456789ABCDEF";
+    for (int shift = (digits - 1) * 4; shift >= 0 && out < end; shift -= 4) {
+        *out++ = HEX[(value >> shift) & 0xF];
+    }
+}
+
+static void putText(char*& out, char* end, const char* text) {
+    while (*text != '\0' && out < end) {
+        *out++ = *text++;
+    }
+}
+
+std::size_t disassemble(uint16_t opcode, uint16_t nextWord, char* out, std::size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    char* cursor = out;
+    char* end = out + size - 1;  // Room for the terminator
+
+    const OpcodeInfo* info = decodeOpcode(opcode);
+    if (info == nullptr) {
+        putText(cursor, end, "DW 0x");
+        putHex(cursor, end, opcode, 4);
+        *cursor = '\0';
+        return static_cast<std::size_t>(cursor - out);
+    }
+
+    for (const char* f = info->format; *f != '\0' && cursor < end; ++f) {
+        if (*f != '%') {
+            *cursor++ = *f;
+            continue;
+        }
+        switch (*++f) {
+            case 'x': putHex(cursor, end, (opcode >> 8) & 0xF, 1); break;
+            case 'y': putHex(cursor, end, (opcode >> 4) & 0xF, 1); break;
+            case 'n': putHex(cursor, end, opcode & 0xF, 1); break;
+            case 'b': putText(cursor, end, "0x"); putHex(cursor, end, opcode & 0xFF, 2); break;
+            case 'a': putText(cursor, end, "0x"); putHex(cursor, end, opcode & 0xFFF, 3); break;
+            case 'w': putText(cursor, end, "0x"); putHex(cursor, end, nextWord, 4); break;
+            default: --f; break;  // Lone '%' at the end of a format
+        }
+    }
+
+    *cursor = '\0';
+    return static_cast<std::size_t>(cursor - out);
+}
@@ -0,0 +1,49 @@
+#ifndef DISASSEMBLER_H
+#define DISASSEMBLER_H
+
+#include <array>    // For the opcode tables
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+
+/*
+ * CHIP-8 Disassembler
+ *
+ * Turns opcodes into mnemonics (Cowgod's naming, plus the SUPER-CHIP and
+ * XO-CHIP extensions), e.g. 0xD125 -> "DRW V1, V2, 5".
+ *
+ * TABLE-DRIVEN DECODING:
+ * Every instruction is a (mask, value) pattern: opcode & mask == value.
+ * Patterns are grouped by their first nibble, and a 16-entry index
+ * (built at compile time) points at each group, so decoding is:
+ *
+ *     group = index[opcode >> 12];          // 1 lookup
+ *     scan group for the first match        // at most 16 patterns (0xF)
+ *
+ * Within a group the most specific patterns come first (00E0 before
+ * 0NNN). No strings are built while decoding; formatting writes straight
+ * into a caller buffer, so tools can disassemble millions of trace
+ * records without allocating.
+ *
+ * FORMAT PLACEHOLDERS:
+ *   %x  X nibble      %y  Y nibble      %n  N nibble
+ *   %b  NN (0xNN)     %a  NNN (0xNNN)   %w  next word (0xNNNN, F000 only)
+ */
+
+struct OpcodeInfo {
+    uint16_t mask;
+    uint16_t value;
+    const char* format;
+    uint8_t length;     // Bytes (4 for F000 NNNN, otherwise 2)
+};
+
+// Pattern for opcode, or nullptr if no CHIP-8 variant defines it
+const OpcodeInfo* decodeOpcode(uint16_t opcode);
+
+// Instruction length in bytes (2, or 4 for XO-CHIP F000 NNNN)
+int instructionLength(uint16_t opcode);
+
+// Writes the mnemonic (NUL-terminated, truncated to size) and returns its
+// length. Unknown opcodes come out as "DW 0xNNNN".
+std::size_t disassemble(uint16_t opcode, uint16_t nextWord, char* out, std::size_t size);
+
+#endif // DISASSEMBLER_H
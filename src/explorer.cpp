@@ -0,0 +1,279 @@
+#include "explorer.h"
+#include <algorithm>   // For partial_sort
+#include <atomic>      // For handing out children to workers
+#include <iostream>    // For errors
+#include <thread>      // For the workers
+
+constexpr std::size_t PC_SPACE = 65536;          // Every guest address (XO-CHIP)
+constexpr std::size_t PC_WORDS = PC_SPACE / 64;
+constexpr std::size_t CHILDREN_PER_CLAIM = 16;   // Work unit handed to a thread
+
+/*
+ * Per-thread scratch: a machine to run children on, and what this
+ * thread found during the current depth (merged after it)
+ */
+struct Explorer::Worker {
+    Chip8 machine;
+    std::vector<uint32_t> stamp = std::vector<uint32_t>(PC_SPACE, 0);   // Child that last counted each PC
+    uint32_t stampCounter = 0;
+    std::vector<uint64_t> fresh = std::vector<uint64_t>(PC_WORDS, 0);   // PCs beyond coverage
+    uint64_t duplicates = 0;
+    uint64_t halts = 0;
+    bool stateSetFull = false;
+};
+
+/*
+ * Constructor
+ *
+ * Builds the action list and one machine per thread, loads the ROM and
+ * makes its start state the whole first frontier.
+ */
+Explorer::Explorer(const uint8_t* rom, std::size_t romSize, const ExplorerConfig& config)
+    : config(config),
+      stateBytes(0),
+      goalNode(NO_NODE),
+      haltNode(NO_NODE),
+      seenStates(config.maxStates),
+      seenFramebuffers(config.maxStates / 4),
+      coverage(PC_WORDS, 0),
+      goals(PC_WORDS, 0),
+      exhausted(false),
+      loaded(false) {
+    actionKeys.push_back(0);
+    for (int a = 0; a < Chip8::KEY_COUNT; ++a) {
+        if (config.keys & (1u << a)) {
+            actionKeys.push_back(static_cast<uint16_t>(1u << a));
+        }
+    }
+    for (int a = 0; config.keyPairs && a < Chip8::KEY_COUNT; ++a) {
+        for (int b = a + 1; b < Chip8::KEY_COUNT; ++b) {
+            if ((config.keys & (1u << a)) && (config.keys & (1u << b))) {
+                actionKeys.push_back(static_cast<uint16_t>((1u << a) | (1u << b)));
+            }
+        }
+    }
+    for (uint16_t pc : config.goalPcs) {
+        goals[pc >> 6] |= uint64_t{1} << (pc & 63);
+    }
+
+    unsigned threads = config.threads != 0 ? config.threads : std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back(new Worker());
+        workers.back()->machine.setQuirkProfile(config.profile);
+    }
+
+    Chip8& first = workers.front()->machine;
+    first.reset();
+    if (!first.loadROM(rom, romSize)) {
+        std::cerr << "[ERROR] ROM does not fit in memory (" << romSize << " bytes)\n";
+        return;
+    }
+    first.seedRandom(config.seed);
+    stateBytes = first.stateSize();
+    frontierStates.resize(stateBytes);
+    first.saveState(frontierStates.data(), stateBytes);
+    seenStates.insert(first.getStateHash());
+    seenFramebuffers.insert(first.getFramebufferHash());
+    frontier.push_back(Node{NO_NODE, 0});
+    loaded = true;
+}
+
+Explorer::~Explorer() = default;
+
+/*
+ * Run work(worker, index) for every index below count on all workers.
+ * Threads claim CHILDREN_PER_CLAIM indices at a time from one counter,
+ * so a thread that gets quick children simply takes more.
+ */
+template <typename Work>
+void Explorer::parallelFor(std::size_t count, Work work) {
+    std::atomic<std::size_t> next(0);
+    auto run = [&](Worker& worker) {
+        for (;;) {
+            std::size_t begin = next.fetch_add(CHILDREN_PER_CLAIM, std::memory_order_relaxed);
+            if (begin >= count) {
+                return;
+            }
+            std::size_t end = std::min(count, begin + CHILDREN_PER_CLAIM);
+            for (std::size_t i = begin; i < end; ++i) {
+                work(worker, i);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    std::size_t helpers = std::min(workers.size(), (count + CHILDREN_PER_CLAIM - 1) / CHILDREN_PER_CLAIM);
+    for (std::size_t t = 1; t < helpers; ++t) {
+        threads.emplace_back(run, std::ref(*workers[t]));
+    }
+    run(*workers.front());   // The calling thread is worker 0
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+/*
+ * Run One Child
+ *
+ * Child c is action (c % actions) applied to frontier state
+ * (c / actions). Runs one instruction at a time so every executed PC
+ * can be counted (the same trade-off as chip8_fuzz's edge coverage).
+ *
+ * @param keepState: nullptr to score the child (phase 1), otherwise where
+ *                   to save its final state (phase 4, selected children)
+ */
+void Explorer::runChild(Worker& worker, std::size_t child, uint8_t* keepState) {
+    const std::size_t parent = child / actionKeys.size();
+    Chip8& chip8 = worker.machine;
+    chip8.loadState(&frontierStates[parent * stateBytes], stateBytes);
+    chip8.setKeys(actionKeys[child % actionKeys.size()]);
+
+    const uint32_t stamp = ++worker.stampCounter;
+    uint32_t newPcs = 0;
+    bool halted = false;
+    bool goal = false;
+    for (uint32_t frame = 0; frame < config.framesPerAction && !halted; ++frame) {
+        for (uint32_t cycle = 0; cycle < config.cyclesPerFrame; ++cycle) {
+            const uint16_t pc = chip8.getPC();
+            goal = goal || ((goals[pc >> 6] >> (pc & 63)) & 1);
+            // A jump to itself can never be left: the program is done
+            halted = chip8.hasExited() || (pc < 0x1000 && chip8.peekOpcode() == (0x1000 | pc));
+            if (halted || chip8.runCycles(1) == 0) {
+                break;   // Halted, or FX0A is waiting for a key
+            }
+            if (!((coverage[pc >> 6] >> (pc & 63)) & 1) && worker.stamp[pc] != stamp) {
+                worker.stamp[pc] = stamp;
+                worker.fresh[pc >> 6] |= uint64_t{1} << (pc & 63);
+                ++newPcs;
+            }
+        }
+        chip8.updateTimers();
+    }
+
+    if (keepState != nullptr) {
+        chip8.saveState(keepState, stateBytes);
+        return;
+    }
+
+    Child& result = children[child];
+    result.stateHash = chip8.getStateHash();   // O(1): no state copy for children that are dropped
+    result.framebufferHash = chip8.getFramebufferHash();
+    result.halted = halted;
+    result.goal = goal;
+    result.keep = false;
+    if (halted) {
+        ++worker.halts;
+    } else {
+        switch (seenStates.insert(result.stateHash)) {
+            case ConcurrentHashSet::Insert::Added:
+                result.keep = true;
+                break;
+            case ConcurrentHashSet::Insert::Present:
+                ++worker.duplicates;
+                break;
+            case ConcurrentHashSet::Insert::Full:
+                worker.stateSetFull = true;   // Cannot dedup any more; keep it anyway
+                result.keep = true;
+                break;
+        }
+    }
+    const bool newFramebuffer = !seenFramebuffers.contains(result.framebufferHash);
+    result.score = newPcs * 4 + (newFramebuffer ? 1 : 0) + frontier[parent].score / 2;
+}
+
+uint32_t Explorer::addPath(std::size_t child) {
+    path.push_back(PathStep{frontier[child / actionKeys.size()].path, actionKeys[child % actionKeys.size()]});
+    return static_cast<uint32_t>(path.size() - 1);
+}
+
+/*
+ * Step: expand, dedup, score and select one depth (see explorer.h)
+ */
+bool Explorer::step() {
+    if (!loaded || exhausted || goalReached()) {
+        return false;
+    }
+
+    // 1-3. Expand every frontier state by every action, in parallel
+    const std::size_t count = frontier.size() * actionKeys.size();
+    children.resize(count);
+    parallelFor(count, [this](Worker& worker, std::size_t child) { runChild(worker, child, nullptr); });
+
+    // Merge what the workers found, in child order (deterministic)
+    for (auto& worker : workers) {
+        for (std::size_t w = 0; w < PC_WORDS; ++w) {
+            for (uint64_t added = worker->fresh[w] & ~coverage[w]; added != 0; added &= added - 1) {
+                ++statistics.pcsCovered;
+            }
+            coverage[w] |= worker->fresh[w];
+            worker->fresh[w] = 0;
+        }
+        statistics.duplicates += worker->duplicates;
+        statistics.halts += worker->halts;
+        statistics.stateSetFull = statistics.stateSetFull || worker->stateSetFull;
+        worker->duplicates = 0;
+        worker->halts = 0;
+    }
+    selected.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+        const Child& child = children[i];
+        if (child.goal && goalNode == NO_NODE) {
+            goalNode = addPath(i);
+        }
+        if (child.halted && haltNode == NO_NODE) {
+            haltNode = addPath(i);
+        }
+        seenFramebuffers.insert(child.framebufferHash);
+        if (child.keep) {
+            selected.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    statistics.children += count;
+
+    // 4. Keep the beamWidth most novel children; ties by state hash
+    if (selected.empty()) {
+        exhausted = true;   // Every reachable state has been seen; keep the last frontier
+        ++statistics.depth;
+        statistics.framebuffersSeen = seenFramebuffers.size();
+        return false;
+    }
+    std::size_t keep = std::min(selected.size(), config.beamWidth);
+    std::partial_sort(selected.begin(), selected.begin() + static_cast<std::ptrdiff_t>(keep), selected.end(),
+                      [this](uint32_t a, uint32_t b) {
+                          if (children[a].score != children[b].score) {
+                              return children[a].score > children[b].score;
+                          }
+                          return children[a].stateHash < children[b].stateHash;
+                      });
+    selected.resize(keep);
+
+    // Run the kept children again to get their states (cheaper than
+    // saving every child's state for the few that survive)
+    nextStates.resize(keep * stateBytes);
+    parallelFor(keep, [this](Worker& worker, std::size_t s) {
+        runChild(worker, selected[s], &nextStates[s * stateBytes]);
+    });
+    nextFrontier.clear();
+    for (uint32_t child : selected) {
+        nextFrontier.push_back(Node{addPath(child), children[child].score});
+    }
+    frontier.swap(nextFrontier);
+    frontierStates.swap(nextStates);
+
+    ++statistics.depth;
+    statistics.framebuffersSeen = seenFramebuffers.size();
+    return !goalReached();
+}
+
+std::vector<uint16_t> Explorer::bestPath() const {
+    return frontier.empty() ? std::vector<uint16_t>() : pathTo(frontier.front().path);
+}
+
+std::vector<uint16_t> Explorer::pathTo(uint32_t node) const {
+    std::vector<uint16_t> keys;
+    for (; node != NO_NODE; node = path[node].parent) {
+        keys.push_back(path[node].keys);
+    }
+    std::reverse(keys.begin(), keys.end());
+    return keys;
+}
@@ -0,0 +1,151 @@
+#ifndef EXPLORER_H
+#define EXPLORER_H
+
+#include "chip8.h"
+#include "concurrent_hash_set.h"
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+#include <memory>   // For the worker machines
+#include <vector>   // For the frontier, paths and coverage
+
+/*
+ * Beam Search Exploration
+ *
+ * Finds key sequences that take a ROM somewhere new: code it has not
+ * run, screens it has not shown, a halt (crash / game over), or a goal
+ * address such as the end of a level. It replaces scripted brute force,
+ * which replays the same states over and over.
+ *
+ * ONE DEPTH (step()):
+ *   1. EXPAND   Every frontier state is forked once per action: restore
+ *               the state, hold the action's keys for framesPerAction
+ *               frames. Children are spread over the worker threads.
+ *   2. DEDUP    The child's Chip8::getStateHash() (whole machine, kept
+ *               up to date incrementally, so O(1)) is inserted into a
+ *               ConcurrentHashSet shared by all workers. A state seen
+ *               before (at any depth, on any thread) is dropped.
+ *   3. SCORE    Novelty = guest PCs the child executed that no earlier
+ *               depth had, plus a framebuffer no earlier depth showed,
+ *               plus half its parent's score (so a lineage that just
+ *               found something is followed a little longer).
+ *   4. SELECT   The beamWidth best children become the next frontier.
+ *               Only they are run again to keep their states, so memory
+ *               is beamWidth states, not beamWidth * actions.
+ *
+ * DETERMINISM:
+ * Scores only compare against coverage from earlier depths, which is
+ * merged between depths, and ties are broken by state hash, so the
+ * frontier is the same with any number of threads. (When two children
+ * reach the identical state, which one's key path is kept may vary.)
+ *
+ * ACTIONS:
+ * "No key", each allowed key alone and optionally every pair of allowed
+ * keys: 17 actions, or 137 with pairs. Restricting keys to those the ROM
+ * reads (see chip8_cfg) shrinks the search a lot.
+ */
+
+struct ExplorerConfig {
+    QuirkProfile profile = QuirkProfile::Chip8;
+    uint32_t cyclesPerFrame = 11;      // ~700Hz at 60 frames per second
+    uint32_t framesPerAction = 8;      // K: frames each action is held
+    std::size_t beamWidth = 256;       // States kept per depth
+    uint16_t keys = 0xFFFF;            // Keys actions may press (bit K = key K)
+    bool keyPairs = false;             // Also every two allowed keys at once
+    std::size_t maxStates = 1u << 22;  // Seen-state set capacity (32MB)
+    unsigned threads = 0;              // 0: one per CPU
+    uint32_t seed = 1;                 // CXNN seed of the start state
+    std::vector<uint16_t> goalPcs;     // Stop once one of these executes
+};
+
+struct ExplorerStats {
+    uint32_t depth = 0;
+    uint64_t children = 0;             // Forks run (frontier * actions per depth)
+    uint64_t duplicates = 0;           // Children whose state was already seen
+    uint64_t halts = 0;                // Children that stopped (00FD or a jump to itself)
+    std::size_t pcsCovered = 0;
+    std::size_t framebuffersSeen = 0;
+    bool stateSetFull = false;         // maxStates reached: dedup stopped growing
+};
+
+class Explorer {
+public:
+    Explorer(const uint8_t* rom, std::size_t romSize, const ExplorerConfig& config);
+    ~Explorer();
+    Explorer(const Explorer&) = delete;
+    Explorer& operator=(const Explorer&) = delete;
+
+    bool loadedOk() const { return loaded; }
+
+    // Search one depth deeper; false once nothing is left to do (every
+    // child already seen, or goal reached)
+    bool step();
+
+    const ExplorerStats& stats() const { return statistics; }
+    std::size_t frontierSize() const { return frontier.size(); }
+    const std::vector<uint16_t>& actions() const { return actionKeys; }
+    bool covered(uint16_t pc) const { return (coverage[pc >> 6] >> (pc & 63)) & 1; }
+
+    // Key paths, one key mask per action (each held framesPerAction
+    // frames); empty if there is no such path (yet)
+    bool goalReached() const { return goalNode != NO_NODE; }
+    std::vector<uint16_t> goalPath() const { return pathTo(goalNode); }
+    std::vector<uint16_t> haltPath() const { return pathTo(haltNode); }   // First halt found
+    std::vector<uint16_t> bestPath() const;                               // Best of the last frontier
+
+private:
+    static constexpr uint32_t NO_NODE = 0xFFFFFFFFu;
+
+    struct PathStep {
+        uint32_t parent;   // Index into path, NO_NODE for the start state
+        uint16_t keys;
+    };
+
+    struct Node {
+        uint32_t path;     // Index into path
+        uint32_t score;
+    };
+
+    // What expanding one (frontier state, action) pair found
+    struct Child {
+        uint64_t stateHash;
+        uint64_t framebufferHash;
+        uint32_t score;
+        bool keep;         // New state (not a duplicate, not halted)
+        bool halted;
+        bool goal;
+    };
+
+    struct Worker;
+
+    void runChild(Worker& worker, std::size_t child, uint8_t* keepState);
+    uint32_t addPath(std::size_t child);
+    template <typename Work>
+    void parallelFor(std::size_t count, Work work);
+    std::vector<uint16_t> pathTo(uint32_t node) const;
+
+    ExplorerConfig config;
+    std::vector<uint16_t> actionKeys;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::size_t stateBytes;
+
+    std::vector<Node> frontier;
+    std::vector<uint8_t> frontierStates;   // stateBytes per frontier node
+    std::vector<Node> nextFrontier;
+    std::vector<uint8_t> nextStates;
+    std::vector<Child> children;           // frontier * actions, this depth
+    std::vector<uint32_t> selected;        // Child indices that form the next frontier
+
+    std::vector<PathStep> path;
+    uint32_t goalNode;
+    uint32_t haltNode;
+
+    ConcurrentHashSet seenStates;
+    ConcurrentHashSet seenFramebuffers;    // Written between depths only
+    std::vector<uint64_t> coverage;        // Bit per guest PC, earlier depths
+    std::vector<uint64_t> goals;           // Bit per guest PC in config.goalPcs
+    bool exhausted;                        // A depth produced no new state
+    ExplorerStats statistics;
+    bool loaded;
+};
+
+#endif // EXPLORER_H
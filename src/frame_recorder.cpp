@@ -0,0 +1,388 @@
+#include "frame_recorder.h"
+#include <chrono>     // For the writer's wake-up timeout
+#include <cstring>    // For memcpy, memset, memcmp
+#include <iostream>   // For status messages
+
+/*
+ * Pack Frame
+ *
+ * Converts the visible display into the stream's 1-bit-per-pixel layout.
+ * Display rows are already packed uint64_t words with the leftmost
+ * pixel in bit 63, so each word becomes 8 bytes written high byte first
+ * (one word per row at 64x32, two at 128x64). Only plane 0 is recorded;
+ * XO-CHIP colour planes are not part of the stream format.
+ *
+ * @return: Number of bytes written (width * height / 8)
+ */
+std::size_t packFrame(const Chip8& chip8, uint8_t* out) {
+    packRows(chip8, ~uint64_t{0}, out);
+    return static_cast<std::size_t>(chip8.getWidth()) * chip8.getHeight() / 8;
+}
+
+void packRows(const Chip8& chip8, uint64_t rows, uint8_t* out) {
+    const int words = chip8.getWidth() / 64;
+    const int height = chip8.getHeight();
+    for (int y = 0; y < height; ++y) {
+        if ((rows & (uint64_t{1} << y)) == 0) {
+            continue;
+        }
+        const uint64_t* row = chip8.getRow(y);
+        uint8_t* bytes = out + y * words * 8;
+        for (int w = 0; w < words; ++w) {
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                *bytes++ = static_cast<uint8_t>(row[w] >> shift);
+            }
+        }
+    }
+}
+
+/*
+ * PackBits Encode
+ *
+ * Each chunk starts with a control byte c:
+ * - c = 0..127:    the next c + 1 bytes are copied literally
+ * - c = 129..255:  the next byte is repeated 257 - c times (2..128,
+ *                  we only emit 3..128)
+ * - c = 128:       no-op (never written by us)
+ *
+ * Example: 00 00 00 00 00 07 01
+ *   -> FC 00    (repeat 0x00 five times: 257 - 0xFC = 5)
+ *      01 07 01 (two literal bytes)
+ *
+ * @return: Number of bytes written to out
+ *          (at most size + size / 128 + 1)
+ */
+std::size_t packBitsEncode(const uint8_t* in, std::size_t size, uint8_t* out) {
+    std::size_t i = 0;
+    std::size_t o = 0;
+
+    while (i < size) {
+        // Measure the run of identical bytes starting at i
+        std::size_t run = 1;
+        while (i + run < size && run < 128 && in[i + run] == in[i]) {
+            ++run;
+        }
+
+        // Runs shorter than 3 are cheaper as literals: a 2-byte repeat
+        // chunk saves nothing and can split a literal chunk in two
+        if (run >= 3) {
+            out[o++] = static_cast<uint8_t>(257 - run);
+            out[o++] = in[i];
+            i += run;
+            continue;
+        }
+
+        // Literal chunk: extend until a 3-byte repeat starts or 128 bytes
+        std::size_t start = i;
+        std::size_t count = 0;
+        while (i < size && count < 128) {
+            if (i + 2 < size && in[i] == in[i + 1] && in[i] == in[i + 2]) {
+                break;
+            }
+            ++i;
+            ++count;
+        }
+        out[o++] = static_cast<uint8_t>(count - 1);
+        std::memcpy(out + o, in + start, count);
+        o += count;
+    }
+
+    return o;
+}
+
+/*
+ * PackBits Decode
+ *
+ * @return: true if exactly outSize bytes were produced without
+ *          reading or writing past either buffer
+ */
+bool packBitsDecode(const uint8_t* in, std::size_t size, uint8_t* out, std::size_t outSize) {
+    std::size_t i = 0;
+    std::size_t o = 0;
+
+    while (i < size) {
+        uint8_t control = in[i++];
+
+        if (control < 128) {
+            std::size_t count = control + 1u;
+            if (i + count > size || o + count > outSize) {
+                return false;
+            }
+            std::memcpy(out + o, in + i, count);
+            i += count;
+            o += count;
+        } else if (control > 128) {
+            std::size_t count = 257u - control;
+            if (i >= size || o + count > outSize) {
+                return false;
+            }
+            std::memset(out + o, in[i++], count);
+            o += count;
+        }
+    }
+
+    return o == outSize;
+}
+
+// Little-endian helpers for the stream headers
+static void putU16(uint8_t* p, uint16_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+static void putU32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        p[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+}
+
+static uint16_t getU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// ==================== FRAME RECORDER ====================
+
+FrameRecorder::FrameRecorder()
+    : queue(new SpscRing<CapturedFrame, QUEUE_CAPACITY>()),
+      stopRequested(false),
+      captured(0),
+      dropped(0),
+      unsentRows(0),
+      previousWidth(0),
+      previousHeight(0) {
+    previous.fill(0);
+}
+
+FrameRecorder::~FrameRecorder() {
+    close();
+}
+
+/*
+ * Open a recording file and start the writer thread
+ *
+ * @return: false if the file cannot be created or a recording is running
+ */
+bool FrameRecorder::open(const std::string& filename) {
+    if (isOpen()) {
+        std::cerr << "[ERROR] Recorder already open\n";
+        return false;
+    }
+
+    file.open(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Failed to create recording: " << filename << "\n";
+        return false;
+    }
+
+    uint8_t header[FRAME_STREAM_HEADER_SIZE] = {};
+    std::memcpy(header, FRAME_STREAM_MAGIC, sizeof(FRAME_STREAM_MAGIC));
+    header[4] = FRAME_STREAM_VERSION;
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    previous.fill(0);
+    previousWidth = 0;
+    previousHeight = 0;
+    captured = 0;
+    dropped = 0;
+    unsentRows = ~uint64_t{0};   // The first frame goes out whole
+    stopRequested = false;
+    writer = std::thread(&FrameRecorder::writerLoop, this);
+
+    std::cout << "[RECORDER] Recording to " << filename << "\n";
+    return true;
+}
+
+/*
+ * Capture the current display (emulation thread)
+ *
+ * Packs only the dirty rows (8 or 16 bytes each) straight into a free
+ * queue slot and returns; a typical frame touches a few rows, not the
+ * whole 256 bytes (1KB in hi-res). The expensive parts (delta,
+ * compression, file I/O) happen on the writer thread. If the queue is
+ * full the rows are remembered and go out with the next frame.
+ * @param dirtyRows: Rows changed since the last call (Chip8::takeDirtyRows)
+ */
+void FrameRecorder::capture(const Chip8& chip8, uint64_t dirtyRows, uint32_t frame) {
+    if (!isOpen()) {
+        return;
+    }
+
+    const uint64_t rows = dirtyRows | unsentRows;
+    CapturedFrame* item = queue->reserve();
+    if (item == nullptr) {
+        unsentRows = rows;
+        ++dropped;  // Writer is behind; never stall the emulator
+        return;
+    }
+    item->frame = frame;
+    item->width = static_cast<uint8_t>(chip8.getWidth());
+    item->height = static_cast<uint8_t>(chip8.getHeight());
+    item->rows = rows;
+    packRows(chip8, rows, item->bits.data());
+    queue->publish();
+    unsentRows = 0;
+    ++captured;
+
+    // notify_one() without holding the mutex is cheap when the writer is
+    // already awake; the writer's timed wait covers the rare lost wake-up
+    wakeup.notify_one();
+}
+
+/*
+ * Stop recording: drain the queue, flush, and join the writer
+ */
+void FrameRecorder::close() {
+    if (!isOpen()) {
+        return;
+    }
+
+    stopRequested = true;
+    wakeup.notify_one();
+    writer.join();
+    file.close();
+
+    std::cout << "[RECORDER] Stopped: " << captured << " frames written, "
+              << dropped << " dropped\n";
+}
+
+/*
+ * Writer thread: sleep until frames arrive, then write them all
+ */
+void FrameRecorder::writerLoop() {
+    CapturedFrame frame;
+
+    for (;;) {
+        while (queue->tryPop(frame)) {
+            writeFrame(frame);
+        }
+
+        if (stopRequested) {
+            // Drain anything pushed between the last pop and the stop flag
+            while (queue->tryPop(frame)) {
+                writeFrame(frame);
+            }
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeup.wait_for(lock, std::chrono::milliseconds(20));
+    }
+
+    file.flush();
+}
+
+/*
+ * Delta-encode, compress and append one frame (writer thread)
+ */
+void FrameRecorder::writeFrame(const CapturedFrame& frame) {
+    std::size_t size = static_cast<std::size_t>(frame.width) * frame.height / 8;
+
+    // A resolution change starts a fresh delta chain
+    if (frame.width != previousWidth || frame.height != previousHeight) {
+        previous.fill(0);
+        previousWidth = frame.width;
+        previousHeight = frame.height;
+    }
+
+    // XOR against the previous frame: unchanged pixels become 0, and rows
+    // the emulator did not send are unchanged by definition
+    const std::size_t rowBytes = frame.width / 8;
+    std::array<uint8_t, MAX_FRAME_BYTES> delta{};
+    for (std::size_t y = 0; y < frame.height; ++y) {
+        if ((frame.rows & (uint64_t{1} << y)) == 0) {
+            continue;
+        }
+        for (std::size_t i = y * rowBytes; i < (y + 1) * rowBytes; ++i) {
+            delta[i] = frame.bits[i] ^ previous[i];
+            previous[i] = frame.bits[i];
+        }
+    }
+
+    uint8_t record[FRAME_RECORD_HEADER_SIZE + MAX_PACKED_FRAME_BYTES];
+    std::size_t packed = packBitsEncode(delta.data(), size, record + FRAME_RECORD_HEADER_SIZE);
+
+    putU32(record, frame.frame);
+    record[4] = frame.width;
+    record[5] = frame.height;
+    putU16(record + 6, static_cast<uint16_t>(packed));
+
+    file.write(reinterpret_cast<const char*>(record), FRAME_RECORD_HEADER_SIZE + packed);
+}
+
+// ==================== FRAME STREAM READER ====================
+
+/*
+ * Open a .c8rec file and validate its header
+ */
+bool FrameStreamReader::open(const std::string& filename) {
+    file.open(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Failed to open recording: " << filename << "\n";
+        return false;
+    }
+
+    uint8_t header[FRAME_STREAM_HEADER_SIZE];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+        std::memcmp(header, FRAME_STREAM_MAGIC, sizeof(FRAME_STREAM_MAGIC)) != 0) {
+        std::cerr << "[ERROR] Not a CHIP-8 recording: " << filename << "\n";
+        return false;
+    }
+
+    if (header[4] != FRAME_STREAM_VERSION) {
+        std::cerr << "[ERROR] Unsupported recording version " << int(header[4]) << "\n";
+        return false;
+    }
+
+    previous.fill(0);
+    previousWidth = 0;
+    previousHeight = 0;
+    corrupt = false;
+    return true;
+}
+
+/*
+ * Decode the next frame
+ *
+ * Decompresses the delta and XORs it onto the previous frame,
+ * which reverses exactly what the writer did.
+ */
+bool FrameStreamReader::next(CapturedFrame& frame) {
+    uint8_t header[FRAME_RECORD_HEADER_SIZE];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        return false;  // Clean end of stream
+    }
+
+    frame.frame = getU32(header);
+    frame.width = header[4];
+    frame.height = header[5];
+    std::size_t packed = getU16(header + 6);
+    std::size_t size = static_cast<std::size_t>(frame.width) * frame.height / 8;
+
+    uint8_t payload[MAX_PACKED_FRAME_BYTES];
+    std::array<uint8_t, MAX_FRAME_BYTES> delta;
+
+    if (size == 0 || size > MAX_FRAME_BYTES || packed > sizeof(payload) ||
+        !file.read(reinterpret_cast<char*>(payload), packed) ||
+        !packBitsDecode(payload, packed, delta.data(), size)) {
+        corrupt = true;
+        return false;
+    }
+
+    if (frame.width != previousWidth || frame.height != previousHeight) {
+        previous.fill(0);
+        previousWidth = frame.width;
+        previousHeight = frame.height;
+    }
+
+    for (std::size_t i = 0; i < size; ++i) {
+        previous[i] ^= delta[i];
+    }
+    frame.bits = previous;
+    frame.rows = ~uint64_t{0};
+    return true;
+}
@@ -0,0 +1,157 @@
+#ifndef FRAME_RECORDER_H
+#define FRAME_RECORDER_H
+
+#include <array>               // For frame buffers
+#include <atomic>              // For the stop flag and counters
+#include <condition_variable>  // For waking the writer thread
+#include <cstddef>             // For std::size_t
+#include <cstdint>             // For fixed-width integer types
+#include <fstream>             // For stream I/O
+#include <memory>              // For std::unique_ptr
+#include <mutex>               // For the writer wake-up
+#include <string>              // For file paths
+#include <thread>              // For the background writer
+
+#include "chip8.h"
+#include "spsc_ring.h"
+
+/*
+ * Frame Recording
+ *
+ * Captures every drawn frame into a compact ".c8rec" stream that the
+ * chip8_rec2img tool converts to PPM images or a y4m video.
+ *
+ * PIPELINE:
+ *   emulation thread                      writer thread
+ *   ----------------                      -------------
+ *   capture(): pack the changed  --ring-->  XOR with previous frame
+ *   rows into a slot (32 bytes              PackBits-compress the delta
+ *   per row, never waits)                   append to file
+ *
+ * WHY XOR + run-length?
+ * Consecutive frames are almost identical. XORing a frame with the one
+ * before it leaves zeros everywhere except the pixels that changed, and
+ * long runs of zeros compress to a couple of bytes each. A typical game
+ * frame shrinks from 256 bytes to ~10.
+ *
+ * STREAM FORMAT (all integers little-endian):
+ *   Header (8 bytes):  "C8RV", version (u8), 3 reserved bytes
+ *   Per frame:         frame number (u32)  - emulated frame index
+ *                      width (u8), height (u8) - in pixels
+ *                      payload size (u16)
+ *                      payload: PackBits(frame XOR previous frame)
+ *   A frame is the display packed 1 bit per pixel, rows top to bottom,
+ *   MSB = leftmost pixel. "previous" is all zeros for the first frame.
+ */
+
+constexpr char FRAME_STREAM_MAGIC[4] = {'C', '8', 'R', 'V'};
+constexpr uint8_t FRAME_STREAM_VERSION = 1;
+constexpr std::size_t FRAME_STREAM_HEADER_SIZE = 8;
+constexpr std::size_t FRAME_RECORD_HEADER_SIZE = 8;
+constexpr std::size_t MAX_FRAME_BYTES = Chip8::DISPLAY_WIDTH * Chip8::DISPLAY_HEIGHT / 8;
+
+// PackBits worst case: one control byte per 128 literal bytes
+constexpr std::size_t MAX_PACKED_FRAME_BYTES = MAX_FRAME_BYTES + MAX_FRAME_BYTES / 128 + 1;
+
+/*
+ * One captured frame, as it travels from the emulator to the writer.
+ * In the recorder's queue only the rows in `rows` are filled in (the
+ * others did not change); frames read back from a stream are complete.
+ */
+struct CapturedFrame {
+    uint32_t frame;
+    uint8_t width;
+    uint8_t height;
+    uint64_t rows;   // Bit N set = row N is in bits
+    std::array<uint8_t, MAX_FRAME_BYTES> bits;
+};
+
+// Pack the current display into 1-bit-per-pixel bytes, returns byte count
+std::size_t packFrame(const Chip8& chip8, uint8_t* out);
+
+// Same, for only the rows set in `rows` (each at its place in the frame)
+void packRows(const Chip8& chip8, uint64_t rows, uint8_t* out);
+
+// PackBits run-length codec (the classic Apple/TIFF scheme)
+std::size_t packBitsEncode(const uint8_t* in, std::size_t size, uint8_t* out);
+bool packBitsDecode(const uint8_t* in, std::size_t size, uint8_t* out, std::size_t outSize);
+
+/*
+ * Frame Recorder
+ *
+ * Usage:
+ *   FrameRecorder recorder;
+ *   recorder.open("run.c8rec");
+ *   ... every frame: uint64_t rows = chip8.takeDirtyRows();
+ *                    if (chip8.shouldDraw()) recorder.capture(chip8, rows, frame);
+ *   recorder.close();  // Flushes and joins the writer thread
+ *
+ * capture() never blocks. If the writer falls behind and the queue is
+ * full, the frame is dropped and counted (see droppedFrames()); its rows
+ * go out with the next frame, and the frame numbers in the stream show
+ * exactly which frames are missing.
+ */
+class FrameRecorder {
+public:
+    FrameRecorder();
+    ~FrameRecorder();
+
+    FrameRecorder(const FrameRecorder&) = delete;
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    bool open(const std::string& filename);
+    void capture(const Chip8& chip8, uint64_t dirtyRows, uint32_t frame);
+    void close();
+
+    bool isOpen() const { return writer.joinable(); }
+    uint64_t capturedFrames() const { return captured; }
+    uint64_t droppedFrames() const { return dropped; }
+
+private:
+    static constexpr std::size_t QUEUE_CAPACITY = 256;  // ~4 seconds at 60 FPS
+
+    void writerLoop();
+    void writeFrame(const CapturedFrame& frame);
+
+    // Shared between threads
+    std::unique_ptr<SpscRing<CapturedFrame, QUEUE_CAPACITY>> queue;
+    std::atomic<bool> stopRequested;
+    std::mutex wakeMutex;
+    std::condition_variable wakeup;
+
+    // Emulation thread only
+    uint64_t captured;
+    uint64_t dropped;
+    uint64_t unsentRows;   // Dirty rows of frames that did not fit in the queue
+
+    // Writer thread only
+    std::thread writer;
+    std::ofstream file;
+    std::array<uint8_t, MAX_FRAME_BYTES> previous;
+    uint8_t previousWidth;
+    uint8_t previousHeight;
+};
+
+/*
+ * Frame Stream Reader
+ *
+ * Decodes a .c8rec stream back into full frames, one at a time.
+ */
+class FrameStreamReader {
+public:
+    bool open(const std::string& filename);
+
+    // Reads the next frame into frame.bits, returns false at end of stream
+    // or on a corrupt record (check isCorrupt() to tell them apart)
+    bool next(CapturedFrame& frame);
+    bool isCorrupt() const { return corrupt; }
+
+private:
+    std::ifstream file;
+    std::array<uint8_t, MAX_FRAME_BYTES> previous{};
+    uint8_t previousWidth = 0;
+    uint8_t previousHeight = 0;
+    bool corrupt = false;
+};
+
+#endif // FRAME_RECORDER_H
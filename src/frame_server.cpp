@@ -0,0 +1,493 @@
+#include "frame_server.h"
+#include <cerrno>     // For EAGAIN
+#include <chrono>     // For the drain deadline on close
+#include <cstdlib>    // For strtol
+#include <cstring>    // For memcpy, memset
+#include <iostream>   // For status messages
+
+#if defined(__linux__)
+#include <arpa/inet.h>    // For inet_pton
+#include <netinet/in.h>   // For sockaddr_in
+#include <netinet/tcp.h>  // For TCP_NODELAY
+#include <sys/epoll.h>    // For epoll
+#include <sys/eventfd.h>  // For the wake-up descriptor
+#include <sys/socket.h>   // For socket, bind, listen, accept4, send
+#include <sys/stat.h>     // For replacing a stale Unix socket
+#include <sys/un.h>       // For sockaddr_un
+#include <unistd.h>       // For read, write, close, unlink
+#endif
+
+// Little-endian helpers for the stream headers
+static void putU32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        p[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+}
+
+static void putU64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; ++i) {
+        p[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+}
+
+FrameServer::FrameServer()
+    : queue(new SpscRing<StreamedFrame, QUEUE_CAPACITY>()),
+      stopRequested(false),
+      viewers(0),
+      wakeFd(-1),
+      unsentRows(0),
+      epollFd(-1),
+      current(),
+      keyframesSent(0),
+      deltasSent(0),
+      deltasSkipped(0) {
+}
+
+FrameServer::~FrameServer() {
+    close();
+}
+
+/*
+ * Start serving on "tcp:[HOST:]PORT" or "unix:PATH"
+ *
+ * @return: false if the address is malformed or cannot be bound
+ */
+bool FrameServer::open(const std::string& address) {
+#if !defined(__linux__)
+    (void)address;
+    std::cerr << "[ERROR] Frame streaming needs epoll (Linux only)\n";
+    return false;
+#else
+    if (isOpen()) {
+        std::cerr << "[ERROR] Frame server already open\n";
+        return false;
+    }
+
+    epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    bool listening = false;
+    if (epollFd >= 0 && wakeFd >= 0) {
+        if (address.compare(0, 4, "tcp:") == 0) {
+            listening = listenTcp(address.substr(4));
+        } else if (address.compare(0, 5, "unix:") == 0) {
+            listening = listenUnix(address.substr(5));
+        } else {
+            std::cerr << "[ERROR] Stream address must be tcp:[HOST:]PORT or unix:PATH\n";
+        }
+    }
+    if (!listening) {
+        for (int fd : listeners) {
+            ::close(fd);
+        }
+        listeners.clear();
+        if (wakeFd >= 0) ::close(wakeFd);
+        if (epollFd >= 0) ::close(epollFd);
+        wakeFd = -1;
+        epollFd = -1;
+        return false;
+    }
+
+    epoll_event event;
+    std::memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = wakeFd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+    for (int fd : listeners) {
+        event.data.fd = fd;
+        ::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+
+    current = StreamedFrame();
+    unsentRows = 0;
+    keyframesSent = 0;
+    deltasSent = 0;
+    deltasSkipped = 0;
+    stopRequested = false;
+    ioThread = std::thread(&FrameServer::ioLoop, this);
+    return true;
+#endif
+}
+
+#if defined(__linux__)
+bool FrameServer::listenTcp(const std::string& spec) {
+    std::string host = "127.0.0.1";   // Local viewers only unless asked
+    std::string port = spec;
+    std::size_t colon = spec.rfind(':');
+    if (colon != std::string::npos) {
+        host = spec.substr(0, colon);
+        port = spec.substr(colon + 1);
+    }
+    long portNumber = std::strtol(port.c_str(), nullptr, 10);
+
+    sockaddr_in local;
+    std::memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(static_cast<uint16_t>(portNumber));
+    if (portNumber <= 0 || portNumber > 65535 || ::inet_pton(AF_INET, host.c_str(), &local.sin_addr) != 1) {
+        std::cerr << "[ERROR] Bad stream address: tcp:" << spec << " (expected [IPv4:]PORT)\n";
+        return false;
+    }
+
+    int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    int reuse = 1;
+    if (fd < 0 || ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0 ||
+        ::bind(fd, reinterpret_cast<const sockaddr*>(&local), sizeof(local)) != 0 || ::listen(fd, 16) != 0) {
+        std::cerr << "[ERROR] Cannot listen on tcp:" << host << ":" << portNumber << "\n";
+        if (fd >= 0) ::close(fd);
+        return false;
+    }
+    listeners.push_back(fd);
+    std::cout << "[STREAM] Serving frames on tcp:" << host << ":" << portNumber << "\n";
+    return true;
+}
+
+bool FrameServer::listenUnix(const std::string& path) {
+    sockaddr_un local;
+    std::memset(&local, 0, sizeof(local));
+    local.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(local.sun_path)) {
+        std::cerr << "[ERROR] Bad stream socket path: " << path << "\n";
+        return false;
+    }
+    std::memcpy(local.sun_path, path.c_str(), path.size());
+
+    // A socket file left by a previous run would make bind() fail; only
+    // ever remove a socket, never a regular file given by mistake
+    struct stat info;
+    if (::stat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+        ::unlink(path.c_str());
+    }
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0 || ::bind(fd, reinterpret_cast<const sockaddr*>(&local), sizeof(local)) != 0 ||
+        ::listen(fd, 16) != 0) {
+        std::cerr << "[ERROR] Cannot listen on unix:" << path << "\n";
+        if (fd >= 0) ::close(fd);
+        return false;
+    }
+    listeners.push_back(fd);
+    unixPath = path;
+    std::cout << "[STREAM] Serving frames on unix:" << path << "\n";
+    return true;
+}
+#endif
+
+/*
+ * Publish a frame (emulation thread)
+ *
+ * Copies the dirty rows (16 bytes each) into the queue and wakes the
+ * I/O thread. If the queue is full the rows are remembered and go out
+ * with the next frame instead, so nothing is ever lost; viewers just see
+ * two frames' changes at once.
+ */
+void FrameServer::publish(const Chip8& chip8, uint64_t dirtyRows, uint32_t frame) {
+    if (!isOpen()) {
+        return;
+    }
+    const uint64_t rows = dirtyRows | unsentRows;
+    if (rows == 0) {
+        return;   // Nothing changed; viewers keep showing the last frame
+    }
+
+    StreamedFrame item;
+    item.frame = frame;
+    item.width = static_cast<uint8_t>(chip8.getWidth());
+    item.height = static_cast<uint8_t>(chip8.getHeight());
+    item.dirtyRows = rows;
+    for (int y = 0; y < Chip8::DISPLAY_HEIGHT; ++y) {
+        if ((rows & (uint64_t{1} << y)) != 0) {
+            std::memcpy(&item.rows[y * Chip8::ROW_WORDS], chip8.getRow(static_cast<uint8_t>(y)), FRAME_ROW_BYTES);
+        }
+    }
+
+    if (!queue->tryPush(item)) {
+        unsentRows = rows;   // I/O thread is behind; never stall the emulator
+        return;
+    }
+    unsentRows = 0;
+    wake();
+}
+
+void FrameServer::wake() {
+#if defined(__linux__)
+    const uint64_t one = 1;
+    (void)::write(wakeFd, &one, sizeof(one));   // Adds to the counter; never blocks
+#endif
+}
+
+/*
+ * Stop serving: disconnect every viewer and join the I/O thread
+ */
+void FrameServer::close() {
+#if defined(__linux__)
+    if (!isOpen()) {
+        return;
+    }
+    stopRequested = true;
+    wake();
+    ioThread.join();
+
+    for (Client& client : clients) {
+        ::close(client.fd);
+    }
+    clients.clear();
+    viewers = 0;
+    for (int fd : listeners) {
+        ::close(fd);
+    }
+    listeners.clear();
+    if (!unixPath.empty()) {
+        ::unlink(unixPath.c_str());
+        unixPath.clear();
+    }
+    ::close(wakeFd);
+    ::close(epollFd);
+    wakeFd = -1;
+    epollFd = -1;
+
+    std::cout << "[STREAM] " << keyframesSent << " keyframes, " << deltasSent << " deltas sent, "
+              << deltasSkipped << " deltas skipped for slow viewers\n";
+#endif
+}
+
+// ==================== I/O THREAD ====================
+
+#if defined(__linux__)
+/*
+ * I/O Loop
+ *
+ * Sleeps in epoll_wait until a frame is published, a viewer connects,
+ * sends something (only ever a disconnect) or has room for more output.
+ */
+void FrameServer::ioLoop() {
+    epoll_event events[32];
+    while (!stopRequested) {
+        int count = ::epoll_wait(epollFd, events, 32, -1);
+        for (int e = 0; e < count; ++e) {
+            const int fd = events[e].data.fd;
+            if (fd == wakeFd) {
+                uint64_t counter;
+                (void)::read(wakeFd, &counter, sizeof(counter));
+                StreamedFrame frame;
+                while (queue->tryPop(frame)) {
+                    applyFrame(frame);
+                }
+                continue;
+            }
+
+            bool isListener = false;
+            for (int listener : listeners) {
+                isListener = isListener || listener == fd;
+            }
+            if (isListener) {
+                acceptClients(fd);
+                continue;
+            }
+
+            for (std::size_t i = 0; i < clients.size(); ++i) {
+                if (clients[i].fd != fd) {
+                    continue;
+                }
+                bool alive = true;
+                if (events[e].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    // Viewers never send data: readable means closed
+                    uint8_t discard[256];
+                    ssize_t n = ::recv(fd, discard, sizeof(discard), 0);
+                    alive = n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+                }
+                if (alive && (events[e].events & EPOLLOUT)) {
+                    writeReady(clients[i]);
+                    alive = clients[i].fd >= 0;
+                }
+                if (!alive) {
+                    closeClient(i);
+                }
+                break;
+            }
+        }
+    }
+
+    // Closing: apply the last frames and give viewers a moment to receive
+    // them, so a finished run ends on its final picture
+    StreamedFrame frame;
+    while (queue->tryPop(frame)) {
+        applyFrame(frame);
+    }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(CLOSE_DRAIN_MS);
+    for (;;) {
+        for (std::size_t i = clients.size(); i-- > 0;) {
+            writeReady(clients[i]);
+            if (clients[i].fd < 0 || clients[i].output.empty()) {
+                closeClient(i);   // Done (or gone)
+            }
+        }
+        if (clients.empty() || std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+        ::epoll_wait(epollFd, events, 32, 10);
+    }
+}
+
+// Send queued output; once it has all gone, a viewer that was skipped
+// for being slow catches up with one keyframe
+void FrameServer::writeReady(Client& client) {
+    flush(client);
+    if (client.fd >= 0 && client.needsKeyframe && client.output.empty() && current.width != 0) {
+        sendFrame(client, current.frame, ~uint64_t{0}, FRAME_MESSAGE_KEYFRAME);
+    }
+}
+
+void FrameServer::acceptClients(int listener) {
+    for (;;) {
+        int fd = ::accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            return;   // EAGAIN: no more pending connections
+        }
+        int noDelay = 1;
+        (void)::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));   // Fails harmlessly on Unix sockets
+
+        epoll_event event;
+        std::memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.fd = fd;
+        if (::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            ::close(fd);
+            continue;
+        }
+
+        Client client;
+        client.fd = fd;
+        client.output.resize(FRAME_SERVER_HELLO_SIZE, 0);
+        std::memcpy(client.output.data(), FRAME_SERVER_MAGIC, sizeof(FRAME_SERVER_MAGIC));
+        client.output[4] = FRAME_SERVER_VERSION;
+        clients.push_back(std::move(client));
+        viewers = static_cast<unsigned>(clients.size());
+
+        Client& added = clients.back();
+        if (current.width != 0) {
+            sendFrame(added, current.frame, ~uint64_t{0}, FRAME_MESSAGE_KEYFRAME);
+        } else {
+            flush(added);   // Nothing published yet: the first frame will be a keyframe
+        }
+        if (added.fd < 0) {
+            closeClient(clients.size() - 1);
+        }
+    }
+}
+
+/*
+ * Apply a published frame to the shared copy, then hand every viewer
+ * either that frame's rows, a keyframe (new, resized, or recovering from
+ * being slow), or nothing (still slow)
+ */
+void FrameServer::applyFrame(const StreamedFrame& frame) {
+    const bool resized = frame.width != current.width || frame.height != current.height;
+    for (uint64_t left = frame.dirtyRows; left != 0; left &= left - 1) {
+        const int y = __builtin_ctzll(left);
+        std::memcpy(&current.rows[y * Chip8::ROW_WORDS], &frame.rows[y * Chip8::ROW_WORDS], FRAME_ROW_BYTES);
+    }
+    current.frame = frame.frame;
+    current.width = frame.width;
+    current.height = frame.height;
+
+    for (std::size_t i = clients.size(); i-- > 0;) {
+        Client& client = clients[i];
+        if (client.output.size() - client.sent >= SLOW_CLIENT_BYTES) {
+            client.needsKeyframe = true;
+            ++deltasSkipped;
+            continue;
+        }
+        if (client.needsKeyframe || resized) {
+            sendFrame(client, frame.frame, ~uint64_t{0}, FRAME_MESSAGE_KEYFRAME);
+        } else {
+            sendFrame(client, frame.frame, frame.dirtyRows, FRAME_MESSAGE_DELTA);
+        }
+        if (client.fd < 0) {
+            closeClient(i);
+        }
+    }
+}
+
+// Queue one message (rows taken from the shared copy) and try to send it
+void FrameServer::sendFrame(Client& client, uint32_t frame, uint64_t rows, uint8_t type) {
+    uint8_t header[FRAME_MESSAGE_HEADER_SIZE] = {};
+    header[0] = type;
+    header[1] = current.width;
+    header[2] = current.height;
+    putU32(header + 4, frame);
+    putU64(header + 8, rows);
+    client.output.insert(client.output.end(), header, header + sizeof(header));
+    for (uint64_t left = rows; left != 0; left &= left - 1) {
+        const uint64_t* row = &current.rows[__builtin_ctzll(left) * Chip8::ROW_WORDS];
+        uint8_t bytes[FRAME_ROW_BYTES];
+        for (int w = 0; w < Chip8::ROW_WORDS; ++w) {
+            putU64(bytes + 8 * w, row[w]);
+        }
+        client.output.insert(client.output.end(), bytes, bytes + FRAME_ROW_BYTES);
+    }
+
+    if (type == FRAME_MESSAGE_KEYFRAME) {
+        client.needsKeyframe = false;
+        ++keyframesSent;
+    } else {
+        ++deltasSent;
+    }
+    flush(client);
+}
+
+/*
+ * Write as much queued output as the socket takes without blocking, and
+ * ask epoll for EPOLLOUT only while something is left. Sets fd to -1 if
+ * the viewer has gone (the caller removes it).
+ */
+void FrameServer::flush(Client& client) {
+    while (client.sent < client.output.size()) {
+        ssize_t n = ::send(client.fd, client.output.data() + client.sent, client.output.size() - client.sent,
+                           MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n > 0) {
+            client.sent += static_cast<std::size_t>(n);
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            ::close(client.fd);   // Also removes it from the epoll set
+            client.fd = -1;
+            return;
+        }
+    }
+
+    if (client.sent == client.output.size()) {
+        client.output.clear();
+        client.sent = 0;
+    } else if (client.sent > client.output.size() / 2) {
+        client.output.erase(client.output.begin(), client.output.begin() + static_cast<std::ptrdiff_t>(client.sent));
+        client.sent = 0;
+    }
+
+    const bool wantWrite = !client.output.empty();
+    if (wantWrite != client.waitingToWrite) {
+        epoll_event event;
+        std::memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN | EPOLLRDHUP | (wantWrite ? uint32_t{EPOLLOUT} : 0u);
+        event.data.fd = client.fd;
+        ::epoll_ctl(epollFd, EPOLL_CTL_MOD, client.fd, &event);
+        client.waitingToWrite = wantWrite;
+    }
+}
+
+void FrameServer::closeClient(std::size_t index) {
+    if (clients[index].fd >= 0) {
+        ::close(clients[index].fd);
+    }
+    clients[index] = std::move(clients.back());
+    clients.pop_back();
+    viewers = static_cast<unsigned>(clients.size());
+}
+#else
+void FrameServer::ioLoop() {}
+void FrameServer::acceptClients(int) {}
+void FrameServer::applyFrame(const StreamedFrame&) {}
+void FrameServer::sendFrame(Client&, uint32_t, uint64_t, uint8_t) {}
+void FrameServer::writeReady(Client&) {}
+void FrameServer::flush(Client&) {}
+void FrameServer::closeClient(std::size_t) {}
+#endif
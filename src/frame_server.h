@@ -0,0 +1,147 @@
+#ifndef FRAME_SERVER_H
+#define FRAME_SERVER_H
+
+#include <array>    // For frame rows
+#include <atomic>   // For the stop flag and counters
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+#include <memory>   // For std::unique_ptr
+#include <string>   // For addresses
+#include <thread>   // For the I/O thread
+#include <vector>   // For clients and their output
+
+#include "chip8.h"
+#include "spsc_ring.h"
+
+/*
+ * Framebuffer Streaming
+ *
+ * Serves the emulator's display to any number of viewers (chip8_viewer)
+ * over TCP or a Unix domain socket, e.g. to watch a kiosk remotely.
+ *
+ * PIPELINE:
+ *   emulation thread                      I/O thread (epoll)
+ *   ----------------                      ------------------
+ *   publish(): copy the dirty rows  --ring-->  apply to its own copy of
+ *   (never waits, no syscalls                   the display, then send each
+ *    except one eventfd write)                  viewer a delta or keyframe
+ *
+ * One I/O thread multiplexes the listening sockets, every viewer and the
+ * wake-up eventfd with epoll, so the emulation loop does the same work
+ * with 0 viewers or 50, and a stuck viewer only ever blocks itself.
+ *
+ * DELTAS AND KEYFRAMES:
+ * A viewer gets a keyframe (every row) when it connects, then deltas:
+ * only the rows the core reported dirty (Chip8::takeDirtyRows), usually
+ * a handful of 16-byte rows per frame. Output to each viewer is queued
+ * in memory; a viewer whose queue holds more than SLOW_CLIENT_BYTES is
+ * slow. Its deltas are skipped rather than queued without bound, and
+ * once its queue has drained it gets a keyframe, which brings it back
+ * up to date however many frames it missed.
+ *
+ * STREAM FORMAT (all integers little-endian):
+ *   On connect:   "C8FS", version (u8), 3 reserved bytes
+ *   Per message:  type (u8: 1 = keyframe, 2 = delta)
+ *                 width (u8), height (u8), reserved (u8)
+ *                 frame (u32)           - emulated frame number
+ *                 rows (u64)            - bit N set = row N follows
+ *                 payload: for each set bit, low to high, one row of
+ *                          Chip8::ROW_WORDS u64 words (bit 63 = x 0)
+ *   Rows not sent are unchanged. Plane 0 only (like the recorder).
+ */
+
+constexpr char FRAME_SERVER_MAGIC[4] = {'C', '8', 'F', 'S'};
+constexpr uint8_t FRAME_SERVER_VERSION = 1;
+constexpr std::size_t FRAME_SERVER_HELLO_SIZE = 8;
+constexpr std::size_t FRAME_MESSAGE_HEADER_SIZE = 16;
+constexpr std::size_t FRAME_ROW_BYTES = Chip8::ROW_WORDS * sizeof(uint64_t);
+constexpr uint8_t FRAME_MESSAGE_KEYFRAME = 1;
+constexpr uint8_t FRAME_MESSAGE_DELTA = 2;
+
+/*
+ * One published frame, as it travels from the emulator to the I/O
+ * thread. Only the rows in dirtyRows are filled in.
+ */
+struct StreamedFrame {
+    uint32_t frame;
+    uint8_t width;
+    uint8_t height;
+    uint64_t dirtyRows;
+    std::array<uint64_t, Chip8::DISPLAY_HEIGHT * Chip8::ROW_WORDS> rows;
+};
+
+/*
+ * Frame Server
+ *
+ * Usage:
+ *   FrameServer server;
+ *   server.open("tcp:9000");                 // or "tcp:0.0.0.0:9000", "unix:/tmp/kiosk.sock"
+ *   ... every frame:
+ *       uint64_t dirty = chip8.takeDirtyRows();
+ *       server.publish(chip8, dirty, frame);
+ *   server.close();                          // Disconnects viewers, joins the thread
+ *
+ * TCP listens on 127.0.0.1 unless a host is given.
+ */
+class FrameServer {
+public:
+    static constexpr std::size_t SLOW_CLIENT_BYTES = 64 * 1024;   // ~60 keyframes
+
+    FrameServer();
+    ~FrameServer();
+
+    FrameServer(const FrameServer&) = delete;
+    FrameServer& operator=(const FrameServer&) = delete;
+
+    bool open(const std::string& address);
+    void publish(const Chip8& chip8, uint64_t dirtyRows, uint32_t frame);
+    void close();
+
+    bool isOpen() const { return ioThread.joinable(); }
+    unsigned viewerCount() const { return viewers.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr std::size_t QUEUE_CAPACITY = 64;   // ~1 second at 60 FPS
+    static constexpr int CLOSE_DRAIN_MS = 1000;          // Longest close() waits for viewers
+
+    struct Client {
+        int fd = -1;
+        std::vector<uint8_t> output;   // Queued bytes; output[sent..] not written yet
+        std::size_t sent = 0;
+        bool needsKeyframe = true;
+        bool waitingToWrite = false;   // Registered for EPOLLOUT
+    };
+
+    bool listenTcp(const std::string& spec);
+    bool listenUnix(const std::string& path);
+    void ioLoop();
+    void acceptClients(int listener);
+    void applyFrame(const StreamedFrame& frame);
+    void sendFrame(Client& client, uint32_t frame, uint64_t rows, uint8_t type);
+    void writeReady(Client& client);
+    void flush(Client& client);
+    void closeClient(std::size_t index);
+    void wake();
+
+    // Shared between threads
+    std::unique_ptr<SpscRing<StreamedFrame, QUEUE_CAPACITY>> queue;
+    std::atomic<bool> stopRequested;
+    std::atomic<unsigned> viewers;
+    int wakeFd;   // eventfd: the emulation thread writes, epoll wakes
+
+    // Emulation thread only
+    uint64_t unsentRows;   // Dirty rows of frames that did not fit in the queue
+
+    // I/O thread only (set up before it starts)
+    std::thread ioThread;
+    int epollFd;
+    std::vector<int> listeners;
+    std::string unixPath;              // Removed again on close
+    std::vector<Client> clients;
+    StreamedFrame current;             // The display as viewers should see it
+    uint64_t keyframesSent;
+    uint64_t deltasSent;
+    uint64_t deltasSkipped;            // Slow viewers
+};
+
+#endif // FRAME_SERVER_H
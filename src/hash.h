@@ -0,0 +1,65 @@
+#ifndef CHIP8_HASH_H
+#define CHIP8_HASH_H
+
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+
+/*
+ * Hashing Helpers
+ * 
+ * Small, fast 64-bit mixing functions shared by the emulator core and
+ * the tools (regression hashes, state deduplication, ROM identification).
+ * 
+ * None of these are cryptographic. They are designed so that changing
+ * any input bit flips about half of the output bits, which is what
+ * "compare two hashes instead of two images" needs.
+ */
+
+/*
+ * mix64: The SplitMix64 finalizer
+ * 
+ * Two multiply-xorshift rounds turn "similar" inputs (e.g. two display
+ * rows that differ in one pixel) into unrelated-looking 64-bit values.
+ * It is constexpr so tables of hashes can be computed at compile time.
+ */
+constexpr uint64_t mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/*
+ * hashSlot: Hash a value stored at a numbered position
+ * 
+ * The position is folded in with the golden-ratio constant so that the
+ * same value in two different slots (e.g. the same pixels in row 3 and
+ * row 4) hashes differently.
+ * 
+ * INCREMENTAL USE:
+ * A whole structure is hashed as the XOR of hashSlot(slot, value) over
+ * all slots. When one slot changes from old to new, the total becomes:
+ *   total ^ hashSlot(slot, old) ^ hashSlot(slot, new)
+ * so updating costs two mixes, no matter how big the structure is.
+ */
+constexpr uint64_t hashSlot(uint64_t slot, uint64_t value) {
+    return mix64(value + (slot + 1) * 0x9E3779B97F4A7C15ULL);
+}
+
+/*
+ * hashBytes: Hash an arbitrary byte buffer (FNV-1a, then mixed)
+ * 
+ * Used where a one-off hash of a buffer is needed, e.g. identifying a ROM.
+ */
+inline uint64_t hashBytes(const uint8_t* data, std::size_t size) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+        h ^= data[i];
+        h *= 0x100000001B3ULL;
+    }
+    return mix64(h);
+}
+
+#endif // CHIP8_HASH_H
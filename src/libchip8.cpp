@@ -0,0 +1,306 @@
+#define LIBCHIP8_BUILD
+#include "libchip8.h"
+#include "chip8.h"
+#include "parallel_vec_env.h"
+#include "vec_env.h"
+#include <exception>    // For the create functions
+#include <new>          // For std::bad_alloc
+#include <memory>       // For owned machines
+#include <vector>       // For env handles
+
+/*
+ * libchip8 Implementation
+ *
+ * Each function is a thin wrapper over one Chip8 call. Nothing here may
+ * throw across the C boundary: only the create functions can fail
+ * (allocation, or starting threads), and they report that as NULL.
+ */
+
+static_assert(CHIP8_ROW_WORDS == Chip8::ROW_WORDS, "C framebuffer layout must match the core");
+static_assert(CHIP8_FRAMEBUFFER_ROWS == Chip8::DISPLAY_HEIGHT, "C framebuffer layout must match the core");
+static_assert(CHIP8_QUIRKS_XOCHIP == static_cast<int>(QuirkProfile::XoChip), "profile numbers must match quirks.h");
+
+// A handle refers to the machine every call works on. chip8_create()'s
+// handles own theirs; the batched envs keep one handle per env that
+// refers to the env's own machine (handed out read-only)
+struct chip8_machine {
+    std::unique_ptr<Chip8> owned;   // Empty for env handles
+    Chip8& core;
+};
+
+struct chip8_vecenv {
+    VecEnv envs;
+    std::vector<chip8_machine> machines;
+};
+
+struct chip8_parallel_vecenv {
+    ParallelVecEnv envs;
+    std::vector<chip8_machine> machines;
+};
+
+// One handle per env, built once the envs exist (their machines never move)
+template <typename Envs>
+static std::vector<chip8_machine> envHandles(Envs& envs) {
+    std::vector<chip8_machine> handles;
+    handles.reserve(envs.size());
+    for (std::size_t i = 0; i < envs.size(); ++i) {
+        handles.push_back(chip8_machine{nullptr, envs.machine(i)});
+    }
+    return handles;
+}
+
+static bool toObservationFormat(int format, ObservationFormat& out) {
+    switch (format) {
+        case CHIP8_OBS_PACKED: out = ObservationFormat::Packed; return true;
+        case CHIP8_OBS_PIXELS: out = ObservationFormat::Pixels; return true;
+    }
+    return false;
+}
+
+int chip8_api_version(void) {
+    return CHIP8_API_VERSION;
+}
+
+chip8_machine* chip8_create(int quirks) {
+    if (quirks < CHIP8_QUIRKS_CHIP8 || quirks > CHIP8_QUIRKS_XOCHIP) {
+        return nullptr;
+    }
+    try {
+        std::unique_ptr<Chip8> core(new Chip8);
+        core->setQuirkProfile(static_cast<QuirkProfile>(quirks));  // XO-CHIP allocates here
+        Chip8& machine = *core;
+        return new chip8_machine{std::move(core), machine};
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void chip8_destroy(chip8_machine* machine) {
+    delete machine;
+}
+
+void chip8_reset(chip8_machine* machine) {
+    machine->core.reset();
+}
+
+int chip8_load_rom(chip8_machine* machine, const uint8_t* data, size_t size) {
+    return machine->core.loadROM(data, size) ? 0 : -1;
+}
+
+uint32_t chip8_run(chip8_machine* machine, uint32_t cycles) {
+    return machine->core.runCycles(cycles);
+}
+
+void chip8_update_timers(chip8_machine* machine) {
+    machine->core.updateTimers();
+}
+
+void chip8_set_key(chip8_machine* machine, int key, int pressed) {
+    if (key >= 0 && key < Chip8::KEY_COUNT) {
+        machine->core.setKey(static_cast<uint8_t>(key), pressed != 0);
+    }
+}
+
+void chip8_set_keys(chip8_machine* machine, uint16_t mask) {
+    machine->core.setKeys(mask);
+}
+
+const uint64_t* chip8_framebuffer(const chip8_machine* machine, int* width, int* height) {
+    if (width != nullptr) {
+        *width = machine->core.getWidth();
+    }
+    if (height != nullptr) {
+        *height = machine->core.getHeight();
+    }
+    return machine->core.getRow(0);  // Rows are contiguous: row 0 starts the whole buffer
+}
+
+uint64_t chip8_framebuffer_hash(const chip8_machine* machine) {
+    return machine->core.getFramebufferHash();
+}
+
+uint64_t chip8_state_hash(const chip8_machine* machine) {
+    return machine->core.getStateHash();
+}
+
+uint32_t chip8_unknown_opcodes(const chip8_machine* machine, uint16_t* last) {
+    if (last != nullptr) {
+        *last = machine->core.getLastUnknownOpcode();
+    }
+    return machine->core.getUnknownOpcodeCount();
+}
+
+int chip8_sound_active(const chip8_machine* machine) {
+    return machine->core.shouldBeep() ? 1 : 0;
+}
+
+int chip8_waiting_for_key(const chip8_machine* machine) {
+    return machine->core.isWaitingForKey() ? 1 : 0;
+}
+
+int chip8_has_exited(const chip8_machine* machine) {
+    return machine->core.hasExited() ? 1 : 0;
+}
+
+uint8_t chip8_read_memory(const chip8_machine* machine, uint16_t address) {
+    return machine->core.readMemory(address);
+}
+
+size_t chip8_state_size(const chip8_machine* machine) {
+    return machine->core.stateSize();
+}
+
+int chip8_save_state(const chip8_machine* machine, void* buffer, size_t size) {
+    return machine->core.saveState(static_cast<uint8_t*>(buffer), size) ? 0 : -1;
+}
+
+int chip8_load_state(chip8_machine* machine, const void* buffer, size_t size) {
+    return machine->core.loadState(static_cast<const uint8_t*>(buffer), size) ? 0 : -1;
+}
+
+void chip8_step_batch(chip8_machine* const* machines, size_t count, const uint16_t* keys,
+                      uint32_t cycles, int tick_timers, uint32_t* cycles_run) {
+    for (size_t i = 0; i < count; ++i) {
+        chip8_machine* machine = machines[i];
+        if (keys != nullptr) {
+            chip8_set_keys(machine, keys[i]);
+        }
+        uint32_t ran = machine->core.runCycles(cycles);
+        if (tick_timers) {
+            machine->core.updateTimers();
+        }
+        if (cycles_run != nullptr) {
+            cycles_run[i] = ran;
+        }
+    }
+}
+
+chip8_vecenv* chip8_vecenv_create(size_t count, int quirks, const uint8_t* rom, size_t rom_size,
+                                  uint32_t cycles_per_frame, uint32_t frame_skip,
+                                  uint32_t max_frames, uint64_t seed) {
+    if (quirks < CHIP8_QUIRKS_CHIP8 || quirks > CHIP8_QUIRKS_XOCHIP) {
+        return nullptr;
+    }
+    VecEnvConfig config;
+    config.profile = static_cast<QuirkProfile>(quirks);
+    config.cyclesPerFrame = cycles_per_frame;
+    config.frameSkip = frame_skip;
+    config.maxFrames = max_frames;
+    config.seed = seed;
+    try {
+        chip8_vecenv* env = new chip8_vecenv{VecEnv(count, rom, rom_size, config), {}};
+        if (!env->envs.loadedOk()) {
+            delete env;
+            return nullptr;
+        }
+        env->machines = envHandles(env->envs);
+        return env;
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void chip8_vecenv_destroy(chip8_vecenv* env) {
+    delete env;
+}
+
+size_t chip8_vecenv_size(const chip8_vecenv* env) {
+    return env->envs.size();
+}
+
+size_t chip8_vecenv_observation_size(int format) {
+    ObservationFormat observation;
+    return toObservationFormat(format, observation) ? VecEnv::observationBytes(observation) : 0;
+}
+
+int chip8_vecenv_reset(chip8_vecenv* env, int format, void* observations) {
+    ObservationFormat observation;
+    if (!toObservationFormat(format, observation)) {
+        return -1;
+    }
+    env->envs.reset(observation, observations);
+    return 0;
+}
+
+int chip8_vecenv_step(chip8_vecenv* env, const uint16_t* actions, int format,
+                      void* observations, uint8_t* dones) {
+    ObservationFormat observation;
+    if (!toObservationFormat(format, observation)) {
+        return -1;
+    }
+    env->envs.step(actions, observation, observations, dones);
+    return 0;
+}
+
+const chip8_machine* chip8_vecenv_machine(const chip8_vecenv* env, size_t index) {
+    return &env->machines[index];
+}
+
+chip8_parallel_vecenv* chip8_parallel_vecenv_create(size_t count, int quirks, const uint8_t* rom,
+                                                    size_t rom_size, uint32_t cycles_per_frame,
+                                                    uint32_t frame_skip, uint32_t max_frames,
+                                                    uint64_t seed, int format, unsigned threads, int pin) {
+    ObservationFormat observation;
+    if (quirks < CHIP8_QUIRKS_CHIP8 || quirks > CHIP8_QUIRKS_XOCHIP || !toObservationFormat(format, observation)) {
+        return nullptr;
+    }
+    VecEnvConfig config;
+    config.profile = static_cast<QuirkProfile>(quirks);
+    config.cyclesPerFrame = cycles_per_frame;
+    config.frameSkip = frame_skip;
+    config.maxFrames = max_frames;
+    config.seed = seed;
+    try {
+        // Not movable (it owns running threads), so built in place
+        chip8_parallel_vecenv* env = new chip8_parallel_vecenv{
+            {count, rom, rom_size, config, observation, threads, pin != 0}, {}};
+        if (!env->envs.loadedOk()) {
+            delete env;
+            return nullptr;
+        }
+        env->machines = envHandles(env->envs);
+        return env;
+    } catch (const std::exception&) {   // bad_alloc, or system_error if a thread cannot start
+        return nullptr;
+    }
+}
+
+void chip8_parallel_vecenv_destroy(chip8_parallel_vecenv* env) {
+    delete env;
+}
+
+size_t chip8_parallel_vecenv_size(const chip8_parallel_vecenv* env) {
+    return env->envs.size();
+}
+
+unsigned chip8_parallel_vecenv_threads(const chip8_parallel_vecenv* env) {
+    return env->envs.threadCount();
+}
+
+const void* chip8_parallel_vecenv_observations(const chip8_parallel_vecenv* env) {
+    return env->envs.observations();
+}
+
+const uint8_t* chip8_parallel_vecenv_dones(const chip8_parallel_vecenv* env) {
+    return env->envs.dones();
+}
+
+void chip8_parallel_vecenv_reset(chip8_parallel_vecenv* env) {
+    env->envs.reset();
+}
+
+void chip8_parallel_vecenv_step_async(chip8_parallel_vecenv* env, const uint16_t* actions) {
+    env->envs.stepAsync(actions);
+}
+
+int chip8_parallel_vecenv_ready(const chip8_parallel_vecenv* env) {
+    return env->envs.ready() ? 1 : 0;
+}
+
+void chip8_parallel_vecenv_wait(const chip8_parallel_vecenv* env) {
+    env->envs.wait();
+}
+
+const chip8_machine* chip8_parallel_vecenv_machine(const chip8_parallel_vecenv* env, size_t index) {
+    return &env->machines[index];
+}
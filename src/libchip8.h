@@ -0,0 +1,204 @@
+#ifndef LIBCHIP8_H
+#define LIBCHIP8_H
+
+#include <stddef.h>  /* For size_t */
+#include <stdint.h>  /* For fixed-width integer types */
+
+/*
+ * libchip8: C API for embedding the emulator core
+ *
+ * A plain C interface over Chip8 for programs written in other languages
+ * (Python ctypes/cffi, Go cgo, Rust, C#, ...). Only C types cross the
+ * boundary: opaque handles, integers and buffers owned by the caller.
+ *
+ *   chip8_machine* m = chip8_create(CHIP8_QUIRKS_CHIP8);
+ *   chip8_load_rom(m, rom, rom_size);
+ *   for (;;) {
+ *       chip8_set_keys(m, pressed_mask);
+ *       chip8_run(m, 11);                 // One 60Hz frame at ~700Hz
+ *       chip8_update_timers(m);
+ *       draw(chip8_framebuffer(m, &w, &h));
+ *   }
+ *   chip8_destroy(m);
+ *
+ * WHY allocation-free?
+ * A foreign function call costs tens of nanoseconds on its own, which is
+ * several CHIP-8 instructions. Calls that also allocated, or copied the
+ * framebuffer out, would make that cost grow with every call. Instead
+ * only chip8_create() allocates; everything else works in place or in
+ * buffers the caller owns, and chip8_step_batch() steps many machines in
+ * one call, so the boundary is crossed once per batch, not per machine.
+ *
+ * STABILITY:
+ * Functions are only ever added. CHIP8_API_VERSION is bumped when they
+ * are, and chip8_api_version() reports what the loaded library has.
+ *
+ * THREADS:
+ * A machine must not be used from two threads at once; different
+ * machines are independent.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32)
+#  ifdef LIBCHIP8_BUILD
+#    define CHIP8_API __declspec(dllexport)
+#  else
+#    define CHIP8_API __declspec(dllimport)
+#  endif
+#elif defined(__GNUC__)
+#  define CHIP8_API __attribute__((visibility("default")))
+#else
+#  define CHIP8_API
+#endif
+
+#define CHIP8_API_VERSION 1
+
+/* Quirk profiles (same order as QuirkProfile in quirks.h) */
+#define CHIP8_QUIRKS_CHIP8      0   /* COSMAC VIP */
+#define CHIP8_QUIRKS_CHIP48     1   /* HP-48 CHIP-48 */
+#define CHIP8_QUIRKS_SUPERCHIP  2   /* SUPER-CHIP 1.1 */
+#define CHIP8_QUIRKS_XOCHIP     3   /* XO-CHIP (64KB memory, 4 bitplanes) */
+
+/* Framebuffer layout: rows of CHIP8_ROW_WORDS 64-bit words, always
+ * CHIP8_FRAMEBUFFER_ROWS rows; the current mode uses the top-left
+ * width x height pixels. Bit 63 of word 0 is x = 0. */
+#define CHIP8_ROW_WORDS         2
+#define CHIP8_FRAMEBUFFER_ROWS  64
+
+typedef struct chip8_machine chip8_machine;  /* Opaque */
+
+CHIP8_API int chip8_api_version(void);
+
+/* Create a machine with the given profile. The only call that allocates.
+ * Returns NULL for an unknown profile or if out of memory. */
+CHIP8_API chip8_machine* chip8_create(int quirks);
+CHIP8_API void chip8_destroy(chip8_machine* machine);
+
+/* Back to power-on state (RPL flags are kept, like a real reset) */
+CHIP8_API void chip8_reset(chip8_machine* machine);
+
+/* Copy a ROM to 0x200. Returns 0, or -1 if it does not fit. */
+CHIP8_API int chip8_load_rom(chip8_machine* machine, const uint8_t* data, size_t size);
+
+/* Run up to `cycles` instructions. Returns how many ran: fewer when FX0A
+ * starts waiting for a key, 0 while it keeps waiting. After 00FD the
+ * machine stays on that instruction (see chip8_has_exited). */
+CHIP8_API uint32_t chip8_run(chip8_machine* machine, uint32_t cycles);
+
+/* 60Hz tick of the delay and sound timers */
+CHIP8_API void chip8_update_timers(chip8_machine* machine);
+
+/* Keys 0x0-0xF. chip8_set_keys() sets all 16 from a bitmask (bit K =
+ * key K pressed); only keys that changed are passed on, so FX0A sees
+ * the same presses and releases either way. */
+CHIP8_API void chip8_set_key(chip8_machine* machine, int key, int pressed);
+CHIP8_API void chip8_set_keys(chip8_machine* machine, uint16_t mask);
+
+/* Packed framebuffer of plane 0, valid until the machine is destroyed
+ * (its contents change as the machine runs). width/height may be NULL. */
+CHIP8_API const uint64_t* chip8_framebuffer(const chip8_machine* machine, int* width, int* height);
+CHIP8_API uint64_t chip8_framebuffer_hash(const chip8_machine* machine);  /* All planes */
+CHIP8_API int chip8_sound_active(const chip8_machine* machine);
+CHIP8_API int chip8_waiting_for_key(const chip8_machine* machine);
+CHIP8_API int chip8_has_exited(const chip8_machine* machine);
+CHIP8_API uint8_t chip8_read_memory(const chip8_machine* machine, uint16_t address);
+
+/* Hash of the whole machine state (memory, registers, timers, display),
+ * O(1). Equal states give equal hashes: use it to detect a program stuck
+ * in a loop or to deduplicate states. */
+CHIP8_API uint64_t chip8_state_hash(const chip8_machine* machine);
+
+/* The library never prints. Unknown opcodes are counted instead: returns
+ * how many ran since the last reset, and stores the most recent one in
+ * *last (if last is not NULL). */
+CHIP8_API uint32_t chip8_unknown_opcodes(const chip8_machine* machine, uint16_t* last);
+
+/* Save states in a caller-owned buffer of chip8_state_size() bytes (it
+ * depends on the profile). Both return 0 or -1: saving fails if the buffer
+ * is too small, loading if the size is wrong or the state was saved under
+ * another profile or library version. */
+CHIP8_API size_t chip8_state_size(const chip8_machine* machine);
+CHIP8_API int chip8_save_state(const chip8_machine* machine, void* buffer, size_t size);
+CHIP8_API int chip8_load_state(chip8_machine* machine, const void* buffer, size_t size);
+
+/*
+ * Step a batch of machines, one frame each: apply keys[i] (skipped if
+ * keys is NULL), run `cycles` instructions, then tick the timers if
+ * tick_timers is non-zero. cycles_run[i] receives chip8_run()'s result
+ * (skipped if NULL).
+ */
+CHIP8_API void chip8_step_batch(chip8_machine* const* machines, size_t count, const uint16_t* keys,
+                                uint32_t cycles, int tick_timers, uint32_t* cycles_run);
+
+/*
+ * Batched Environments (see vec_env.h)
+ *
+ * count machines on one ROM, for reinforcement learning. Observations are
+ * written into one contiguous caller-owned buffer of count *
+ * chip8_vecenv_observation_size(format) bytes:
+ *   CHIP8_OBS_PACKED  uint64_t[count][32], bit 63 of each word = x 0
+ *   CHIP8_OBS_PIXELS  uint8_t[count][32][64], 0 or 255
+ * A step applies actions[i] (a key mask), runs frame_skip frames of
+ * cycles_per_frame instructions, and auto-resets envs whose episode ended
+ * (00FD, or max_frames reached; 0 = no limit), setting dones[i] to 1.
+ */
+typedef struct chip8_vecenv chip8_vecenv;  /* Opaque */
+
+#define CHIP8_OBS_PACKED  0
+#define CHIP8_OBS_PIXELS  1
+
+/* Returns NULL for an unknown profile, a ROM that does not fit, or out of memory */
+CHIP8_API chip8_vecenv* chip8_vecenv_create(size_t count, int quirks, const uint8_t* rom, size_t rom_size,
+                                            uint32_t cycles_per_frame, uint32_t frame_skip,
+                                            uint32_t max_frames, uint64_t seed);
+CHIP8_API void chip8_vecenv_destroy(chip8_vecenv* env);
+CHIP8_API size_t chip8_vecenv_size(const chip8_vecenv* env);
+CHIP8_API size_t chip8_vecenv_observation_size(int format);  /* Bytes per env, 0 if unknown */
+CHIP8_API int chip8_vecenv_reset(chip8_vecenv* env, int format, void* observations);
+CHIP8_API int chip8_vecenv_step(chip8_vecenv* env, const uint16_t* actions, int format,
+                                void* observations, uint8_t* dones);  /* dones may be NULL */
+
+/* Env i's machine, read-only (e.g. chip8_read_memory for rewards) */
+CHIP8_API const chip8_machine* chip8_vecenv_machine(const chip8_vecenv* env, size_t index);
+
+/*
+ * Multi-Threaded Batched Environments (see parallel_vec_env.h)
+ *
+ * Like chip8_vecenv, stepped by `threads` worker threads (0 = one per
+ * available CPU), pinned to cores if `pin` is non-zero. The library owns
+ * the observation and done buffers (each worker writes its part first,
+ * so it lands in that worker's NUMA node); they stay valid until destroy
+ * and are up to date once chip8_parallel_vecenv_ready() returns 1.
+ * step_async returns at once; `actions` must stay valid until ready.
+ * All calls on one env must come from one thread.
+ */
+typedef struct chip8_parallel_vecenv chip8_parallel_vecenv;  /* Opaque */
+
+/* Returns NULL for an unknown profile or format, a ROM that does not fit,
+ * or out of memory */
+CHIP8_API chip8_parallel_vecenv* chip8_parallel_vecenv_create(size_t count, int quirks, const uint8_t* rom,
+                                                              size_t rom_size, uint32_t cycles_per_frame,
+                                                              uint32_t frame_skip, uint32_t max_frames,
+                                                              uint64_t seed, int format, unsigned threads,
+                                                              int pin);
+CHIP8_API void chip8_parallel_vecenv_destroy(chip8_parallel_vecenv* env);
+CHIP8_API size_t chip8_parallel_vecenv_size(const chip8_parallel_vecenv* env);
+CHIP8_API unsigned chip8_parallel_vecenv_threads(const chip8_parallel_vecenv* env);
+CHIP8_API const void* chip8_parallel_vecenv_observations(const chip8_parallel_vecenv* env);
+CHIP8_API const uint8_t* chip8_parallel_vecenv_dones(const chip8_parallel_vecenv* env);
+CHIP8_API void chip8_parallel_vecenv_reset(chip8_parallel_vecenv* env);   /* Blocks until done */
+CHIP8_API void chip8_parallel_vecenv_step_async(chip8_parallel_vecenv* env, const uint16_t* actions);
+CHIP8_API int chip8_parallel_vecenv_ready(const chip8_parallel_vecenv* env);   /* 1 when the step is done */
+CHIP8_API void chip8_parallel_vecenv_wait(const chip8_parallel_vecenv* env);
+
+/* Env i's machine, read-only; only while ready */
+CHIP8_API const chip8_machine* chip8_parallel_vecenv_machine(const chip8_parallel_vecenv* env, size_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LIBCHIP8_H
@@ -1,7 +1,19 @@
+#include "beeper.h"
 #include "chip8.h"
+#include "frame_recorder.h"
+#include "frame_server.h"
+#include "netplay.h"
 #include "raylib.h"
+#include "report.h"
+#include "udp_transport.h"
+#include <array>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <vector>
 
 /*
  * CHIP-8 Emulator - Main Application
@@ -10,17 +22,22 @@
  * 1. Window creation and graphics rendering (Raylib)
  * 2. Input handling (keyboard mapping)
  * 3. Main emulation loop timing
- * 4. Audio output (beep sound)
+ * 4. Audio output (synthesised beeper, see beeper.h)
+ * 5. Two-player netplay (rollback over UDP, see netplay.h)
+ * 6. Streaming the display to remote viewers (see frame_server.h)
  */
 
 // Display configuration
-constexpr int SCALE_FACTOR = 15;  // Each CHIP-8 pixel = 15x15 screen pixels
-constexpr int WINDOW_WIDTH = Chip8::DISPLAY_WIDTH * SCALE_FACTOR;   // 960
-constexpr int WINDOW_HEIGHT = Chip8::DISPLAY_HEIGHT * SCALE_FACTOR; // 480
+// The window is sized for SUPER-CHIP hi-res (128x64); 64x32 programs are
+// simply scaled twice as much
+constexpr int SCALE_FACTOR = 8;   // Each hi-res pixel = 8x8 screen pixels
+constexpr int WINDOW_WIDTH = Chip8::DISPLAY_WIDTH * SCALE_FACTOR;   // 1024
+constexpr int WINDOW_HEIGHT = Chip8::DISPLAY_HEIGHT * SCALE_FACTOR; // 512
 
 // Emulation speed
 constexpr int CPU_FREQ_HZ = 700;  // CHIP-8 CPU cycles per second
 constexpr int TIMER_FREQ_HZ = 60; // Timer updates per second
+constexpr uint32_t MAX_CYCLES_PER_FRAME = CPU_FREQ_HZ / 10;  // Catch-up limit
 
 /*
  * Keyboard Mapping: CHIP-8 to Modern Keyboard
@@ -64,74 +81,326 @@ void handleInput(Chip8& chip8) {
 }
 
 /*
- * Render Display
+ * Read Keys as a Mask
  * 
- * Draws the CHIP-8 64x32 display scaled up to window size
- * Each CHIP-8 pixel becomes a SCALE_FACTOR x SCALE_FACTOR rectangle
+ * Netplay hands the local keys to the rollback session (bit K = CHIP-8
+ * key K) instead of setting them on the machine directly
  */
-void renderDisplay(const Chip8& chip8) {
-    BeginDrawing();
-    ClearBackground(BLACK);
+uint16_t readKeyMask() {
+    uint16_t mask = 0;
+    for (const auto& mapping : keyMap) {
+        if (IsKeyDown(mapping.raylibKey)) {
+            mask |= static_cast<uint16_t>(1u << mapping.chip8Key);
+        }
+    }
+    return mask;
+}
+
+/*
+ * Display Texture
+ * 
+ * Instead of issuing one DrawRectangle per lit pixel every frame, we keep
+ * a 128x64 texture on the GPU and let it scale the image up for us.
+ * In 64x32 mode only the top-left quarter is used and drawn.
+ * The CPU-side copy (pixels) is only rewritten for rows the emulator
+ * reports as dirty, so a frame that moves one sprite converts a handful
+ * of rows instead of the whole screen.
+ */
+struct DisplayTexture {
+    Texture2D texture;
+    std::array<Color, Chip8::DISPLAY_WIDTH * Chip8::DISPLAY_HEIGHT> pixels;
+};
+
+DisplayTexture createDisplayTexture() {
+    DisplayTexture display;
+    display.pixels.fill(BLACK);
+    
+    Image image = GenImageColor(Chip8::DISPLAY_WIDTH, Chip8::DISPLAY_HEIGHT, BLACK);
+    display.texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    
+    // Nearest-neighbour scaling keeps the pixels crisp
+    SetTextureFilter(display.texture, TEXTURE_FILTER_POINT);
+    return display;
+}
+
+/*
+ * XO-CHIP Palette
+ * 
+ * With bitplanes each pixel is a 4-bit colour index (one bit per plane).
+ * Index 0 is the background and 1 the classic foreground, so programs
+ * that only draw on plane 0 look exactly like plain CHIP-8.
+ */
+const Color PLANE_PALETTE[16] = {
+    BLACK, WHITE, Color{170, 170, 170, 255}, Color{85, 85, 85, 255},
+    Color{255, 0, 0, 255}, Color{0, 255, 0, 255}, Color{0, 0, 255, 255}, Color{255, 255, 0, 255},
+    Color{136, 0, 0, 255}, Color{0, 136, 0, 255}, Color{0, 0, 136, 255}, Color{136, 136, 0, 255},
+    Color{255, 0, 255, 255}, Color{0, 255, 255, 255}, Color{136, 0, 136, 255}, Color{0, 136, 136, 255}
+};
+
+/*
+ * Audio Callback
+ * 
+ * Raylib calls this from its audio thread whenever the stream needs more
+ * samples. The callback has no user-data argument, so it reaches the
+ * beeper through a pointer set up in main().
+ */
+Beeper* activeBeeper = nullptr;
+
+void audioCallback(void* buffer, unsigned int frames) {
+    activeBeeper->render(static_cast<int16_t*>(buffer), frames);
+}
+
+/*
+ * Update Display Texture
+ * 
+ * Converts only the dirty rows to RGBA and uploads the smallest
+ * row span that covers them in a single UpdateTextureRec call.
+ * 
+ * @param dirtyRows: Bit N set = row N changed (from Chip8::takeDirtyRows)
+ */
+void updateDisplayTexture(DisplayTexture& display, const Chip8& chip8, uint64_t dirtyRows) {
+    if (dirtyRows == 0) {
+        return;  // Nothing changed, the GPU copy is still valid
+    }
+    
+    const int width = chip8.getWidth();
+    const int height = chip8.getHeight();
+    const int planes = chip8.getPlaneCount();
+    int firstRow = height;
+    int lastRow = -1;
     
-    // Draw each pixel
-    for (int y = 0; y < Chip8::DISPLAY_HEIGHT; ++y) {
-        for (int x = 0; x < Chip8::DISPLAY_WIDTH; ++x) {
-            if (chip8.getPixel(x, y)) {
-                // Pixel is ON - draw white rectangle
-                DrawRectangle(
-                    x * SCALE_FACTOR,
-                    y * SCALE_FACTOR,
-                    SCALE_FACTOR,
-                    SCALE_FACTOR,
-                    WHITE
-                );
+    for (int y = 0; y < height; ++y) {
+        if ((dirtyRows & (uint64_t{1} << y)) == 0) {
+            continue;
+        }
+        
+        // Walk each packed word from its leftmost bit (bit 63 = x 0)
+        Color* row = &display.pixels[y * Chip8::DISPLAY_WIDTH];
+        if (planes == 1) {
+            const uint64_t* words = chip8.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                uint64_t bits = words[x >> 6];
+                row[x] = ((bits >> (63 - (x & 63))) & 1) ? WHITE : BLACK;
+            }
+        } else {
+            // XO-CHIP: plane N supplies bit N of the palette index
+            for (int x = 0; x < width; ++x) {
+                int index = 0;
+                for (int p = 0; p < planes; ++p) {
+                    uint64_t bits = chip8.getPlaneRow(p, y)[x >> 6];
+                    index |= static_cast<int>((bits >> (63 - (x & 63))) & 1) << p;
+                }
+                row[x] = PLANE_PALETTE[index];
             }
         }
+        
+        if (y < firstRow) firstRow = y;
+        lastRow = y;
+    }
+    
+    if (lastRow < 0) {
+        return;  // Only rows outside the current mode were flagged
     }
     
+    // Full texture-width rows, so the span is contiguous in pixels
+    Rectangle span = {
+        0.0f,
+        static_cast<float>(firstRow),
+        static_cast<float>(Chip8::DISPLAY_WIDTH),
+        static_cast<float>(lastRow - firstRow + 1)
+    };
+    UpdateTextureRec(display.texture, span, &display.pixels[firstRow * Chip8::DISPLAY_WIDTH]);
+}
+
+/*
+ * Render Display
+ * 
+ * Draws the visible part of the display texture (64x32 or 128x64)
+ * scaled up to the window size
+ */
+void renderDisplay(const DisplayTexture& display, int width, int height) {
+    BeginDrawing();
+    ClearBackground(BLACK);
+    
+    Rectangle source = {
+        0.0f, 0.0f,
+        static_cast<float>(width),
+        static_cast<float>(height)
+    };
+    Rectangle dest = {
+        0.0f, 0.0f,
+        static_cast<float>(WINDOW_WIDTH),
+        static_cast<float>(WINDOW_HEIGHT)
+    };
+    DrawTexturePro(display.texture, source, dest, Vector2{0.0f, 0.0f}, 0.0f, WHITE);
+    
     // Draw FPS counter
     DrawText(TextFormat("FPS: %d", GetFPS()), 10, 10, 20, GREEN);
     
     EndDrawing();
 }
 
+/*
+ * Print Command Line Help
+ */
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <ROM file> [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --quirks chip8|chip48|schip|xochip  Interpreter quirk profile (default chip8)\n";
+    std::cerr << "  --record FILE                Record drawn frames (see chip8_rec2img)\n";
+    std::cerr << "  --netplay PORT:HOST:PORT     Two-player rollback netplay: local port, peer\n";
+    std::cerr << "  --max-rollback N             Frames of remote keys predicted (default 8)\n";
+    std::cerr << "  --net-latency MS             Netplay testing: delay every packet sent\n";
+    std::cerr << "  --net-jitter MS              Netplay testing: up to this much more, random\n";
+    std::cerr << "  --net-loss PERCENT           Netplay testing: drop packets\n";
+    std::cerr << "  --stream ADDRESS             Serve frames to chip8_viewer (tcp:[HOST:]PORT or unix:PATH)\n";
+    std::cerr << "Example: " << program << " roms/pong.ch8\n";
+    std::cerr << "         " << program << " roms/blinky.ch8 --quirks schip --record blinky.c8rec\n";
+    std::cerr << "         " << program << " roms/pong2.ch8 --netplay 7000:192.168.1.20:7000\n";
+}
+
+/*
+ * Parse "localPort:host:remotePort"
+ */
+bool parseNetplayTarget(const std::string& value, uint16_t& localPort, std::string& host, uint16_t& remotePort) {
+    std::size_t first = value.find(':');
+    std::size_t last = value.rfind(':');
+    if (first == std::string::npos || first == last) {
+        return false;
+    }
+    long local = std::strtol(value.substr(0, first).c_str(), nullptr, 10);
+    long remote = std::strtol(value.substr(last + 1).c_str(), nullptr, 10);
+    host = value.substr(first + 1, last - first - 1);
+    if (local <= 0 || local > 65535 || remote <= 0 || remote > 65535 || host.empty()) {
+        return false;
+    }
+    localPort = static_cast<uint16_t>(local);
+    remotePort = static_cast<uint16_t>(remote);
+    return true;
+}
+
 /*
  * Main Function
  */
 int main(int argc, char* argv[]) {
     // Check command line arguments
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <ROM file>\n";
-        std::cerr << "Example: " << argv[0] << " roms/pong.ch8\n";
+    if (argc < 2 || argc % 2 != 0) {
+        printUsage(argv[0]);
         return 1;
     }
     
     std::string romPath = argv[1];
+    std::string recordPath;
+    QuirkProfile quirks = QuirkProfile::Chip8;
+    std::string netplayTarget;
+    NetplayConfig netplayConfig;
+    netplayConfig.cyclesPerFrame = CPU_FREQ_HZ / TIMER_FREQ_HZ;
+    NetConditions netConditions;
+    std::string streamAddress;
+    
+    // Options come in "--name value" pairs after the ROM path
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        
+        if (option == "--record") {
+            recordPath = value;
+        } else if (option == "--stream") {
+            streamAddress = value;
+        } else if (option == "--netplay") {
+            netplayTarget = value;
+        } else if (option == "--max-rollback") {
+            netplayConfig.maxRollback = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (option == "--net-latency") {
+            netConditions.latency = std::strtod(value.c_str(), nullptr) / 1000.0;
+        } else if (option == "--net-jitter") {
+            netConditions.jitter = std::strtod(value.c_str(), nullptr) / 1000.0;
+        } else if (option == "--net-loss") {
+            netConditions.loss = std::strtod(value.c_str(), nullptr) / 100.0;
+        } else if (option == "--quirks") {
+            if (!parseQuirkProfile(value, quirks)) {
+                std::cerr << "[ERROR] Unknown quirk profile: " << value << "\n";
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else {
+            std::cerr << "[ERROR] Unknown option: " << option << "\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    
+    // Optional frame recording (convert later with chip8_rec2img)
+    FrameRecorder recorder;
+    if (!recordPath.empty() && !recorder.open(recordPath)) {
+        return 1;
+    }
+    
+    // Optional streaming to viewers (copies the dirty rows, never waits)
+    FrameServer server;
+    if (!streamAddress.empty() && !server.open(streamAddress)) {
+        return 1;
+    }
     
     // Initialize CHIP-8
+    // The quirk profile picks the interpreter instantiation once, here,
+    // instead of testing quirk flags on every instruction
     Chip8 chip8;
-    if (!chip8.loadROM(romPath)) {
+    chip8.setQuirkProfile(quirks);
+    std::cout << "[CHIP-8] System initialized\n";
+    if (!loadROMFile(chip8, romPath)) {
         std::cerr << "[ERROR] Failed to load ROM\n";
         return 1;
     }
     
+    // Netplay: both sides must agree on the ROM and profile (the session
+    // id) before the first frame; the session reseeds the machine from it
+    UdpTransport net;
+    std::unique_ptr<RollbackSession> netplay;
+    if (!netplayTarget.empty()) {
+        uint16_t localPort = 0;
+        uint16_t remotePort = 0;
+        std::string host;
+        if (!parseNetplayTarget(netplayTarget, localPort, host, remotePort)) {
+            std::cerr << "[ERROR] --netplay expects LOCALPORT:HOST:REMOTEPORT\n";
+            return 1;
+        }
+        if (!net.open(localPort, host, remotePort)) {
+            return 1;
+        }
+        net.setConditions(netConditions);
+        std::ifstream romFile(romPath, std::ios::binary);
+        std::vector<uint8_t> romBytes((std::istreambuf_iterator<char>(romFile)), std::istreambuf_iterator<char>());
+        netplayConfig.sessionId = RollbackSession::sessionIdFor(romBytes.data(), romBytes.size(), quirks);
+        netplay.reset(new RollbackSession(chip8, netplayConfig));
+    }
+    
     // Initialize Raylib window
     InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "CHIP-8 Emulator");
     SetTargetFPS(60);  // Cap at 60 FPS for smooth rendering
     
-    // Initialize audio for beep sound
-    InitAudioDevice();
+    // GPU-side copy of the display (needs the window's GL context)
+    DisplayTexture display = createDisplayTexture();
     
-    // Generate a simple beep sound (440 Hz sine wave)
-    Wave wave = LoadWaveFromMemory(".wav", nullptr, 0);  // We'll create a proper beep
-    // For now, we'll use a simple approach - in Phase 3 we'll improve this
-    Sound beepSound = LoadSound("resources/beep.wav");  // You'll need to provide this
-    // If you don't have a beep sound, we can generate one programmatically later
+    // Initialize audio: a 16-bit mono stream filled by the beeper
+    // (samples are generated on the fly, nothing is loaded from disk)
+    InitAudioDevice();
+    Beeper beeper;
+    activeBeeper = &beeper;
+    SetAudioStreamBufferSizeDefault(1024);  // ~23ms per device buffer
+    AudioStream beepStream = LoadAudioStream(Beeper::DEFAULT_SAMPLE_RATE, 16, 1);
+    SetAudioStreamCallback(beepStream, audioCallback);
+    PlayAudioStream(beepStream);
     
     std::cout << "\n==============================================\n";
     std::cout << "CHIP-8 EMULATOR STARTED\n";
     std::cout << "==============================================\n";
     std::cout << "ROM: " << romPath << "\n";
+    std::cout << "Quirks: " << quirkProfileName(quirks) << "\n";
+    if (netplay) {
+        std::cout << "Netplay: " << netplayTarget << " (both players share the keypad)\n";
+    }
     std::cout << "Controls: See README.md for key mapping\n";
     std::cout << "Press ESC to quit\n";
     std::cout << "==============================================\n\n";
@@ -142,49 +411,123 @@ int main(int argc, char* argv[]) {
     const double cycleInterval = 1.0 / CPU_FREQ_HZ;      // Time per CPU cycle
     const double timerInterval = 1.0 / TIMER_FREQ_HZ;    // Time per timer update
     
-    // Main emulation loop
+    // Main emulation loop (one iteration per rendered frame)
+    uint32_t frameNumber = 0;
+    bool eventWaiting = false;
+    bool desyncReported = false;
+    uint32_t unknownOpcodesReported = 0;
     while (!WindowShouldClose()) {
         double currentTime = GetTime();
+        reportUnknownOpcodes(chip8, unknownOpcodesReported);   // From the previous frame
+        
+        if (netplay) {
+            // Netplay: exactly one emulated frame per rendered frame (both
+            // sides must run the same frames), driven by the session
+            uint8_t packet[UdpTransport::MAX_DATAGRAM];
+            while (std::size_t size = net.receive(packet, sizeof(packet), currentTime)) {
+                netplay->readPacket(packet, size);
+            }
+            if (netplay->advance(readKeyMask())) {
+                beeper.pushTick(chip8);
+            }
+            net.send(packet, netplay->writePacket(packet), currentTime);
+            if (netplay->desynced() && !desyncReported) {
+                std::cerr << "[ERROR] Netplay desync at frame " << netplay->desyncAt()
+                          << " (peer runs a different build or ROM?)\n";
+                desyncReported = true;
+            }
+            
+            uint64_t dirtyRows = chip8.takeDirtyRows();
+            updateDisplayTexture(display, chip8, dirtyRows);
+            server.publish(chip8, dirtyRows, frameNumber);
+            if (chip8.shouldDraw()) {
+                recorder.capture(chip8, dirtyRows, frameNumber);
+            }
+            chip8.clearDrawFlag();
+            renderDisplay(display, chip8.getWidth(), chip8.getHeight());
+            ++frameNumber;
+            continue;
+        }
         
         // Handle input
         handleInput(chip8);
         
         // Execute CPU cycles
-        // Run multiple cycles per frame to achieve target CPU speed
-        if (currentTime - lastCycleTime >= cycleInterval) {
-            chip8.emulateCycle();
+        // Run every cycle that became due since the last frame as one batch
+        // (at 60 FPS that is CPU_FREQ_HZ / 60, about 11 cycles per frame)
+        uint32_t cyclesDue = static_cast<uint32_t>((currentTime - lastCycleTime) / cycleInterval);
+        if (cyclesDue > MAX_CYCLES_PER_FRAME) {
+            // After a stall (e.g. window dragged) don't try to catch up
+            chip8.runCycles(MAX_CYCLES_PER_FRAME);
+            lastCycleTime = currentTime;
+        } else {
+            chip8.runCycles(cyclesDue);
+            lastCycleTime += cyclesDue * cycleInterval;
+        }
+        
+        // FX0A: time spent waiting for a key is not owed to the CPU
+        if (chip8.isWaitingForKey()) {
             lastCycleTime = currentTime;
         }
         
-        // Update timers at 60Hz
+        // Update timers at 60Hz, handing each tick's sound state to the
+        // audio thread (a copy into a lock-free ring, never waits)
         if (currentTime - lastTimerUpdate >= timerInterval) {
             chip8.updateTimers();
+            beeper.pushTick(chip8);
             lastTimerUpdate = currentTime;
         }
         
-        // Play beep sound if sound timer is active
-        // Note: We'll implement proper audio in Phase 3
-        // if (chip8.shouldBeep()) {
-        //     if (!IsSoundPlaying(beepSound)) {
-        //         PlaySound(beepSound);
-        //     }
-        // }
+        // Convert only the rows that changed since the last frame,
+        // then draw (we still render every frame to show FPS and
+        // handle window events)
+        uint64_t dirtyRows = chip8.takeDirtyRows();
+        updateDisplayTexture(display, chip8, dirtyRows);
+        
+        // Viewers get the same rows (a no-op without --stream)
+        server.publish(chip8, dirtyRows, frameNumber);
         
-        // Render display if draw flag is set
+        // Hand drawn frames to the recorder (copies the same rows, never waits)
         if (chip8.shouldDraw()) {
-            renderDisplay(chip8);
-            chip8.clearDrawFlag();
-        } else {
-            // Still render to show FPS and handle window events
-            renderDisplay(chip8);
+            recorder.capture(chip8, dirtyRows, frameNumber);
+        }
+        chip8.clearDrawFlag();
+        
+        // Idle wait: FX0A is blocked and no timer is counting, so nothing
+        // on screen or in the speaker can change until the user presses
+        // a key. Event waiting makes EndDrawing() sleep in the OS event
+        // queue instead of redrawing 60 times per second. While a timer
+        // is still running we keep ticking normally until it reaches 0.
+        bool idle = chip8.isWaitingForKey() && !chip8.timersActive();
+        if (idle != eventWaiting) {
+            if (idle) {
+                EnableEventWaiting();
+            } else {
+                DisableEventWaiting();
+            }
+            eventWaiting = idle;
         }
+        
+        renderDisplay(display, chip8.getWidth(), chip8.getHeight());
+        ++frameNumber;
     }
     
     // Cleanup
-    // UnloadSound(beepSound);
+    StopAudioStream(beepStream);
+    UnloadAudioStream(beepStream);  // Stops the callback before beeper goes away
+    activeBeeper = nullptr;
+    UnloadTexture(display.texture);
+    recorder.close();
+    server.close();
     CloseAudioDevice();
     CloseWindow();
     
+    if (netplay) {
+        const NetplayStats& stats = netplay->stats();
+        std::cout << "[NET] " << stats.rollbacks << " rollbacks (deepest " << stats.deepestRollback
+                  << " frames, slowest " << stats.slowestRollback * 1e6 << " us), "
+                  << stats.stalls << " frames waited for the peer\n";
+    }
     std::cout << "\n[CHIP-8] Emulator stopped\n";
     
     return 0;
@@ -0,0 +1,271 @@
+#include "netplay.h"
+#include "hash.h"      // For the session seed
+#include <algorithm>   // For std::min, std::max
+#include <chrono>      // For timing rollbacks
+#include <cstring>     // For memcmp
+
+constexpr char PACKET_MAGIC[4] = {'C', '8', 'N', 'P'};
+constexpr std::size_t PACKET_HEADER_SIZE = 33;
+// Enough: the peer is never more than 2 * MAX_ROLLBACK frames behind us
+constexpr uint32_t MAX_PACKET_KEYS = 128;
+static_assert(MAX_PACKET_KEYS > 2 * RollbackSession::MAX_ROLLBACK, "packets must reach a lagging peer");
+static_assert(RollbackSession::MAX_PACKET_SIZE == PACKET_HEADER_SIZE + 2 * MAX_PACKET_KEYS, "packet size");
+
+// Little-endian helpers for the packet fields
+static void putU16(uint8_t* p, uint16_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+static void putU32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        p[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+}
+
+static void putU64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; ++i) {
+        p[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+}
+
+static uint16_t getU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t* p) {
+    uint32_t v = 0;
+    for (int i = 3; i >= 0; --i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+static uint64_t getU64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+/*
+ * Constructor
+ *
+ * Reseeds the machine from the session id (CXNN must produce the same
+ * numbers on both sides) and allocates every snapshot up front, so a
+ * frame never allocates.
+ */
+RollbackSession::RollbackSession(Chip8& machine, const NetplayConfig& config)
+    : machine(machine), config(config) {
+    this->config.maxRollback = std::max<uint32_t>(1, std::min(config.maxRollback, MAX_ROLLBACK));
+    machine.seedRandom(seedFor(config.sessionId));
+    remoteFrame.fill(NO_FRAME);
+
+    snapshots.resize(this->config.maxRollback + 2);
+    for (Snapshot& snapshot : snapshots) {
+        snapshot.state.resize(machine.stateSize());
+    }
+}
+
+uint32_t RollbackSession::seedFor(uint64_t sessionId) {
+    return static_cast<uint32_t>(mix64(sessionId));
+}
+
+uint64_t RollbackSession::sessionIdFor(const uint8_t* rom, std::size_t size, QuirkProfile profile) {
+    return mix64(hashBytes(rom, size) ^ static_cast<uint64_t>(profile));
+}
+
+/*
+ * Advance One Frame
+ *
+ * Applies a pending correction first, so the frame runs on top of the
+ * corrected past.
+ */
+bool RollbackSession::advance(uint16_t keys) {
+    rollback();
+    if (currentFrame >= remoteNext + config.maxRollback) {   // remoteNext may be ahead of us
+        ++counters.stalls;
+        return false;
+    }
+
+    localKeys[currentFrame % HISTORY] = keys;
+    saveSnapshot(currentFrame);
+    runFrame(currentFrame);
+    ++currentFrame;
+    checkDesync();
+    return true;
+}
+
+// One 60Hz frame: both players' keys, the frame's instructions, a timer tick
+void RollbackSession::runFrame(uint32_t frame) {
+    const uint32_t slot = frame % HISTORY;
+    const uint16_t remote = remoteKeysFor(frame);
+    usedRemote[slot] = remote;
+    machine.setKeys(static_cast<uint16_t>(localKeys[slot] | remote));
+    machine.runCycles(config.cyclesPerFrame);
+    machine.updateTimers();
+}
+
+// The peer's keys for a frame if they have arrived, else a prediction:
+// whatever it held in the last frame we have without gaps
+uint16_t RollbackSession::remoteKeysFor(uint32_t frame) const {
+    const uint32_t slot = frame % HISTORY;
+    if (remoteFrame[slot] == frame) {
+        return remoteKeys[slot];
+    }
+    return remoteNext > 0 ? remoteKeys[(remoteNext - 1) % HISTORY] : 0;
+}
+
+/*
+ * Rollback
+ *
+ * Restore the snapshot taken before the first mispredicted frame and run
+ * every frame since again. Snapshots of the re-run frames are replaced,
+ * since they were built on the wrong keys.
+ */
+void RollbackSession::rollback() {
+    const uint32_t from = rollbackFrom;
+    rollbackFrom = NO_FRAME;
+    if (from >= currentFrame) {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    Snapshot* snapshot = findSnapshot(from);
+    if (snapshot == nullptr || !machine.loadState(snapshot->state.data(), snapshot->state.size())) {
+        return;   // Cannot happen: advance() never runs past the snapshot ring
+    }
+    for (uint32_t frame = from; frame < currentFrame; ++frame) {
+        if (frame != from) {
+            saveSnapshot(frame);
+        }
+        runFrame(frame);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const uint32_t depth = currentFrame - from;
+    ++counters.rollbacks;
+    counters.framesResimulated += depth;
+    counters.deepestRollback = std::max(counters.deepestRollback, depth);
+    counters.slowestRollback = std::max(counters.slowestRollback, seconds);
+}
+
+void RollbackSession::saveSnapshot(uint32_t frame) {
+    Snapshot& snapshot = snapshots[frame % snapshots.size()];
+    machine.saveState(snapshot.state.data(), snapshot.state.size());
+    snapshot.frame = frame;
+    snapshot.hash = machine.getStateHash();   // O(1), no pass over the buffer
+}
+
+RollbackSession::Snapshot* RollbackSession::findSnapshot(uint32_t frame) {
+    Snapshot& snapshot = snapshots[frame % snapshots.size()];
+    return snapshot.frame == frame ? &snapshot : nullptr;
+}
+
+// Newest snapshot that no later packet can change: every remote key
+// before it is known and no correction before it is pending
+uint32_t RollbackSession::latestConfirmedSnapshot() const {
+    if (currentFrame == 0) {
+        return NO_FRAME;
+    }
+    return std::min({remoteNext, currentFrame - 1, rollbackFrom});
+}
+
+/*
+ * Write a Packet
+ *
+ * Carries every local key the peer has not acknowledged yet, so each
+ * packet alone brings the peer fully up to date.
+ */
+std::size_t RollbackSession::writePacket(uint8_t* out) {
+    uint32_t checkFrame = latestConfirmedSnapshot();
+    uint64_t checkHash = 0;
+    Snapshot* snapshot = checkFrame != NO_FRAME ? findSnapshot(checkFrame) : nullptr;
+    if (snapshot != nullptr) {
+        checkHash = snapshot->hash;
+    } else {
+        checkFrame = NO_FRAME;
+    }
+
+    const uint32_t oldest = currentFrame > MAX_PACKET_KEYS ? currentFrame - MAX_PACKET_KEYS : 0;
+    const uint32_t first = std::max(std::min(peerAck, currentFrame), oldest);
+    const uint32_t count = currentFrame - first;
+
+    std::memcpy(out, PACKET_MAGIC, sizeof(PACKET_MAGIC));
+    putU64(out + 4, config.sessionId);
+    putU32(out + 12, remoteNext);
+    putU32(out + 16, checkFrame);
+    putU64(out + 20, checkHash);
+    putU32(out + 28, first);
+    out[32] = static_cast<uint8_t>(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        putU16(out + PACKET_HEADER_SIZE + 2 * i, localKeys[(first + i) % HISTORY]);
+    }
+    return PACKET_HEADER_SIZE + 2 * count;
+}
+
+/*
+ * Read a Packet
+ *
+ * Stores the peer's keys, then walks the frames that just became fully
+ * known: any that ran on a wrong prediction schedules a rollback (done
+ * by the next advance()).
+ */
+void RollbackSession::readPacket(const uint8_t* data, std::size_t size) {
+    if (size < PACKET_HEADER_SIZE || std::memcmp(data, PACKET_MAGIC, sizeof(PACKET_MAGIC)) != 0 ||
+        getU64(data + 4) != config.sessionId || size != PACKET_HEADER_SIZE + 2 * std::size_t{data[32]}) {
+        ++counters.packetsRejected;
+        return;
+    }
+
+    peerAck = std::max(peerAck, getU32(data + 12));
+    const uint32_t first = getU32(data + 28);
+    const uint32_t count = data[32];
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t frame = first + i;
+        // Already known, or so far ahead it would overwrite live slots
+        if (frame < remoteNext || frame - remoteNext >= HISTORY / 2) {
+            continue;
+        }
+        remoteKeys[frame % HISTORY] = getU16(data + PACKET_HEADER_SIZE + 2 * i);
+        remoteFrame[frame % HISTORY] = frame;
+    }
+
+    while (remoteFrame[remoteNext % HISTORY] == remoteNext) {
+        const uint32_t slot = remoteNext % HISTORY;
+        if (remoteNext < currentFrame && usedRemote[slot] != remoteKeys[slot]) {
+            rollbackFrom = std::min(rollbackFrom, remoteNext);
+        }
+        ++remoteNext;
+    }
+
+    const uint32_t checkFrame = getU32(data + 16);
+    if (remoteCheckFrame == NO_FRAME && checkFrame != NO_FRAME) {
+        remoteCheckFrame = checkFrame;
+        remoteCheckHash = getU64(data + 20);
+    }
+    checkDesync();
+}
+
+/*
+ * Desync Check
+ *
+ * Compares the peer's hash once our own snapshot of that frame is final.
+ * A check whose snapshot has already left the ring is dropped; the peer
+ * sends a new one with every packet.
+ */
+void RollbackSession::checkDesync() {
+    if (remoteCheckFrame == NO_FRAME) {
+        return;
+    }
+    const uint32_t confirmed = latestConfirmedSnapshot();
+    if (confirmed == NO_FRAME || remoteCheckFrame > confirmed) {
+        return;   // Not there yet
+    }
+    Snapshot* snapshot = findSnapshot(remoteCheckFrame);
+    if (snapshot != nullptr && snapshot->hash != remoteCheckHash && desyncFrame == NO_FRAME) {
+        desyncFrame = remoteCheckFrame;
+    }
+    remoteCheckFrame = NO_FRAME;
+}
@@ -0,0 +1,144 @@
+#ifndef NETPLAY_H
+#define NETPLAY_H
+
+#include "chip8.h"
+#include <array>    // For the input history
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+#include <vector>   // For the snapshot ring
+
+/*
+ * Rollback Netplay
+ *
+ * Two players, one machine each, kept in lockstep without waiting for
+ * the network. Both machines run the same ROM with the same seed; every
+ * frame the keypad is local keys OR remote keys (CHIP-8 two-player
+ * games give each player their own keys on the one keypad).
+ *
+ * ROLLBACK:
+ * The remote keys for a frame arrive a round trip too late to wait for.
+ * So each side PREDICTS them (the peer is still holding what it held in
+ * the last frame we know of) and runs the frame at once. Before every
+ * frame it saves a snapshot. When the real keys for an old frame arrive
+ * and differ from the prediction, it restores that frame's snapshot and
+ * re-simulates every frame since with the corrected keys - all within
+ * one host frame, so the player only sees the correction.
+ *
+ *   frame:     ...  97   98   99   100  <- current
+ *   remote:         ok   ok   ?    ?      (predicted: same as 98)
+ *   keys for 99 arrive, differ -> load snapshot 99, run 99 and 100 again
+ *
+ * A side may run at most maxRollback frames past the last remote keys
+ * it has; beyond that, advance() refuses (the caller skips a frame,
+ * which lets the peer catch up). That bounds both the snapshot ring and
+ * the worst-case re-simulation cost: maxRollback frames of
+ * cyclesPerFrame instructions plus one loadState().
+ *
+ * WHY this is cheap enough:
+ * A save state is a few KB (64KB with XO-CHIP) copied with memcpy, and
+ * a frame is ~11 instructions; even a full 8-frame rollback is a few
+ * microseconds, far inside a 16.7ms frame. chip8_netplay reports the
+ * worst case measured during a session.
+ *
+ * PACKETS (little-endian, one UDP datagram each, sent every frame):
+ *   magic "C8NP" (4), session id (u64)
+ *   ack (u32)          next remote frame we still need (all before it received)
+ *   check frame (u32), check hash (u64)  desync detection, see below
+ *   first frame (u32), count (u8), count x keys (u16)
+ * Every packet repeats all local keys the peer has not acknowledged, so
+ * a lost packet costs nothing and there is no retransmission logic.
+ *
+ * DESYNC DETECTION:
+ * Once all keys before a frame are known on both sides, the state at
+ * its start must be identical. Each packet carries the hash of one such
+ * confirmed snapshot; the receiver compares it with its own and flags
+ * a desync (a bug, or peers built with different cores).
+ *
+ * The session never touches the network: the caller moves packets
+ * between writePacket()/readPacket() and a transport (udp_transport.h).
+ */
+
+struct NetplayConfig {
+    uint32_t cyclesPerFrame = 11;   // ~700Hz at 60 frames per second
+    uint32_t maxRollback = 8;       // Frames of prediction allowed (<= MAX_ROLLBACK)
+    uint64_t sessionId = 0;         // Same on both sides (sessionIdFor()); seeds CXNN
+};
+
+struct NetplayStats {
+    uint64_t rollbacks = 0;            // Corrections applied
+    uint64_t framesResimulated = 0;
+    uint32_t deepestRollback = 0;      // Frames re-simulated by one correction
+    double slowestRollback = 0.0;      // Seconds for one restore + re-simulation
+    uint64_t stalls = 0;               // advance() calls refused
+    uint64_t packetsRejected = 0;      // Wrong magic, session or size
+};
+
+class RollbackSession {
+public:
+    static constexpr uint32_t MAX_ROLLBACK = 60;
+    static constexpr std::size_t MAX_PACKET_SIZE = 33 + 2 * 128;
+
+    // machine must already hold the ROM; it is reseeded from sessionId
+    RollbackSession(Chip8& machine, const NetplayConfig& config);
+    static uint32_t seedFor(uint64_t sessionId);   // The CXNN seed both sides use
+    // Session id for a ROM and profile: peers on another game never match
+    static uint64_t sessionIdFor(const uint8_t* rom, std::size_t size, QuirkProfile profile);
+
+    // Run the next frame with these local keys. Returns false (and does
+    // nothing) while too far ahead of the peer.
+    bool advance(uint16_t localKeys);
+
+    // Apply a pending correction now (advance() does this first anyway;
+    // for showing the corrected state when not advancing, e.g. at the end)
+    void rollback();
+
+    std::size_t writePacket(uint8_t* out);                  // Up to MAX_PACKET_SIZE bytes
+    void readPacket(const uint8_t* data, std::size_t size);
+
+    uint32_t frame() const { return currentFrame; }          // Frames run so far
+    uint32_t confirmedFrame() const { return remoteNext; }   // Remote keys known before this
+    bool desynced() const { return desyncFrame != NO_FRAME; }
+    uint32_t desyncAt() const { return desyncFrame; }
+    const NetplayStats& stats() const { return counters; }
+
+private:
+    static constexpr uint32_t NO_FRAME = 0xFFFFFFFF;
+    static constexpr uint32_t HISTORY = 256;   // Input ring (power of two, > 2 * MAX_ROLLBACK)
+
+    struct Snapshot {
+        uint32_t frame = NO_FRAME;   // Start of this frame
+        uint64_t hash = 0;           // Chip8::getStateHash() when saved
+        std::vector<uint8_t> state;
+    };
+
+    void runFrame(uint32_t frame);
+    uint16_t remoteKeysFor(uint32_t frame) const;   // Known, or predicted
+    void saveSnapshot(uint32_t frame);
+    Snapshot* findSnapshot(uint32_t frame);
+    uint32_t latestConfirmedSnapshot() const;
+    void checkDesync();
+
+    Chip8& machine;
+    NetplayConfig config;
+    uint32_t currentFrame = 0;
+
+    // Inputs by frame, slot = frame % HISTORY
+    std::array<uint16_t, HISTORY> localKeys{};
+    std::array<uint16_t, HISTORY> remoteKeys{};
+    std::array<uint32_t, HISTORY> remoteFrame{};   // Frame a remoteKeys slot holds (NO_FRAME: none)
+    std::array<uint16_t, HISTORY> usedRemote{};    // What the last run of a frame assumed
+
+    uint32_t remoteNext = 0;         // Remote keys known for every frame before this
+    uint32_t rollbackFrom = NO_FRAME;
+    uint32_t peerAck = 0;            // Peer has our keys for every frame before this
+
+    // Desync check against the peer's latest confirmed hash
+    uint32_t remoteCheckFrame = NO_FRAME;
+    uint64_t remoteCheckHash = 0;
+    uint32_t desyncFrame = NO_FRAME;
+
+    std::vector<Snapshot> snapshots;   // maxRollback + 2, slot = frame % size
+    NetplayStats counters;
+};
+
+#endif // NETPLAY_H
@@ -0,0 +1,265 @@
+#include "parallel_vec_env.h"
+#include <algorithm>   // For std::sort, std::min
+#include <cstdio>      // For snprintf/sscanf (sysfs paths)
+#include <cstring>     // For memset
+#include <new>         // For aligned operator new
+#include <system_error> // For a thread that cannot start
+#include <utility>     // For std::pair
+
+#if defined(__linux__)
+#include <dirent.h>    // For reading a CPU's NUMA node from sysfs
+#include <pthread.h>   // For pthread_setaffinity_np
+#include <sched.h>     // For sched_getaffinity
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h> // For _mm_pause
+#endif
+
+constexpr std::size_t PAGE_SIZE = 4096;
+constexpr int SPIN_LIMIT = 4096;   // Polls before an idle worker sleeps / the caller yields
+
+// Tell the CPU we are in a spin loop (saves power, frees the sibling
+// hyperthread, avoids a memory-order flush when the value changes)
+static inline void cpuRelax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+#if defined(__linux__)
+// NUMA node of a CPU: sysfs lists it as a "nodeN" entry in the CPU's directory
+static int cpuNode(int cpu) {
+    char path[64];
+    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d", cpu);
+    int node = 0;
+    if (DIR* dir = opendir(path)) {
+        while (dirent* entry = readdir(dir)) {
+            if (std::sscanf(entry->d_name, "node%d", &node) == 1) {
+                break;
+            }
+        }
+        closedir(dir);
+    }
+    return node;
+}
+#endif
+
+/*
+ * CPUs this process may run on (respects taskset and cgroup limits),
+ * grouped by NUMA node. Empty where pinning is not supported.
+ */
+static std::vector<int> availableCpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        std::vector<std::pair<int, int>> byNode;   // (node, cpu)
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                byNode.push_back({cpuNode(cpu), cpu});
+            }
+        }
+        std::sort(byNode.begin(), byNode.end());
+        for (const auto& entry : byNode) {
+            cpus.push_back(entry.second);
+        }
+    }
+#endif
+    return cpus;
+}
+
+static void pinCurrentThread(int cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+/*
+ * Constructor
+ *
+ * Splits the envs into shards that start on a page boundary of the
+ * observation buffer, starts one worker per shard and waits until every
+ * worker has built its shard.
+ */
+ParallelVecEnv::ParallelVecEnv(std::size_t count, const uint8_t* rom, std::size_t romSize,
+                               const VecEnvConfig& config, ObservationFormat format,
+                               unsigned threads, bool pinThreads)
+    : count(count), format(format), shardSize(1), observationBuffer(nullptr), doneBuffer(nullptr),
+      command(Command::Reset), actions(nullptr), generation(0), remaining(0), failed(false),
+      loaded(false) {
+    std::vector<int> cpus = availableCpus();
+    if (threads == 0) {
+        threads = cpus.empty() ? std::max(1u, std::thread::hardware_concurrency())
+                               : static_cast<unsigned>(cpus.size());
+    }
+    if (count == 0) {
+        return;
+    }
+
+    // Whole pages of observations per shard, so no page is written by two
+    // workers (and first-touched by the wrong one)
+    const std::size_t bytes = VecEnv::observationBytes(format);
+    const std::size_t envsPerPage = std::max<std::size_t>(1, PAGE_SIZE / bytes);
+    shardSize = (count + threads - 1) / threads;
+    shardSize = (shardSize + envsPerPage - 1) / envsPerPage * envsPerPage;
+    const std::size_t shards = (count + shardSize - 1) / shardSize;
+
+    // Not touched here: each worker first-touches its own slice
+    observationBuffer = static_cast<uint8_t*>(::operator new(count * bytes, std::align_val_t(PAGE_SIZE)));
+    doneBuffer = static_cast<uint8_t*>(::operator new(count, std::align_val_t(PAGE_SIZE)));
+
+    workers.resize(shards);
+    remaining.store(static_cast<unsigned>(shards), std::memory_order_relaxed);
+    for (std::size_t w = 0; w < shards; ++w) {
+        Worker& worker = workers[w];
+        worker.begin = w * shardSize;
+        worker.end = std::min(count, worker.begin + shardSize);
+        worker.cpu = (pinThreads && !cpus.empty()) ? cpus[w % cpus.size()] : -1;
+        try {
+            worker.thread = std::thread(&ParallelVecEnv::workerMain, this, std::ref(worker), rom, romSize, config);
+        } catch (const std::system_error&) {
+            // Out of threads: keep the shards that started (so the
+            // destructor can stop them) and report the env as not loaded
+            remaining.fetch_sub(static_cast<unsigned>(shards - w), std::memory_order_relaxed);
+            workers.resize(w);
+            failed.store(true, std::memory_order_relaxed);
+            break;
+        }
+    }
+    wait();   // Shards built (rom is not used after this)
+    loaded = !failed.load(std::memory_order_relaxed);
+}
+
+ParallelVecEnv::~ParallelVecEnv() {
+    if (!workers.empty()) {
+        wait();
+        publish(Command::Stop);
+        for (Worker& worker : workers) {
+            worker.thread.join();
+        }
+    }
+    ::operator delete(observationBuffer, std::align_val_t(PAGE_SIZE));
+    ::operator delete(doneBuffer, std::align_val_t(PAGE_SIZE));
+}
+
+/*
+ * Worker Thread
+ *
+ * Pins itself, builds its shard (first touch: the machines end up in
+ * this CPU's NUMA node), then steps the shard once per generation.
+ */
+void ParallelVecEnv::workerMain(Worker& worker, const uint8_t* rom, std::size_t romSize,
+                                const VecEnvConfig& config) {
+    if (worker.cpu >= 0) {
+        pinCurrentThread(worker.cpu);
+    }
+    const std::size_t bytes = VecEnv::observationBytes(format);
+    const std::size_t shardCount = worker.end - worker.begin;
+    uint8_t* observations = observationBuffer + worker.begin * bytes;
+    uint8_t* dones = doneBuffer + worker.begin;
+
+    VecEnvConfig shardConfig = config;
+    shardConfig.firstEnv = config.firstEnv + worker.begin;   // Same seeds as one big VecEnv
+    worker.envs.reset(new VecEnv(shardCount, rom, romSize, shardConfig));
+    if (!worker.envs->loadedOk()) {
+        failed.store(true, std::memory_order_relaxed);
+    }
+    std::memset(observations, 0, shardCount * bytes);
+    std::memset(dones, 0, shardCount);
+    remaining.fetch_sub(1, std::memory_order_release);
+
+    uint64_t seen = 0;
+    for (;;) {
+        // Wait for the next generation: spin first (steps usually come
+        // back to back), then sleep
+        int spins = 0;
+        while (generation.load(std::memory_order_acquire) == seen) {
+            if (++spins < SPIN_LIMIT) {
+                cpuRelax();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(idleMutex);
+            idle.wait(lock, [&] { return generation.load(std::memory_order_acquire) != seen; });
+        }
+        seen = generation.load(std::memory_order_acquire);
+
+        switch (command) {
+            case Command::Stop:
+                return;
+            case Command::Reset:
+                worker.envs->reset(format, observations);
+                std::memset(dones, 0, shardCount);
+                break;
+            case Command::Step:
+                worker.envs->step(actions + worker.begin, format, observations, dones);
+                break;
+        }
+        remaining.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+/*
+ * Publish
+ *
+ * Hands the next command to every worker. The fields are written before
+ * the generation is bumped with release order, so a worker that sees
+ * the new generation also sees them. The mutex is only there so a worker
+ * between "check generation" and "sleep" cannot miss the notify.
+ */
+void ParallelVecEnv::publish(Command next) {
+    command = next;
+    remaining.store(static_cast<unsigned>(workers.size()), std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(idleMutex);
+        generation.fetch_add(1, std::memory_order_release);
+    }
+    idle.notify_all();
+}
+
+void ParallelVecEnv::stepAsync(const uint16_t* nextActions) {
+    if (workers.empty()) {
+        return;
+    }
+    wait();   // The previous batch must be finished before its inputs change
+    actions = nextActions;
+    publish(Command::Step);
+}
+
+void ParallelVecEnv::resetAsync() {
+    if (workers.empty()) {
+        return;
+    }
+    wait();
+    publish(Command::Reset);
+}
+
+// Spin while the batch is likely to finish soon, then let others run
+void ParallelVecEnv::wait() const {
+    int spins = 0;
+    while (!ready()) {
+        if (++spins < SPIN_LIMIT) {
+            cpuRelax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+const Chip8& ParallelVecEnv::machine(std::size_t index) const {
+    const Worker& worker = workers[index / shardSize];
+    return worker.envs->machine(index - worker.begin);
+}
+
+Chip8& ParallelVecEnv::machine(std::size_t index) {
+    Worker& worker = workers[index / shardSize];
+    return worker.envs->machine(index - worker.begin);
+}
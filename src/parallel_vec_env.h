@@ -0,0 +1,111 @@
+#ifndef PARALLEL_VEC_ENV_H
+#define PARALLEL_VEC_ENV_H
+
+#include "vec_env.h"
+#include <atomic>              // For the work generation and completion count
+#include <condition_variable>  // For idle workers
+#include <cstddef>             // For std::size_t
+#include <cstdint>             // For fixed-width integer types
+#include <memory>              // For the shards
+#include <mutex>               // For idle workers
+#include <thread>              // For the workers
+#include <vector>              // For shards and threads
+
+/*
+ * Multi-Threaded Batched Environments
+ *
+ * The same interface as VecEnv (see vec_env.h), with the envs split into
+ * contiguous shards, one per worker thread:
+ *
+ *   ParallelVecEnv envs(4096, rom, romSize, config, ObservationFormat::Packed, 0);
+ *   envs.reset();
+ *   for (;;) {
+ *       envs.stepAsync(actions);        // returns at once
+ *       ...                             // caller work overlaps the step
+ *       envs.wait();                    // or poll ready()
+ *       learn(envs.observations(), envs.dones());
+ *   }
+ *
+ * PINNING AND NUMA:
+ * Worker w is pinned to the w-th CPU this process may run on, with CPUs
+ * ordered by NUMA node, so consecutive shards (and therefore contiguous
+ * parts of the observation buffer) belong to one node. Each worker
+ * builds its shard's VecEnv itself and is the first to write its slice
+ * of the observation and done buffers. Linux places a page on the node
+ * of the thread that first touches it, so the machines a worker steps
+ * and the observations it writes live in its node's memory, and a step
+ * causes no cross-socket traffic except reading the actions.
+ * The observation buffer is owned here, not by the caller, for exactly
+ * that reason; shard boundaries fall on page boundaries.
+ *
+ * COMPLETION:
+ * stepAsync() bumps a generation counter; each worker steps its shard
+ * and then decrements an atomic "shards remaining" count. The caller
+ * sees the batch is done when that count reaches 0 (ready()), with no
+ * barrier and no join: workers never wait for each other, and the
+ * caller never blocks a worker. Idle workers spin briefly for the next
+ * generation, then sleep on a condition variable, so a paused training
+ * loop does not burn every core.
+ */
+class ParallelVecEnv {
+public:
+    // threads = 0: one per available CPU (fewer if there are not enough envs)
+    ParallelVecEnv(std::size_t count, const uint8_t* rom, std::size_t romSize, const VecEnvConfig& config,
+                   ObservationFormat format, unsigned threads, bool pinThreads = true);
+    ~ParallelVecEnv();
+    ParallelVecEnv(const ParallelVecEnv&) = delete;
+    ParallelVecEnv& operator=(const ParallelVecEnv&) = delete;
+
+    bool loadedOk() const { return loaded; }
+    std::size_t size() const { return count; }
+    unsigned threadCount() const { return static_cast<unsigned>(workers.size()); }
+
+    // actions must stay valid until ready(); one key mask per env
+    void stepAsync(const uint16_t* actions);
+    void resetAsync();
+    bool ready() const { return remaining.load(std::memory_order_acquire) == 0; }
+    void wait() const;
+    void step(const uint16_t* actions) { stepAsync(actions); wait(); }
+    void reset() { resetAsync(); wait(); }
+
+    // Valid once ready(): N observations in the constructor's format, and
+    // dones[i] = 1 where the last step ended (and reset) env i
+    const void* observations() const { return observationBuffer; }
+    const uint8_t* dones() const { return doneBuffer; }
+
+    const Chip8& machine(std::size_t index) const;
+    Chip8& machine(std::size_t index);
+
+private:
+    enum class Command { Step, Reset, Stop };
+
+    struct Worker {
+        std::size_t begin = 0;             // First env of the shard
+        std::size_t end = 0;
+        int cpu = -1;                      // -1: not pinned
+        std::unique_ptr<VecEnv> envs;      // Built on the worker thread
+        std::thread thread;
+    };
+
+    void workerMain(Worker& worker, const uint8_t* rom, std::size_t romSize, const VecEnvConfig& config);
+    void publish(Command command);
+
+    std::size_t count;
+    ObservationFormat format;
+    std::size_t shardSize;                 // Envs per worker (the last may have fewer)
+    uint8_t* observationBuffer;
+    uint8_t* doneBuffer;
+    std::vector<Worker> workers;
+
+    // Work hand-off: written by the caller before generation is bumped
+    Command command;
+    const uint16_t* actions;
+    alignas(64) std::atomic<uint64_t> generation;
+    alignas(64) std::atomic<unsigned> remaining;   // Shards still working on this generation
+    std::atomic<bool> failed;                      // A shard could not load the ROM
+    std::mutex idleMutex;
+    std::condition_variable idle;
+    bool loaded;
+};
+
+#endif // PARALLEL_VEC_ENV_H
@@ -0,0 +1,138 @@
+#ifndef QUIRKS_H
+#define QUIRKS_H
+
+#include <string>   // For profile names
+
+/*
+ * CHIP-8 Quirk Profiles
+ *
+ * CHIP-8 was re-implemented many times (COSMAC VIP, HP-48 calculators,
+ * SUPER-CHIP...) and some instructions behave differently on each one.
+ * ROMs written for one interpreter often break on another, so the
+ * emulator has to pick the right behaviour per ROM:
+ *
+ * QUIRK                  CHIP-8 (VIP)     CHIP-48          SUPER-CHIP       XO-CHIP
+ * 8XY6 / 8XYE shifts     VX = VY >> 1     VX = VX >> 1     VX = VX >> 1     VX = VY >> 1
+ * FX55 / FX65            I += X + 1       I += X           I unchanged      I += X + 1
+ * BNNN                   jump NNN + V0    jump XNN + VX    jump XNN + VX    jump NNN + V0
+ * 8XY1 / 8XY2 / 8XY3     VF = 0           VF unchanged     VF unchanged     VF unchanged
+ * Sprites at the edge    clipped          clipped          clipped          wrapped
+ * 00CN/00FB-00FF, FX30,  -                -                available        available
+ *   FX75/FX85, DXY0 16x16
+ * XO-CHIP extensions     -                -                -                available
+ * Memory                 4KB              4KB              4KB              64KB
+ *
+ * WHY types instead of bool flags?
+ * A flag would be tested inside executeOpcode() on every instruction that
+ * has a quirk. Instead each profile is a type whose members are
+ * constexpr, and the interpreter is a template over that type:
+ *
+ *     if (Quirks::SHIFT_USES_VY) { ... }   // Known at compile time
+ *
+ * The compiler deletes the branch that can never run, so each
+ * instantiation contains only the code for its own profile. The profile
+ * is chosen ONCE (Chip8::setQuirkProfile), not per instruction.
+ */
+
+// How FX55 / FX65 leave the index register afterwards
+enum class IndexIncrement {
+    None,       // I unchanged
+    ByX,        // I += X      (CHIP-48 off-by-one)
+    ByXPlusOne  // I += X + 1  (original behaviour)
+};
+
+struct Chip8Quirks {
+    static constexpr const char* NAME = "chip8";
+    static constexpr bool SHIFT_USES_VY = true;
+    static constexpr IndexIncrement LOAD_STORE_INCREMENT = IndexIncrement::ByXPlusOne;
+    static constexpr bool JUMP_USES_VX = false;
+    static constexpr bool LOGIC_RESETS_VF = true;
+    static constexpr bool WRAP_SPRITES = false;
+    static constexpr bool SUPERCHIP_OPCODES = false;
+    static constexpr bool XOCHIP_OPCODES = false;
+    static constexpr int MEMORY_SIZE = 4096;
+};
+
+struct Chip48Quirks {
+    static constexpr const char* NAME = "chip48";
+    static constexpr bool SHIFT_USES_VY = false;
+    static constexpr IndexIncrement LOAD_STORE_INCREMENT = IndexIncrement::ByX;
+    static constexpr bool JUMP_USES_VX = true;
+    static constexpr bool LOGIC_RESETS_VF = false;
+    static constexpr bool WRAP_SPRITES = false;
+    static constexpr bool SUPERCHIP_OPCODES = false;
+    static constexpr bool XOCHIP_OPCODES = false;
+    static constexpr int MEMORY_SIZE = 4096;
+};
+
+struct SuperChipQuirks {
+    static constexpr const char* NAME = "schip";
+    static constexpr bool SHIFT_USES_VY = false;
+    static constexpr IndexIncrement LOAD_STORE_INCREMENT = IndexIncrement::None;
+    static constexpr bool JUMP_USES_VX = true;
+    static constexpr bool LOGIC_RESETS_VF = false;
+    static constexpr bool WRAP_SPRITES = false;
+    static constexpr bool SUPERCHIP_OPCODES = true;  // Hi-res, scrolling, big font
+    static constexpr bool XOCHIP_OPCODES = false;
+    static constexpr int MEMORY_SIZE = 4096;
+};
+
+/*
+ * XO-CHIP (Octo): SUPER-CHIP plus 64KB of memory, extra bitplanes,
+ * long I loads (F000 NNNN), register range save/load (5XY2/5XY3),
+ * scroll up (00DN) and a programmable audio pattern (F002/FX3A).
+ *
+ * MEMORY_SIZE is part of the profile so the interpreter picks its
+ * memory at compile time: the 4KB profiles keep using the inline array
+ * exactly as before, only the XO-CHIP instantiation touches 64KB.
+ */
+struct XoChipQuirks {
+    static constexpr const char* NAME = "xochip";
+    static constexpr bool SHIFT_USES_VY = true;
+    static constexpr IndexIncrement LOAD_STORE_INCREMENT = IndexIncrement::ByXPlusOne;
+    static constexpr bool JUMP_USES_VX = false;
+    static constexpr bool LOGIC_RESETS_VF = false;
+    static constexpr bool WRAP_SPRITES = true;
+    static constexpr bool SUPERCHIP_OPCODES = true;
+    static constexpr bool XOCHIP_OPCODES = true;   // Bitplanes, long I, audio
+    static constexpr int MEMORY_SIZE = 65536;
+};
+
+/*
+ * Runtime profile selector (what the user picks on the command line).
+ * Chip8::setQuirkProfile maps it to one of the pre-instantiated engines.
+ */
+enum class QuirkProfile {
+    Chip8,
+    Chip48,
+    SuperChip,
+    XoChip
+};
+
+inline const char* quirkProfileName(QuirkProfile profile) {
+    switch (profile) {
+        case QuirkProfile::Chip48:    return Chip48Quirks::NAME;
+        case QuirkProfile::SuperChip: return SuperChipQuirks::NAME;
+        case QuirkProfile::XoChip:    return XoChipQuirks::NAME;
+        case QuirkProfile::Chip8:
+        default:                      return Chip8Quirks::NAME;
+    }
+}
+
+// Parses "chip8", "chip48", "schip" or "xochip"; returns false for anything else
+inline bool parseQuirkProfile(const std::string& name, QuirkProfile& profile) {
+    if (name == Chip8Quirks::NAME) {
+        profile = QuirkProfile::Chip8;
+    } else if (name == Chip48Quirks::NAME) {
+        profile = QuirkProfile::Chip48;
+    } else if (name == SuperChipQuirks::NAME) {
+        profile = QuirkProfile::SuperChip;
+    } else if (name == XoChipQuirks::NAME) {
+        profile = QuirkProfile::XoChip;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+#endif // QUIRKS_H
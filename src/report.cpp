@@ -0,0 +1,41 @@
+#include "report.h"
+#include "aot.h"     // For the compiled ROM name
+#include <fstream>   // For the ROM size check
+#include <iostream>  // For std::cout, std::cerr
+
+void reportUnknownOpcodes(const Chip8& chip8, uint32_t& reported) {
+    uint32_t count = chip8.getUnknownOpcodeCount();
+    if (count != reported && count != 0) {
+        std::cerr << "[ERROR] Unknown opcode: 0x" << std::hex << chip8.getLastUnknownOpcode() << std::dec
+                  << " (" << count << " since reset)\n";
+    }
+    reported = count;
+}
+
+bool loadROMFile(Chip8& chip8, const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Failed to open ROM: " << path << "\n";
+        return false;
+    }
+    
+    std::streamsize size = file.tellg();
+    std::streamsize capacity = static_cast<std::streamsize>(chip8.getMemorySize()) - Chip8::ROM_START_ADDRESS;
+    if (size > capacity) {
+        std::cerr << "[ERROR] ROM too large: " << size << " bytes\n";
+        std::cerr << "[ERROR] Maximum size: " << capacity << " bytes\n";
+        return false;
+    }
+    file.close();
+    
+    if (!chip8.loadROM(path)) {
+        std::cerr << "[ERROR] Failed to read ROM: " << path << "\n";
+        return false;
+    }
+    std::cout << "[CHIP-8] Loaded ROM: " << path << "\n";
+    std::cout << "[CHIP-8] ROM size: " << size << " bytes\n";
+    if (chip8.getCompiledRom() != nullptr) {
+        std::cout << "[AOT] Running compiled code for " << chip8.getCompiledRom()->name << "\n";
+    }
+    return true;
+}
@@ -0,0 +1,38 @@
+#ifndef REPORT_H
+#define REPORT_H
+
+#include "chip8.h"
+#include <cstdint>  // For fixed-width integer types
+#include <string>   // For ROM paths
+
+/*
+ * Frontend Reporting
+ *
+ * The Chip8 core never prints: it is also embedded through libchip8.h,
+ * where stdout belongs to the host program. It only records what went
+ * wrong (counters, last values), and the programs that own a console
+ * report it with the helpers here, so the emulator and the
+ * command-line tools print the same lines.
+ */
+
+/*
+ * Report Unknown Opcodes
+ *
+ * Logs the most recent unknown opcode whenever the count has moved
+ * since the last call. Once per frame is enough.
+ *
+ * @param reported: count at the last call, updated here
+ */
+void reportUnknownOpcodes(const Chip8& chip8, uint32_t& reported);
+
+/*
+ * Load ROM File
+ *
+ * Chip8::loadROM(path) with the console messages: why a ROM could not
+ * be loaded, its size, and whether compiled code runs it (see aot.h).
+ *
+ * @return: what loadROM() returned
+ */
+bool loadROMFile(Chip8& chip8, const std::string& path);
+
+#endif // REPORT_H
@@ -0,0 +1,90 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <array>    // For the slot storage
+#include <atomic>   // For lock-free head/tail indices
+#include <cstddef>  // For std::size_t
+
+/*
+ * Single-Producer Single-Consumer Ring Buffer
+ *
+ * A fixed-size queue for handing items from exactly ONE producer thread
+ * (e.g. the emulation loop) to exactly ONE consumer thread (e.g. a file
+ * writer or the audio callback) without locks.
+ *
+ * WHY lock-free?
+ * The producer is the emulation loop. If it ever had to wait for a mutex
+ * held by a slow consumer (a disk write, an audio driver callback), the
+ * emulator would stutter. With this ring, tryPush() is a handful of
+ * loads/stores and never waits: if the ring is full it simply fails and
+ * the caller decides what to drop.
+ *
+ * HOW IT WORKS:
+ * - tail: next slot the producer writes (only the producer modifies it)
+ * - head: next slot the consumer reads (only the consumer modifies it)
+ * - Both count up forever; slot index = counter & (Capacity - 1)
+ * - Empty when head == tail, full when tail - head == Capacity
+ *
+ * MEMORY ORDERING:
+ * The producer writes the slot, THEN publishes tail with release order.
+ * The consumer reads tail with acquire order, so it is guaranteed to see
+ * the slot contents. The same pairing protects slots being reused.
+ *
+ * head and tail live on separate cache lines so the two threads do not
+ * keep stealing the same line from each other ("false sharing").
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+public:
+    // Producer side: returns false (and drops nothing) if the ring is full
+    bool tryPush(const T& item) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots[t & (Capacity - 1)] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer side, in place: the next free slot (nullptr if the ring is
+    // full), handed to the consumer by publish(). For large items that are
+    // only partly written; the slot still holds whatever it held last time.
+    T* reserve() {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity) {
+            return nullptr;
+        }
+        return &slots[t & (Capacity - 1)];
+    }
+    void publish() {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Consumer side: returns false if the ring is empty
+    bool tryPop(T& item) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = slots[h & (Capacity - 1)];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called from a third thread, exact from either end
+    std::size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    std::array<T, Capacity> slots;
+    alignas(64) std::atomic<std::size_t> head{0};  // Written by the consumer
+    alignas(64) std::atomic<std::size_t> tail{0};  // Written by the producer
+};
+
+#endif // SPSC_RING_H
@@ -0,0 +1,83 @@
+#include "trace.h"
+#include <cstring>    // For memcpy, memset
+#include <iostream>   // For error messages
+
+#if !defined(_WIN32)
+#include <fcntl.h>      // For open
+#include <sys/mman.h>   // For mmap, munmap
+#include <unistd.h>     // For ftruncate, close
+#endif
+
+TraceWriter::~TraceWriter() {
+    close();
+}
+
+/*
+ * Create the trace file and map it
+ *
+ * The file is sized once (header + capacity records) and never grows,
+ * so recording never calls into the kernel.
+ */
+bool TraceWriter::open(const std::string& filename, uint32_t capacity) {
+#if defined(_WIN32)
+    (void)filename;
+    (void)capacity;
+    std::cerr << "[ERROR] Binary tracing needs mmap (not available on Windows)\n";
+    return false;
+#else
+    if (isOpen()) {
+        std::cerr << "[ERROR] Trace already open\n";
+        return false;
+    }
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        std::cerr << "[ERROR] Trace capacity must be a power of two\n";
+        return false;
+    }
+
+    fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "[ERROR] Failed to create trace: " << filename << "\n";
+        return false;
+    }
+
+    mappedSize = TRACE_HEADER_SIZE + static_cast<std::size_t>(capacity) * sizeof(TraceRecord);
+    void* base = MAP_FAILED;
+    if (::ftruncate(fd, static_cast<off_t>(mappedSize)) == 0) {
+        base = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (base == MAP_FAILED) {
+        std::cerr << "[ERROR] Failed to map trace: " << filename << "\n";
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    header = static_cast<TraceHeader*>(base);
+    records = reinterpret_cast<TraceRecord*>(static_cast<uint8_t*>(base) + TRACE_HEADER_SIZE);
+    mask = capacity - 1;
+
+    std::memset(header, 0, sizeof(TraceHeader));
+    std::memcpy(header->magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    header->version = TRACE_VERSION;
+    header->recordSize = sizeof(TraceRecord);
+    header->capacity = capacity;
+    header->written = 0;
+    return true;
+#endif
+}
+
+/*
+ * Unmap and close (the kernel has the data either way)
+ */
+void TraceWriter::close() {
+#if !defined(_WIN32)
+    if (!isOpen()) {
+        return;
+    }
+    ::munmap(header, mappedSize);
+    ::close(fd);
+    header = nullptr;
+    records = nullptr;
+    fd = -1;
+#endif
+}
@@ -0,0 +1,99 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+#include <string>   // For file names
+
+/*
+ * Binary Execution Trace
+ *
+ * Records one fixed-size record per executed instruction into a ring
+ * buffer that is a memory-mapped file:
+ *
+ *   HEADER (64 bytes)
+ *     magic "C8TR", version (u32), record size (u32), capacity (u32),
+ *     records written so far (u64), rest reserved
+ *   RECORDS (capacity x 16 bytes)
+ *     record N lives in slot N % capacity, so the file always holds the
+ *     LAST capacity instructions
+ *
+ * WHY binary and mmap?
+ * Formatting "PC=0x2A4 LD V3, 0x10 ..." for every instruction costs far
+ * more than executing it, so text tracing is useless for bugs that show
+ * up after millions of cycles. Writing a 16-byte struct into mapped
+ * memory is a few stores: no syscalls, no formatting, no buffering.
+ * The kernel writes the pages back to the file on its own, so even if
+ * the emulator crashes the trace up to the crash is on disk.
+ * chip8_tracedump turns the file into text afterwards.
+ *
+ * All fields are little-endian (the trace is read back on the machine
+ * that wrote it, or another x86/ARM host).
+ */
+
+constexpr char TRACE_MAGIC[4] = {'C', '8', 'T', 'R'};
+constexpr uint32_t TRACE_VERSION = 1;
+constexpr std::size_t TRACE_HEADER_SIZE = 64;
+
+// Which register an instruction changed
+constexpr uint8_t TRACE_REGISTER_I = 16;       // 0-15 = V0-VF
+constexpr uint8_t TRACE_NO_REGISTER = 0xFF;
+
+struct TraceRecord {
+    uint64_t cycle;     // Instruction number since tracing started
+    uint16_t pc;        // Address of the instruction
+    uint16_t opcode;    // The instruction
+    uint16_t value;     // New value of reg
+    uint8_t reg;        // First changed register (VX before VF), I, or none
+    uint8_t reserved;
+};
+static_assert(sizeof(TraceRecord) == 16, "trace records are 16 bytes on disk");
+
+struct TraceHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t capacity;
+    uint64_t written;
+    uint8_t reserved[TRACE_HEADER_SIZE - 24];
+};
+static_assert(sizeof(TraceHeader) == TRACE_HEADER_SIZE, "trace header is 64 bytes");
+
+class TraceWriter {
+public:
+    static constexpr uint32_t DEFAULT_CAPACITY = 1u << 20;  // 1M records = 16MB
+
+    TraceWriter() = default;
+    ~TraceWriter();
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    // capacity must be a power of two (slot = count & (capacity - 1))
+    bool open(const std::string& filename, uint32_t capacity = DEFAULT_CAPACITY);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    // Hot path: store one record (called by Chip8's debug engines)
+    void record(uint16_t pc, uint16_t opcode, uint8_t reg, uint16_t value) {
+        uint64_t n = header->written;
+        TraceRecord& r = records[n & mask];
+        r.cycle = n;
+        r.pc = pc;
+        r.opcode = opcode;
+        r.value = value;
+        r.reg = reg;
+        r.reserved = 0;
+        header->written = n + 1;
+    }
+
+    uint64_t getWritten() const { return header ? header->written : 0; }
+
+private:
+    TraceHeader* header = nullptr;
+    TraceRecord* records = nullptr;
+    uint64_t mask = 0;
+    std::size_t mappedSize = 0;
+    int fd = -1;
+};
+
+#endif // TRACE_H
@@ -0,0 +1,169 @@
+#include "udp_transport.h"
+#include "hash.h"      // For the jitter/loss generator
+#include <cstring>     // For memcpy, memset
+#include <iostream>    // For status messages
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>   // For htons
+#include <fcntl.h>       // For O_NONBLOCK
+#include <netdb.h>       // For getaddrinfo
+#include <netinet/in.h>  // For sockaddr_in
+#include <sys/socket.h>  // For socket, bind, sendto, recv
+#include <unistd.h>      // For close
+#endif
+
+UdpTransport::~UdpTransport() {
+    close();
+}
+
+/*
+ * Open the socket
+ *
+ * Non-blocking, so a frame never waits for the network: an empty socket
+ * is just "no news this frame".
+ */
+bool UdpTransport::open(uint16_t localPort, const std::string& remoteHost, uint16_t remotePort) {
+#if defined(_WIN32)
+    (void)localPort;
+    (void)remoteHost;
+    (void)remotePort;
+    std::cerr << "[ERROR] Netplay needs BSD sockets (not available on Windows)\n";
+    return false;
+#else
+    if (isOpen()) {
+        std::cerr << "[ERROR] Netplay socket already open\n";
+        return false;
+    }
+
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo* found = nullptr;
+    if (::getaddrinfo(remoteHost.c_str(), nullptr, &hints, &found) != 0 || found == nullptr) {
+        std::cerr << "[ERROR] Unknown netplay host: " << remoteHost << "\n";
+        return false;
+    }
+    remoteAddress = reinterpret_cast<const sockaddr_in*>(found->ai_addr)->sin_addr.s_addr;
+    this->remotePort = htons(remotePort);
+    ::freeaddrinfo(found);
+
+    socketFd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (socketFd < 0) {
+        std::cerr << "[ERROR] Failed to create netplay socket\n";
+        return false;
+    }
+    sockaddr_in local;
+    std::memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(localPort);
+    if (::bind(socketFd, reinterpret_cast<const sockaddr*>(&local), sizeof(local)) != 0 ||
+        ::fcntl(socketFd, F_SETFL, ::fcntl(socketFd, F_GETFL, 0) | O_NONBLOCK) != 0) {
+        std::cerr << "[ERROR] Failed to bind netplay port " << localPort << "\n";
+        ::close(socketFd);
+        socketFd = -1;
+        return false;
+    }
+
+    std::cout << "[NET] Port " << localPort << " <-> " << remoteHost << ":" << remotePort << "\n";
+    return true;
+#endif
+}
+
+void UdpTransport::close() {
+#if !defined(_WIN32)
+    if (isOpen()) {
+        ::close(socketFd);
+        socketFd = -1;
+    }
+#endif
+    delayed.clear();
+}
+
+void UdpTransport::setConditions(const NetConditions& next) {
+    conditions = next;
+    rngState = next.seed;
+}
+
+// SplitMix64 step, top 53 bits as a double
+double UdpTransport::nextRandom() {
+    rngState += 0x9E3779B97F4A7C15ULL;
+    return static_cast<double>(mix64(rngState) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*
+ * Send (through the condition injector)
+ *
+ * With no conditions set the datagram goes straight out; otherwise it
+ * is dropped, or parked until its random delivery time.
+ */
+void UdpTransport::send(const uint8_t* data, std::size_t size, double now) {
+    if (!isOpen() || size > MAX_DATAGRAM) {
+        return;
+    }
+    ++sent;
+    if (conditions.loss > 0.0 && nextRandom() < conditions.loss) {
+        ++dropped;
+    } else if (conditions.latency <= 0.0 && conditions.jitter <= 0.0) {
+        sendNow(data, size);
+    } else {
+        Delayed datagram;
+        datagram.due = now + conditions.latency + conditions.jitter * nextRandom();
+        datagram.size = size;
+        std::memcpy(datagram.data, data, size);
+        delayed.push_back(datagram);
+    }
+    flushDue(now);
+}
+
+// Held datagrams whose time has come, in due order (so jitter, not the
+// order of this vector, decides what overtakes what)
+void UdpTransport::flushDue(double now) {
+    for (;;) {
+        std::size_t next = delayed.size();
+        for (std::size_t i = 0; i < delayed.size(); ++i) {
+            if (delayed[i].due <= now && (next == delayed.size() || delayed[i].due < delayed[next].due)) {
+                next = i;
+            }
+        }
+        if (next == delayed.size()) {
+            return;
+        }
+        sendNow(delayed[next].data, delayed[next].size);
+        delayed[next] = delayed.back();
+        delayed.pop_back();
+    }
+}
+
+void UdpTransport::sendNow(const uint8_t* data, std::size_t size) {
+#if defined(_WIN32)
+    (void)data;
+    (void)size;
+#else
+    sockaddr_in remote;
+    std::memset(&remote, 0, sizeof(remote));
+    remote.sin_family = AF_INET;
+    remote.sin_addr.s_addr = remoteAddress;
+    remote.sin_port = remotePort;
+    // Fire and forget: a full socket buffer is just one more lost datagram
+    (void)::sendto(socketFd, data, size, 0, reinterpret_cast<const sockaddr*>(&remote), sizeof(remote));
+#endif
+}
+
+std::size_t UdpTransport::receive(uint8_t* buffer, std::size_t capacity, double now) {
+    flushDue(now);
+#if defined(_WIN32)
+    (void)buffer;
+    (void)capacity;
+    return 0;
+#else
+    if (!isOpen()) {
+        return 0;
+    }
+    // From any address: behind NAT the peer's source port is not the
+    // one it was told to use. Packets carry a session id (netplay.h).
+    ssize_t size = ::recv(socketFd, buffer, capacity, 0);
+    return size > 0 ? static_cast<std::size_t>(size) : 0;   // EAGAIN or an error: no news either way
+#endif
+}
@@ -0,0 +1,92 @@
+#ifndef UDP_TRANSPORT_H
+#define UDP_TRANSPORT_H
+
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+#include <string>   // For host names
+#include <vector>   // For delayed datagrams
+
+/*
+ * UDP Transport (for netplay)
+ *
+ * One non-blocking UDP socket talking to one peer. Datagrams, not a
+ * stream: netplay packets are small, every one is self-contained, and a
+ * lost or late one is simply superseded by the next (see netplay.h), so
+ * TCP's retransmission and in-order delivery would only add latency.
+ *
+ *   UdpTransport net;
+ *   net.open(7000, "192.168.1.20", 7001);
+ *   net.send(packet, size, now);
+ *   while (std::size_t n = net.receive(buffer, sizeof(buffer), now)) { ... }
+ *
+ * LOOPBACK TESTING:
+ * Two transports in one process, bound to two ports on 127.0.0.1 and
+ * pointed at each other, are a complete network (chip8_netplay does
+ * this). Real sockets, so the same code runs as in a real session.
+ *
+ * NETWORK CONDITIONS:
+ * setConditions() makes the socket behave like a bad link: every
+ * outgoing datagram is held back for latency + a random 0..jitter extra
+ * (so datagrams can arrive out of order, as on the internet) and a
+ * fraction of them is dropped. Held datagrams go out from send() and
+ * receive(), whichever is called first after they are due, so nothing
+ * here needs a thread or a timer. Times are in seconds on any clock
+ * the caller likes (GetTime(), or a simulated clock for reproducible
+ * tests); it only has to be the same clock for every call.
+ */
+
+struct NetConditions {
+    double latency = 0.0;   // One-way delay added to every datagram (seconds)
+    double jitter = 0.0;    // Up to this much more, uniformly random (seconds)
+    double loss = 0.0;      // Fraction of datagrams dropped (0.0 - 1.0)
+    uint64_t seed = 1;      // For jitter and loss (reproducible runs)
+};
+
+class UdpTransport {
+public:
+    static constexpr std::size_t MAX_DATAGRAM = 512;  // Netplay packets are far smaller
+
+    UdpTransport() = default;
+    ~UdpTransport();
+    UdpTransport(const UdpTransport&) = delete;
+    UdpTransport& operator=(const UdpTransport&) = delete;
+
+    // Bind localPort on all interfaces and send to remoteHost:remotePort
+    // (a name or an IPv4 address)
+    bool open(uint16_t localPort, const std::string& remoteHost, uint16_t remotePort);
+    void close();
+    bool isOpen() const { return socketFd >= 0; }
+
+    void setConditions(const NetConditions& conditions);
+
+    // Never block. receive() returns the datagram size, 0 if none is
+    // waiting. Datagrams are accepted from any address (NAT may change
+    // the peer's port); netplay packets identify their session.
+    void send(const uint8_t* data, std::size_t size, double now);
+    std::size_t receive(uint8_t* buffer, std::size_t capacity, double now);
+
+    uint64_t sentCount() const { return sent; }
+    uint64_t droppedCount() const { return dropped; }
+
+private:
+    struct Delayed {
+        double due;
+        std::size_t size;
+        uint8_t data[MAX_DATAGRAM];
+    };
+
+    void sendNow(const uint8_t* data, std::size_t size);
+    void flushDue(double now);
+    double nextRandom();   // Uniform in [0, 1)
+
+    int socketFd = -1;
+    uint32_t remoteAddress = 0;   // IPv4, network byte order
+    uint16_t remotePort = 0;      // Network byte order
+    NetConditions conditions;
+    uint64_t rngState = 1;
+    std::vector<Delayed> delayed;   // Unordered; small (a few RTTs of packets)
+    uint64_t sent = 0;
+    uint64_t dropped = 0;
+};
+
+#endif // UDP_TRANSPORT_H
@@ -0,0 +1,158 @@
+#include "vec_env.h"
+#include "hash.h"      // For per-episode seeds
+#include <array>       // For the pixel expansion table
+#include <cstring>     // For memcpy
+#include <iostream>    // For errors
+
+/*
+ * Constructor
+ *
+ * Loads the ROM into the first machine, saves that state as the reset
+ * snapshot and starts every env from it.
+ */
+VecEnv::VecEnv(std::size_t count, const uint8_t* rom, std::size_t romSize, const VecEnvConfig& config)
+    : config(config), machines(count), frames(count, 0), episodes(count, 0), loaded(false) {
+    if (count == 0) {
+        return;
+    }
+
+    for (Chip8& chip8 : machines) {
+        chip8.setQuirkProfile(config.profile);
+    }
+    Chip8& first = machines.front();
+    first.reset();
+    if (!first.loadROM(rom, romSize)) {
+        std::cerr << "[ERROR] ROM does not fit in memory (" << romSize << " bytes)\n";
+        return;
+    }
+    snapshot.resize(first.stateSize());
+    first.saveState(snapshot.data(), snapshot.size());
+    loaded = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        resetEnv(i);
+    }
+}
+
+std::size_t VecEnv::observationBytes(ObservationFormat format) {
+    return format == ObservationFormat::Packed ? OBS_HEIGHT * sizeof(uint64_t)
+                                               : OBS_HEIGHT * OBS_WIDTH;
+}
+
+/*
+ * Reset One Env
+ *
+ * Restores the snapshot and reseeds CXNN from (seed, env, episode), so
+ * every episode of every env gets its own random numbers, and a run with
+ * the same seed and actions is still reproducible.
+ */
+void VecEnv::resetEnv(std::size_t index) {
+    Chip8& chip8 = machines[index];
+    chip8.loadState(snapshot.data(), snapshot.size());
+    uint64_t seed = mix64(config.seed ^ mix64((config.firstEnv + index) ^ mix64(episodes[index])));
+    chip8.seedRandom(static_cast<uint32_t>(seed));
+    ++episodes[index];
+    frames[index] = 0;
+}
+
+void VecEnv::reset(ObservationFormat format, void* observations) {
+    if (!loaded) {
+        return;
+    }
+    for (std::size_t i = 0; i < machines.size(); ++i) {
+        resetEnv(i);
+        observe(i, format, observations);
+    }
+}
+
+/*
+ * Step
+ *
+ * Each env runs to completion before the next one starts, so its state
+ * stays in cache for the whole frame skip (see HOT STATE in chip8.h).
+ */
+void VecEnv::step(const uint16_t* actions, ObservationFormat format, void* observations, uint8_t* dones) {
+    if (!loaded) {
+        return;
+    }
+    for (std::size_t i = 0; i < machines.size(); ++i) {
+        Chip8& chip8 = machines[i];
+        chip8.setKeys(actions[i]);
+        for (uint32_t f = 0; f < config.frameSkip && !chip8.hasExited(); ++f) {
+            chip8.runCycles(config.cyclesPerFrame);
+            chip8.updateTimers();
+            ++frames[i];
+        }
+
+        bool done = chip8.hasExited() || (config.maxFrames != 0 && frames[i] >= config.maxFrames);
+        if (done) {
+            resetEnv(i);
+        }
+        if (dones != nullptr) {
+            dones[i] = done ? 1 : 0;
+        }
+        observe(i, format, observations);
+    }
+}
+
+// Squeeze 64 pixels into 32 by OR-ing each horizontal pair: bit 63 - 2k
+// and 62 - 2k of the input become bit 31 - k of the result
+static uint64_t halveRow(uint64_t word) {
+    uint64_t x = ((word | (word << 1)) >> 1) & 0x5555555555555555ULL;  // Pair k on bit 62 - 2k
+    x = (x | (x >> 1)) & 0x3333333333333333ULL;
+    x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+    return x;
+}
+
+// 8 pixels (one display byte, MSB first) -> their 8 output bytes, so the
+// Pixels format is written 8 bytes at a time instead of bit by bit
+static std::array<uint64_t, 256> makeExpandTable() {
+    std::array<uint64_t, 256> table{};
+    for (int byte = 0; byte < 256; ++byte) {
+        uint8_t pixels[8];
+        for (int bit = 0; bit < 8; ++bit) {
+            pixels[bit] = ((byte >> (7 - bit)) & 1) ? 255 : 0;
+        }
+        std::memcpy(&table[byte], pixels, sizeof(pixels));  // Memory order, any endianness
+    }
+    return table;
+}
+
+static const std::array<uint64_t, 256> EXPAND = makeExpandTable();
+
+/*
+ * Write One Observation
+ *
+ * Works on whole display words: a lo-res row is already one word, a
+ * hi-res row pair is OR-ed and halved into one.
+ */
+void VecEnv::observe(std::size_t index, ObservationFormat format, void* observations) const {
+    const Chip8& chip8 = machines[index];
+    uint64_t rows[OBS_HEIGHT];
+    if (chip8.isHighResolution()) {
+        for (int y = 0; y < OBS_HEIGHT; ++y) {
+            const uint64_t* top = chip8.getRow(static_cast<uint8_t>(2 * y));
+            const uint64_t* bottom = chip8.getRow(static_cast<uint8_t>(2 * y + 1));
+            rows[y] = (halveRow(top[0] | bottom[0]) << 32) | halveRow(top[1] | bottom[1]);
+        }
+    } else {
+        for (int y = 0; y < OBS_HEIGHT; ++y) {
+            rows[y] = chip8.getRow(static_cast<uint8_t>(y))[0];
+        }
+    }
+
+    if (format == ObservationFormat::Packed) {
+        std::memcpy(static_cast<uint64_t*>(observations) + index * OBS_HEIGHT, rows, sizeof(rows));
+        return;
+    }
+    uint8_t* out = static_cast<uint8_t*>(observations) + index * OBS_HEIGHT * OBS_WIDTH;
+    for (int y = 0; y < OBS_HEIGHT; ++y) {
+        for (int b = 0; b < 8; ++b) {
+            uint64_t pixels = EXPAND[(rows[y] >> (56 - 8 * b)) & 0xFF];
+            std::memcpy(out + 8 * b, &pixels, sizeof(pixels));
+        }
+        out += OBS_WIDTH;
+    }
+}
@@ -0,0 +1,96 @@
+#ifndef VEC_ENV_H
+#define VEC_ENV_H
+
+#include "chip8.h"
+#include <cstddef>  // For std::size_t
+#include <cstdint>  // For fixed-width integer types
+#include <vector>   // For the machines and the snapshot
+
+/*
+ * Batched Environments (Gym VecEnv style)
+ *
+ * N machines running the same ROM, stepped together for reinforcement
+ * learning:
+ *
+ *   VecEnv envs(256, rom, romSize, config);
+ *   envs.reset(observations);                       // uint64_t[256][32]
+ *   for (;;) {
+ *       envs.step(actions, observations, dones);    // one key mask per env
+ *   }
+ *
+ * One step = apply the env's key mask, then run frameSkip frames
+ * (cyclesPerFrame instructions and one 60Hz timer tick each). An episode
+ * ends at 00FD or after maxFrames frames; that env is then reset on the
+ * spot and the observation written for it is its new first frame, with
+ * dones[i] = 1 (the usual auto-reset convention).
+ *
+ * OBSERVATIONS:
+ * Written straight into a contiguous buffer the caller owns, in one of
+ * two formats (64x32 either way):
+ *   Packed  uint64_t[N][32]     one word per row, bit 63 = x 0
+ *   Pixels  uint8_t[N][32][64]  0 or 255 per pixel
+ * Packed is a copy of the core's own display words; Pixels expands them
+ * without ever calling getPixel(). A hi-res (128x64) screen is halved:
+ * each observed pixel is the OR of a 2x2 block. XO-CHIP shows plane 0.
+ *
+ * WHY a snapshot for resets?
+ * Resetting by reset() + loadROM() + setQuirkProfile() costs a memory
+ * clear, a font copy, a ROM copy and a compiled-ROM lookup per episode.
+ * The state right after loading is saved once (Chip8::saveState) and
+ * every reset is one loadState() from that buffer, followed by a fresh
+ * random seed so that envs do not all replay the same episode.
+ *
+ * Nothing in reset() or step() allocates.
+ */
+
+enum class ObservationFormat {
+    Packed,   // uint64_t[N][OBS_HEIGHT]
+    Pixels    // uint8_t[N][OBS_HEIGHT][OBS_WIDTH]
+};
+
+struct VecEnvConfig {
+    QuirkProfile profile = QuirkProfile::Chip8;
+    uint32_t cyclesPerFrame = 11;   // ~700Hz at 60 frames per second
+    uint32_t frameSkip = 4;         // Frames per step (same action held)
+    uint32_t maxFrames = 0;         // Episode length limit, 0 = none
+    uint64_t seed = 1;              // CXNN seeds are derived from this
+    uint64_t firstEnv = 0;          // Index of env 0 in seeds (shards of a ParallelVecEnv)
+};
+
+class VecEnv {
+public:
+    static constexpr int OBS_WIDTH = Chip8::LORES_WIDTH;    // 64
+    static constexpr int OBS_HEIGHT = Chip8::LORES_HEIGHT;  // 32
+
+    // The ROM must fit the profile's memory (check loadedOk())
+    VecEnv(std::size_t count, const uint8_t* rom, std::size_t romSize, const VecEnvConfig& config);
+
+    bool loadedOk() const { return loaded; }
+    std::size_t size() const { return machines.size(); }
+    static std::size_t observationBytes(ObservationFormat format);  // Per env
+
+    // Reset every env and write the first observations
+    void reset(ObservationFormat format, void* observations);
+
+    // actions[i]: key mask for env i. dones[i] (may be nullptr): 1 if the
+    // episode ended this step and env i was reset
+    void step(const uint16_t* actions, ObservationFormat format, void* observations, uint8_t* dones);
+
+    // Direct access for rewards (scores live in guest memory) and tools
+    const Chip8& machine(std::size_t index) const { return machines[index]; }
+    Chip8& machine(std::size_t index) { return machines[index]; }
+    uint32_t episodeFrames(std::size_t index) const { return frames[index]; }
+
+private:
+    void resetEnv(std::size_t index);
+    void observe(std::size_t index, ObservationFormat format, void* observations) const;
+
+    VecEnvConfig config;
+    std::vector<Chip8> machines;
+    std::vector<uint32_t> frames;     // Frames into the current episode
+    std::vector<uint64_t> episodes;   // Episodes started, per env (for seeds)
+    std::vector<uint8_t> snapshot;    // State right after loading the ROM
+    bool loaded;
+};
+
+#endif // VEC_ENV_H
@@ -0,0 +1,440 @@
+#include "chip8.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>  // For hardware cache-miss counters
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * CHIP-8 Core Benchmark
+ *
+ * Runs reproducible synthetic workloads through the Chip8 core and
+ * reports throughput and its variance across repetitions:
+ *
+ *   chip8_bench                          # all workloads, human-readable table
+ *   chip8_bench --json results.json      # also write machine-readable results
+ *   chip8_bench --cycles 20000000 --reps 20 --workload sprite-heavy
+ *
+ * WORKLOADS (ROMs are built into this file, so every machine runs the
+ * exact same instruction stream):
+ * - alu-mix:      Loads, adds, every skip form, call/return, jumps
+ * - sprite-heavy: Back-to-back DXYN draws of 5- and 15-row sprites
+ * - arith-mix:    8XYN arithmetic/logic/shifts, CXNN, FX33/FX55/FX65
+ * - timer-heavy:  A game-style "wait for the delay timer" loop
+ *                 (FX15 / FX07 polling) with the 60Hz timer tick run
+ *                 every other instruction, i.e. the timer path at its worst
+ *
+ * --quirks picks the interpreter instantiation being measured, so
+ * profiles can be compared against each other.
+ *
+ * --instances N runs N machines side by side, the way a batch of
+ * environments is stepped: each machine in turn runs one frame slice
+ * (11 instructions) before the next one gets the CPU. With many machines
+ * their state no longer fits in cache, so this measures what it costs
+ * to bring a machine's hot registers back in (see the layout notes in
+ * chip8.h).
+ *
+ * CACHE MISSES:
+ * On Linux the hardware cache-miss counter is read through
+ * perf_event_open. Containers and locked-down kernels often forbid it
+ * (perf_event_paranoid); the column then shows "n/a" / null.
+ */
+
+constexpr long DEFAULT_CYCLES = 10000000;  // Instructions per repetition
+constexpr int DEFAULT_REPETITIONS = 10;
+constexpr const char* ENGINE_NAME = "switch";  // Dispatch engine under test
+QuirkProfile benchQuirks = QuirkProfile::Chip8;  // Instantiation under test
+int benchInstances = 1;  // Machines run side by side (--instances)
+constexpr uint32_t BATCH_SLICE = 11;  // Instructions per machine per turn (one 60Hz frame)
+
+struct Workload {
+    const char* name;
+    std::vector<uint8_t> rom;
+    int cyclesPerTimerTick;  // 0 = never call updateTimers()
+};
+
+/*
+ * Synthetic ROMs
+ *
+ * Each one is an endless loop that only uses implemented opcodes,
+ * so the benchmark never hits the (slow, noisy) unknown-opcode path.
+ */
+std::vector<Workload> buildWorkloads() {
+    return {
+        {"alu-mix", {
+            0x60, 0x05,  // 200: V0 = 5
+            0x61, 0x07,  // 202: V1 = 7
+            0x70, 0x01,  // 204: loop: V0 += 1
+            0x71, 0x02,  // 206: V1 += 2
+            0x30, 0x05,  // 208: skip if V0 == 5
+            0x62, 0x03,  // 20A: V2 = 3
+            0x41, 0x06,  // 20C: skip if V1 != 6
+            0x63, 0x04,  // 20E: V3 = 4
+            0x50, 0x10,  // 210: skip if V0 == V1
+            0x90, 0x10,  // 212: skip if V0 != V1
+            0xA3, 0x00,  // 214: I = 0x300
+            0x22, 0x1A,  // 216: call 21A
+            0x12, 0x04,  // 218: jump loop
+            0x74, 0x01,  // 21A: V4 += 1
+            0xA2, 0xF0,  // 21C: I = 0x2F0
+            0x00, 0xEE,  // 21E: return
+        }, 0},
+        {"sprite-heavy", {
+            0x60, 0x00,  // 200: V0 = 0 (x)
+            0x61, 0x00,  // 202: V1 = 0 (y)
+            0xA0, 0x00,  // 204: loop: I = font '0'
+            0xD0, 0x15,  // 206: draw 5 rows at (V0, V1)
+            0xA0, 0x0A,  // 208: I = font '2'
+            0xD1, 0x05,  // 20A: draw 5 rows at (V1, V0)
+            0xA0, 0x4B,  // 20C: I = font 'F'
+            0xD0, 0x1F,  // 20E: draw 15 rows at (V0, V1)
+            0x70, 0x03,  // 210: V0 += 3
+            0x71, 0x05,  // 212: V1 += 5
+            0x12, 0x04,  // 214: jump loop
+        }, 0},
+        {"arith-mix", {
+            0x6A, 0x05,  // 200: VA = 5
+            0x6B, 0x03,  // 202: VB = 3
+            0x8A, 0xB4,  // 204: loop: VA += VB
+            0x8A, 0xB5,  // 206: VA -= VB
+            0x8A, 0xB1,  // 208: VA |= VB
+            0x8A, 0xB2,  // 20A: VA &= VB
+            0x8A, 0xB3,  // 20C: VA ^= VB
+            0x8A, 0xB6,  // 20E: VA >>= 1
+            0x8A, 0xBE,  // 210: VA <<= 1
+            0x8A, 0xB7,  // 212: VA = VB - VA
+            0xCA, 0x3F,  // 214: VA = rand & 0x3F
+            0xA3, 0x00,  // 216: I = 0x300
+            0xFA, 0x33,  // 218: BCD of VA
+            0xF3, 0x55,  // 21A: store V0-V3
+            0xF3, 0x65,  // 21C: load V0-V3
+            0xFA, 0x1E,  // 21E: I += VA
+            0x12, 0x04,  // 220: jump loop
+        }, 0},
+        {"timer-heavy", {
+            0x60, 0x05,  // 200: loop: V0 = 5
+            0xF0, 0x15,  // 202: delay timer = V0
+            0xF1, 0x07,  // 204: wait: V1 = delay timer
+            0x31, 0x00,  // 206: skip if V1 == 0
+            0x12, 0x04,  // 208: jump wait
+            0x12, 0x00,  // 20A: jump loop
+        }, 2},
+    };
+}
+
+// ==================== CACHE MISS COUNTER ====================
+
+/*
+ * Thin wrapper around a perf_event_open hardware counter.
+ * Every method is a no-op (and available() is false) when the
+ * counter cannot be opened.
+ */
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#if defined(__linux__)
+        if (fd >= 0) {
+            close(fd);
+        }
+#endif
+    }
+
+    bool available() const { return fd >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    uint64_t stop() {
+        uint64_t count = 0;
+#if defined(__linux__)
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+                count = 0;
+            }
+        }
+#endif
+        return count;
+    }
+
+private:
+    int fd = -1;
+};
+
+// ==================== MEASUREMENT ====================
+
+struct Result {
+    std::string name;
+    long cycles;
+    int repetitions;
+    double meanNs;      // ns per instruction, mean over repetitions
+    double stddevNs;
+    double minNs;
+    double maxNs;
+    bool haveCacheMisses;
+    double cacheMissesPerKiloInstr;
+};
+
+/*
+ * Run one repetition: reset the core, load the ROM, execute about
+ * `cycles` instructions and return the elapsed wall time in nanoseconds
+ * 
+ * @param executed: instructions actually run. Whole slices overshoot
+ *                  `cycles` a little, and FX0A can stop a batch early,
+ *                  so rates are computed from this, not from `cycles`.
+ */
+double runOnce(std::vector<Chip8>& machines, const Workload& workload, long cycles,
+               CacheMissCounter& counter, uint64_t& misses, uint64_t& executed) {
+    for (Chip8& chip8 : machines) {
+        chip8.reset();
+        chip8.setQuirkProfile(benchQuirks);
+        chip8.loadROM(workload.rom.data(), workload.rom.size());
+    }
+    Chip8& chip8 = machines.front();
+    executed = 0;
+
+    counter.start();
+    auto start = std::chrono::steady_clock::now();
+
+    if (machines.size() > 1) {
+        // Round robin, one slice per machine per turn
+        uint32_t slice = workload.cyclesPerTimerTick > 0
+                             ? static_cast<uint32_t>(workload.cyclesPerTimerTick) : BATCH_SLICE;
+        for (long done = 0; done < cycles; ) {
+            for (Chip8& machine : machines) {
+                executed += machine.runCycles(slice);
+                if (workload.cyclesPerTimerTick > 0) {
+                    machine.updateTimers();
+                }
+            }
+            done += static_cast<long>(slice * machines.size());
+        }
+    } else if (workload.cyclesPerTimerTick > 0) {
+        uint32_t stride = static_cast<uint32_t>(workload.cyclesPerTimerTick);
+        for (long done = 0; done < cycles; done += stride) {
+            executed += chip8.runCycles(stride);
+            chip8.updateTimers();
+        }
+    } else {
+        // runCycles() counts in uint32_t: longer runs go in chunks
+        for (long left = cycles; left > 0; ) {
+            uint32_t chunk = static_cast<uint32_t>(std::min<long>(left, std::numeric_limits<uint32_t>::max()));
+            uint32_t ran = chip8.runCycles(chunk);
+            executed += ran;
+            left -= chunk;
+            if (ran < chunk) {
+                break;  // FX0A is waiting for a key
+            }
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    misses = counter.stop();
+
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+Result measure(const Workload& workload, long cycles, int repetitions, int instances) {
+    std::vector<Chip8> machines(static_cast<std::size_t>(instances));
+    CacheMissCounter counter;
+    uint64_t misses = 0;
+    uint64_t totalMisses = 0;
+    uint64_t executed = 0;
+    uint64_t totalExecuted = 0;
+
+    // Warm-up repetition (page faults, frequency scaling, branch predictors)
+    runOnce(machines, workload, cycles / 10 + 1, counter, misses, executed);
+
+    std::vector<double> samples;
+    for (int rep = 0; rep < repetitions; ++rep) {
+        double ns = runOnce(machines, workload, cycles, counter, misses, executed);
+        samples.push_back(ns / static_cast<double>(executed > 0 ? executed : 1));
+        totalMisses += misses;
+        totalExecuted += executed;
+    }
+
+    Result result;
+    result.name = workload.name;
+    result.cycles = cycles;
+    result.repetitions = repetitions;
+    result.minNs = samples[0];
+    result.maxNs = samples[0];
+
+    double sum = 0.0;
+    for (double s : samples) {
+        sum += s;
+        if (s < result.minNs) result.minNs = s;
+        if (s > result.maxNs) result.maxNs = s;
+    }
+    result.meanNs = sum / samples.size();
+
+    double variance = 0.0;
+    for (double s : samples) {
+        variance += (s - result.meanNs) * (s - result.meanNs);
+    }
+    result.stddevNs = std::sqrt(variance / samples.size());
+
+    result.haveCacheMisses = counter.available();
+    result.cacheMissesPerKiloInstr =
+        1000.0 * static_cast<double>(totalMisses) / static_cast<double>(totalExecuted > 0 ? totalExecuted : 1);
+
+    return result;
+}
+
+// ==================== REPORTING ====================
+
+void printTable(const std::vector<Result>& results) {
+    std::printf("\n%-14s %12s %10s %10s %8s %14s\n",
+                "workload", "MIPS", "ns/instr", "stddev", "cv %", "misses/1k");
+    for (const Result& r : results) {
+        char misses[32] = "n/a";
+        if (r.haveCacheMisses) {
+            std::snprintf(misses, sizeof(misses), "%.3f", r.cacheMissesPerKiloInstr);
+        }
+        std::printf("%-14s %12.1f %10.3f %10.3f %8.2f %14s\n",
+                    r.name.c_str(), 1000.0 / r.meanNs, r.meanNs, r.stddevNs,
+                    100.0 * r.stddevNs / r.meanNs, misses);
+    }
+    std::printf("\n");
+}
+
+bool writeJson(const std::string& path, const std::vector<Result>& results) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "[ERROR] Cannot write " << path << "\n";
+        return false;
+    }
+
+    char buffer[512];
+    out << "{\n  \"benchmark\": \"chip8_bench\",\n";
+    out << "  \"engine\": \"" << ENGINE_NAME << "\",\n";
+    out << "  \"quirks\": \"" << quirkProfileName(benchQuirks) << "\",\n";
+    out << "  \"instances\": " << benchInstances << ",\n";
+    out << "  \"workloads\": [\n";
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        char misses[32] = "null";
+        if (r.haveCacheMisses) {
+            std::snprintf(misses, sizeof(misses), "%.6f", r.cacheMissesPerKiloInstr);
+        }
+        std::snprintf(buffer, sizeof(buffer),
+                      "    {\"name\": \"%s\", \"cycles\": %ld, \"repetitions\": %d, "
+                      "\"instructions_per_second\": %.1f, \"ns_per_instruction\": "
+                      "{\"mean\": %.6f, \"stddev\": %.6f, \"min\": %.6f, \"max\": %.6f}, "
+                      "\"cache_misses_per_1k_instructions\": %s}%s\n",
+                      r.name.c_str(), r.cycles, r.repetitions, 1e9 / r.meanNs,
+                      r.meanNs, r.stddevNs, r.minNs, r.maxNs, misses,
+                      (i + 1 < results.size()) ? "," : "");
+        out << buffer;
+    }
+
+    out << "  ]\n}\n";
+    return true;
+}
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --cycles N       Instructions per repetition (default " << DEFAULT_CYCLES << ")\n";
+    std::cerr << "  --reps N         Repetitions per workload (default " << DEFAULT_REPETITIONS << ")\n";
+    std::cerr << "  --workload NAME  Run only this workload\n";
+    std::cerr << "  --quirks NAME    chip8, chip48, schip or xochip (default chip8)\n";
+    std::cerr << "  --instances N    Machines run round robin, " << BATCH_SLICE << " instructions each (default 1)\n";
+    std::cerr << "  --json FILE      Write results as JSON\n";
+}
+
+int main(int argc, char* argv[]) {
+    long cycles = DEFAULT_CYCLES;
+    int repetitions = DEFAULT_REPETITIONS;
+    std::string only;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; i += 2) {
+        std::string option = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[i + 1];
+
+        if (option == "--cycles") {
+            cycles = std::strtol(value.c_str(), nullptr, 10);
+        } else if (option == "--reps") {
+            repetitions = std::atoi(value.c_str());
+        } else if (option == "--workload") {
+            only = value;
+        } else if (option == "--json") {
+            jsonPath = value;
+        } else if (option == "--instances") {
+            benchInstances = std::atoi(value.c_str());
+        } else if (option == "--quirks") {
+            if (!parseQuirkProfile(value, benchQuirks)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (cycles < 1 || repetitions < 1 || benchInstances < 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<Result> results;
+    for (const Workload& workload : buildWorkloads()) {
+        if (!only.empty() && only != workload.name) {
+            continue;
+        }
+        std::cerr << "[BENCH] " << workload.name << " ...\n";
+        results.push_back(measure(workload, cycles, repetitions, benchInstances));
+    }
+
+    if (results.empty()) {
+        std::cerr << "[ERROR] Unknown workload: " << only << "\n";
+        return 1;
+    }
+
+    printTable(results);
+
+    if (!jsonPath.empty() && !writeJson(jsonPath, results)) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,234 @@
+#include "cfg.h"
+#include "chip8.h"
+#include "disassembler.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/*
+ * CHIP-8 Control Flow Analyzer
+ *
+ * Recovers basic blocks, the call graph and data regions of a ROM
+ * without running it (see cfg.h) and prints them:
+ *
+ *   chip8_cfg game.ch8                      JSON on stdout
+ *   chip8_cfg game.ch8 --format dot | dot -Tsvg > game.svg
+ *   chip8_cfg game.ch8 --quirks xochip --output game.json
+ *
+ * JSON LAYOUT (addresses are "0x..." strings, ranges are half-open):
+ *   { "rom", "profile", "entry", "romEnd",
+ *     "blocks":      [{ "start", "end", "exit", "successors", "call", "selfModified",
+ *                       "instructions": ["CLS", ...] }],
+ *     "subroutines": [{ "entry", "blocks", "calls" }],
+ *     "data":        [{ "start", "end" }],
+ *     "stores":      [{ "pc", "known", "start", "end" }],
+ *     "indirectJumps", "externalTargets",
+ *     "selfModifying": "no" | "known" | "possible" }
+ *
+ * In DOT output every block is a node listing its instructions; jumps,
+ * skips and fallthroughs are solid edges and calls are dashed edges to
+ * the subroutine entry.
+ */
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <ROM file> [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --format json|dot   Output format (default json)\n";
+    std::cerr << "  --quirks NAME       chip8, chip48, schip or xochip (default chip8)\n";
+    std::cerr << "  --output FILE       Write to FILE instead of stdout\n";
+}
+
+// Instruction text at address (handles F000's second word)
+static void instructionText(const std::vector<uint8_t>& rom, uint32_t address, uint32_t end,
+                            char* text, std::size_t size) {
+    std::size_t offset = address - Chip8::ROM_START_ADDRESS;
+    uint16_t opcode = static_cast<uint16_t>((rom[offset] << 8) | rom[offset + 1]);
+    uint16_t nextWord = 0;
+    if (address + 4 <= end) {
+        nextWord = static_cast<uint16_t>((rom[offset + 2] << 8) | rom[offset + 3]);
+    }
+    disassemble(opcode, nextWord, text, size);
+}
+
+static uint32_t instructionSize(const std::vector<uint8_t>& rom, uint32_t address,
+                                uint32_t end, QuirkProfile profile) {
+    std::size_t offset = address - Chip8::ROM_START_ADDRESS;
+    uint16_t opcode = static_cast<uint16_t>((rom[offset] << 8) | rom[offset + 1]);
+    if (profile == QuirkProfile::XoChip && address + 4 <= end) {
+        return static_cast<uint32_t>(instructionLength(opcode));
+    }
+    return 2;
+}
+
+static void writeAddressList(FILE* out, const std::vector<uint16_t>& addresses) {
+    std::fputc('[', out);
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        std::fprintf(out, "%s\"0x%03X\"", i ? ", " : "", addresses[i]);
+    }
+    std::fputc(']', out);
+}
+
+static void writeJson(FILE* out, const ControlFlowGraph& cfg, const std::vector<uint8_t>& rom,
+                      const std::string& romPath, QuirkProfile profile) {
+    char text[32];
+
+    std::fprintf(out, "{\n  \"rom\": \"");
+    for (char c : romPath) {
+        if (c == '"' || c == '\\') {
+            std::fputc('\\', out);
+        }
+        std::fputc(c, out);
+    }
+    std::fprintf(out, "\",\n  \"profile\": \"%s\",\n", quirkProfileName(profile));
+    std::fprintf(out, "  \"entry\": \"0x%03X\",\n  \"romEnd\": \"0x%03X\",\n", cfg.entry, cfg.romEnd);
+
+    std::fprintf(out, "  \"blocks\": [\n");
+    for (std::size_t b = 0; b < cfg.blocks.size(); ++b) {
+        const BasicBlock& block = cfg.blocks[b];
+        std::fprintf(out, "    {\"start\": \"0x%03X\", \"end\": \"0x%03X\", \"exit\": \"%s\", \"successors\": ",
+                     block.start, block.end, blockExitName(block.exit));
+        writeAddressList(out, block.successors);
+        if (block.exit == BlockExit::Call) {
+            std::fprintf(out, ", \"call\": \"0x%03X\"", block.callTarget);
+        }
+        std::fprintf(out, ", \"selfModified\": %s, \"instructions\": [",
+                     block.selfModified ? "true" : "false");
+        for (uint32_t a = block.start; a < block.end; a += instructionSize(rom, a, cfg.romEnd, profile)) {
+            instructionText(rom, a, cfg.romEnd, text, sizeof(text));
+            std::fprintf(out, "%s\"%s\"", a != block.start ? ", " : "", text);
+        }
+        std::fprintf(out, "]}%s\n", b + 1 < cfg.blocks.size() ? "," : "");
+    }
+    std::fprintf(out, "  ],\n");
+
+    std::fprintf(out, "  \"subroutines\": [\n");
+    for (std::size_t s = 0; s < cfg.subroutines.size(); ++s) {
+        const Subroutine& routine = cfg.subroutines[s];
+        std::fprintf(out, "    {\"entry\": \"0x%03X\", \"blocks\": ", routine.entry);
+        writeAddressList(out, routine.blocks);
+        std::fprintf(out, ", \"calls\": ");
+        writeAddressList(out, routine.callees);
+        std::fprintf(out, "}%s\n", s + 1 < cfg.subroutines.size() ? "," : "");
+    }
+    std::fprintf(out, "  ],\n");
+
+    std::fprintf(out, "  \"data\": [");
+    for (std::size_t d = 0; d < cfg.dataRegions.size(); ++d) {
+        std::fprintf(out, "%s{\"start\": \"0x%03X\", \"end\": \"0x%03X\"}", d ? ", " : "",
+                     cfg.dataRegions[d].start, cfg.dataRegions[d].end);
+    }
+    std::fprintf(out, "],\n");
+
+    std::fprintf(out, "  \"stores\": [");
+    for (std::size_t s = 0; s < cfg.stores.size(); ++s) {
+        const StoreSite& store = cfg.stores[s];
+        std::fprintf(out, "%s{\"pc\": \"0x%03X\", \"known\": %s", s ? ", " : "", store.pc,
+                     store.known ? "true" : "false");
+        if (store.known) {
+            std::fprintf(out, ", \"start\": \"0x%03X\", \"end\": \"0x%03X\"",
+                         store.target.start, store.target.end);
+        }
+        std::fputc('}', out);
+    }
+    std::fprintf(out, "],\n");
+
+    std::fprintf(out, "  \"indirectJumps\": ");
+    writeAddressList(out, cfg.indirectJumps);
+    std::fprintf(out, ",\n  \"externalTargets\": ");
+    writeAddressList(out, cfg.externalTargets);
+
+    bool modified = false;
+    for (const BasicBlock& block : cfg.blocks) {
+        modified = modified || block.selfModified;
+    }
+    const char* verdict = modified ? "known" : (cfg.isFreeOfSelfModification() ? "no" : "possible");
+    std::fprintf(out, ",\n  \"selfModifying\": \"%s\"\n}\n", verdict);
+}
+
+static void writeDot(FILE* out, const ControlFlowGraph& cfg, const std::vector<uint8_t>& rom,
+                     QuirkProfile profile) {
+    char text[32];
+
+    std::fprintf(out, "digraph chip8 {\n  node [shape=box, fontname=\"monospace\"];\n");
+    for (const BasicBlock& block : cfg.blocks) {
+        std::fprintf(out, "  b%03X [label=\"", block.start);
+        for (uint32_t a = block.start; a < block.end; a += instructionSize(rom, a, cfg.romEnd, profile)) {
+            instructionText(rom, a, cfg.romEnd, text, sizeof(text));
+            std::fprintf(out, "%03X  %s\\l", a, text);
+        }
+        std::fprintf(out, "\"%s];\n", block.selfModified ? ", color=red" : "");
+
+        for (uint16_t successor : block.successors) {
+            if (cfg.findBlock(successor) != nullptr) {
+                std::fprintf(out, "  b%03X -> b%03X;\n", block.start, successor);
+            }
+        }
+        if (block.exit == BlockExit::Call && cfg.findBlock(block.callTarget) != nullptr) {
+            std::fprintf(out, "  b%03X -> b%03X [style=dashed];\n", block.start, block.callTarget);
+        }
+    }
+    std::fprintf(out, "}\n");
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc % 2 != 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string romPath = argv[1];
+    std::string format = "json";
+    std::string outputPath;
+    QuirkProfile profile = QuirkProfile::Chip8;
+
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--format" && (value == "json" || value == "dot")) {
+            format = value;
+        } else if (option == "--quirks") {
+            if (!parseQuirkProfile(value, profile)) {
+                std::cerr << "[ERROR] Unknown quirk profile: " << value << "\n";
+                return 1;
+            }
+        } else if (option == "--output") {
+            outputPath = value;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::ifstream file(romPath, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Cannot open ROM: " << romPath << "\n";
+        return 1;
+    }
+    std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+
+    ControlFlowGraph cfg = analyzeControlFlow(rom.data(), rom.size(), profile);
+
+    FILE* out = stdout;
+    if (!outputPath.empty()) {
+        out = std::fopen(outputPath.c_str(), "w");
+        if (out == nullptr) {
+            std::cerr << "[ERROR] Cannot write: " << outputPath << "\n";
+            return 1;
+        }
+    }
+
+    if (format == "dot") {
+        writeDot(out, cfg, rom, profile);
+    } else {
+        writeJson(out, cfg, rom, romPath, profile);
+    }
+
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
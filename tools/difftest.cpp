@@ -0,0 +1,669 @@
+#include "chip8.h"
+#include "debugger.h"
+#include "disassembler.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/*
+ * CHIP-8 Differential Tester
+ *
+ * Runs the reference interpreter (runCycles with nothing attached, the
+ * plain switch in executeOpcode) side by side with every other engine
+ * on the same ROM and the same input log, and compares the full machine
+ * state every N cycles:
+ *
+ *   step      emulateCycle() one instruction at a time
+ *   debug     the debug engines (empty debugger attached)
+ *   compiled  ahead-of-time compiled code, when the ROM has one (see aot.h)
+ *
+ * On a mismatch it replays from the last matching checkpoint one
+ * instruction at a time and reports the first divergent cycle with a
+ * diff of the state:
+ *
+ *   chip8_difftest                          200 random ROMs, all profiles
+ *   chip8_difftest --roms 5000 --seed 7
+ *   chip8_difftest --rom roms/pong.ch8 --cycles 1000000
+ *
+ * The compiled engine needs the ROMs recompiled into the binary, so the
+ * test targets save the random ROMs, recompile them and run a second
+ * build that must find compiled code for every one of them:
+ *
+ *   chip8_difftest --roms 8 --seed 1 --save-roms build/difftest_aot
+ *   chip8_recompile build/difftest_aot/rom0-chip8.ch8 build/difftest_aot/rom0-chip8.cpp --quirks chip8
+ *   ...
+ *   chip8_difftest_aot --roms 8 --seed 1 --require-compiled
+ *
+ * Exits with 1 if any engine diverged (or, with --require-compiled, a
+ * ROM had no compiled code). Random ROMs are weighted towards
+ * real opcodes of the profile (with some raw data words mixed in), and
+ * the input log presses and releases random keys, so FX0A waits and key
+ * skips are exercised too. Every address wraps (see Chip8::memory), so
+ * a run only ends early on an unknown opcode (see nextInstructionDefined).
+ */
+
+constexpr int CYCLES_PER_FRAME = 11;   // ~700Hz CPU at 60 frames per second
+constexpr int RANDOM_ROM_SIZE = 512;
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --roms N          Random ROMs to test (default 200)\n";
+    std::cerr << "  --seed N          Seed for ROMs and inputs (default 1)\n";
+    std::cerr << "  --rom FILE        Test FILE instead of random ROMs\n";
+    std::cerr << "  --quirks NAME     Profile (default: random ROMs rotate through all)\n";
+    std::cerr << "  --cycles N        Cycles per ROM (default 100000)\n";
+    std::cerr << "  --check-every N   Compare full state every N cycles (default 1000)\n";
+    std::cerr << "  --save-roms DIR   Write the random ROMs to DIR/romN-PROFILE.ch8 and exit\n";
+    std::cerr << "  --require-compiled  Fail on ROMs without compiled code (see aot.h)\n";
+}
+
+// ==================== RANDOM INPUT ====================
+
+// xorshift64*: small and reproducible across platforms
+struct Random {
+    uint64_t state;
+    explicit Random(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ULL + 1) {}
+    uint32_t next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return static_cast<uint32_t>((state * 0x2545F4914F6CDD1DULL) >> 32);
+    }
+    uint32_t below(uint32_t n) { return next() % n; }
+};
+
+// Any valid instruction with random operands; jumps and calls stay in
+// the ROM (BNNN becomes a plain jump, see randomRom for the real ones)
+uint16_t anyInstruction(Random& random, uint16_t address) {
+    uint16_t op;
+    do {
+        op = static_cast<uint16_t>(random.next());
+    } while (decodeOpcode(op) == nullptr || op < 0x1000);
+    if (op < 0x3000 || (op & 0xF000) == 0xB000) {
+        op = static_cast<uint16_t>((op < 0x3000 ? (op & 0xF000) : 0x1000) | address);
+    }
+    return op;
+}
+
+/*
+ * Random ROM: mostly well-formed instructions of the profile, so runs
+ * get past the first few bytes, with a few raw data words mixed in
+ *
+ * WHAT KEEPS RUNS IN THE ROM:
+ * - A prologue of Chip8::STACK_SIZE chained calls fills every stack slot
+ *   with a ROM address, so a stray 00EE (the stack wraps) returns into
+ *   the prologue instead of into the font at 0x000
+ * - BNNN comes with an even load of the register it adds (V0, or VX
+ *   under the CHIP-48/SUPER-CHIP BXNN quirk) and a base with room for it
+ * - The ROM ends in two jumps back to 0x200, so skipping one still jumps
+ * - Stores (FX33, FX55, 5XY2) go through an I outside the ROM
+ */
+std::vector<uint8_t> randomRom(Random& random, QuirkProfile profile) {
+    const bool schip = profile == QuirkProfile::SuperChip || profile == QuirkProfile::XoChip;
+    const bool xo = profile == QuirkProfile::XoChip;
+
+    std::vector<uint8_t> rom;
+    for (int call = 1; call <= Chip8::STACK_SIZE; ++call) {
+        uint16_t op = static_cast<uint16_t>(0x2000 | (Chip8::ROM_START_ADDRESS + 2 * call));  // CALL next
+        rom.push_back(static_cast<uint8_t>(op >> 8));
+        rom.push_back(static_cast<uint8_t>(op));
+    }
+    while (rom.size() < RANDOM_ROM_SIZE) {
+        uint16_t x = random.below(16) << 8;
+        uint16_t y = random.below(16) << 4;
+        uint16_t address = Chip8::ROM_START_ADDRESS + 2 * random.below(RANDOM_ROM_SIZE / 2);
+        uint16_t data = Chip8::ROM_START_ADDRESS + RANDOM_ROM_SIZE + random.below(0x1000 - 0x300 - RANDOM_ROM_SIZE);
+        uint16_t op;
+        switch (random.below(24)) {
+            case 0:  op = 0x6000 | x | random.below(256); break;
+            case 1:  op = 0x7000 | x | random.below(256); break;
+            case 2:
+            case 3: {
+                static const uint16_t ALU[] = {0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0xE};
+                op = 0x8000 | x | y | ALU[random.below(9)];
+                break;
+            }
+            case 4:  op = 0xA000 | (random.below(4) ? data : address); break;
+            case 5:  op = 0x1000 | address; break;
+            case 6:  op = random.below(3) ? (0x2000 | address) : 0x00EE; break;
+            case 7:  op = (random.below(2) ? 0x3000 : 0x4000) | x | random.below(256); break;
+            case 8:  op = (random.below(2) ? 0x5000 : 0x9000) | x | y; break;
+            case 9:  op = 0xD000 | x | y | random.below(16); break;
+            case 10: op = 0xC000 | x | random.below(256); break;
+            case 11:
+                if (rom.size() + 4 <= RANDOM_ROM_SIZE) {
+                    uint16_t base = Chip8::ROM_START_ADDRESS + 2 * random.below((RANDOM_ROM_SIZE - 256) / 2);
+                    const bool jumpUsesVx = profile == QuirkProfile::Chip48 || profile == QuirkProfile::SuperChip;
+                    uint16_t offsetRegister = jumpUsesVx ? (base >> 8) & 0xF : 0;
+                    uint16_t load = 0x6000 | (offsetRegister << 8) | (random.below(128) * 2);
+                    rom.push_back(static_cast<uint8_t>(load >> 8));
+                    rom.push_back(static_cast<uint8_t>(load));
+                    op = 0xB000 | base;
+                    break;
+                }
+                op = 0x1000 | address;
+                break;
+            case 12: op = 0xE000 | x | (random.below(2) ? 0x9E : 0xA1); break;
+            case 13: {
+                static const uint16_t FX[] = {0x07, 0x0A, 0x15, 0x18, 0x1E, 0x29, 0x33, 0x55, 0x65};
+                op = 0xF000 | x | FX[random.below(9)];
+                break;
+            }
+            case 14: op = 0x00E0; break;
+            case 15:
+                if (schip) {
+                    static const uint16_t SCHIP[] = {0x00C0, 0x00FB, 0x00FC, 0x00FE, 0x00FF,
+                                                     0xF030, 0xF075, 0xF085};
+                    op = SCHIP[random.below(8)];
+                    if (op == 0x00C0) {
+                        op |= random.below(16);  // 00CN
+                    } else if (op & 0xF000) {
+                        op |= x;
+                    }
+                    break;
+                }
+                op = anyInstruction(random, address);
+                break;
+            case 16:
+                if (xo) {
+                    static const uint16_t XO[] = {0x5002, 0x5003, 0xF001, 0xF002, 0xF03A, 0x00D0};
+                    op = XO[random.below(6)];
+                    if (op == 0x00D0) {
+                        op |= random.below(16);  // 00DN
+                    } else if ((op & 0xF000) == 0x5000) {
+                        op |= x | y;
+                    } else if (op != 0xF002) {
+                        op |= x;
+                    }
+                    break;
+                }
+                op = anyInstruction(random, address);
+                break;
+            case 17:
+                if (xo && rom.size() + 4 <= RANDOM_ROM_SIZE) {
+                    rom.push_back(0xF0);  // F000 NNNN: the word below is the address
+                    rom.push_back(0x00);
+                    op = static_cast<uint16_t>(random.next());
+                    break;
+                }
+                op = 0x1000 | address;
+                break;
+            case 18:
+                if (random.below(4) == 0) {
+                    op = static_cast<uint16_t>(random.next());  // Data (rarely a valid instruction)
+                    break;
+                }
+                op = 0x1000 | address;
+                break;
+            default:
+                op = anyInstruction(random, address);
+                break;
+        }
+        rom.push_back(static_cast<uint8_t>(op >> 8));
+        rom.push_back(static_cast<uint8_t>(op));
+    }
+    rom.resize(RANDOM_ROM_SIZE);
+    for (int i = RANDOM_ROM_SIZE - 4; i < RANDOM_ROM_SIZE; i += 2) {
+        rom[i] = 0x12;  // JP 0x200: don't run off into empty memory
+        rom[i + 1] = 0x00;
+    }
+    return rom;
+}
+
+struct InputEvent {
+    uint32_t frame;
+    uint8_t key;
+    bool pressed;
+};
+
+// About one key change every 8 frames
+std::vector<InputEvent> randomInputs(Random& random, uint32_t frames) {
+    std::vector<InputEvent> events;
+    bool down[16] = {};
+    for (uint32_t frame = 0; frame < frames; ++frame) {
+        if (random.below(8) == 0) {
+            uint8_t key = static_cast<uint8_t>(random.below(16));
+            down[key] = !down[key];
+            events.push_back({frame, key, down[key]});
+        }
+    }
+    return events;
+}
+
+// ==================== MACHINE STATE ====================
+
+/*
+ * Everything observable about a machine, through the public getters
+ */
+struct MachineState {
+    uint8_t V[16];
+    uint16_t I;
+    uint16_t pc;
+    uint8_t sp;
+    uint16_t stack[16];
+    uint8_t delayTimer;
+    uint8_t soundTimer;
+    bool waiting;
+    bool exited;
+    bool highResolution;
+    uint8_t planeMask;
+    uint8_t audioPitch;
+    uint64_t framebufferHash;
+    std::vector<uint8_t> memory;
+
+    void capture(const Chip8& chip8) {
+        for (int r = 0; r < 16; ++r) {
+            V[r] = chip8.getV(r);
+            stack[r] = chip8.getStackEntry(r);
+        }
+        I = chip8.getI();
+        pc = chip8.getPC();
+        sp = chip8.getSP();
+        delayTimer = chip8.getDelayTimer();
+        soundTimer = chip8.getSoundTimer();
+        waiting = chip8.isWaitingForKey();
+        exited = chip8.hasExited();
+        highResolution = chip8.isHighResolution();
+        planeMask = chip8.getPlaneMask();
+        audioPitch = chip8.getAudioPitch();
+        framebufferHash = chip8.getFramebufferHash();
+        memory.resize(chip8.getMemorySize());
+        for (std::size_t a = 0; a < memory.size(); ++a) {
+            memory[a] = chip8.readMemory(static_cast<uint16_t>(a));
+        }
+    }
+};
+
+bool sameState(const MachineState& a, const MachineState& b) {
+    return std::equal(std::begin(a.V), std::end(a.V), std::begin(b.V)) && a.I == b.I &&
+           a.pc == b.pc && a.sp == b.sp &&
+           std::equal(std::begin(a.stack), std::end(a.stack), std::begin(b.stack)) &&
+           a.delayTimer == b.delayTimer && a.soundTimer == b.soundTimer &&
+           a.waiting == b.waiting && a.exited == b.exited &&
+           a.highResolution == b.highResolution && a.planeMask == b.planeMask &&
+           a.audioPitch == b.audioPitch && a.framebufferHash == b.framebufferHash &&
+           a.memory == b.memory;
+}
+
+// Prints every differing field; returns true if the states are equal
+bool diffStates(const MachineState& expected, const MachineState& actual) {
+    int differences = 0;
+    auto field = [&](const char* name, unsigned a, unsigned b) {
+        if (a != b) {
+            std::printf("    %-16s reference 0x%X, engine 0x%X\n", name, a, b);
+            ++differences;
+        }
+    };
+    char name[32];
+    for (int r = 0; r < 16; ++r) {
+        std::snprintf(name, sizeof(name), "V%X", r);
+        field(name, expected.V[r], actual.V[r]);
+    }
+    field("I", expected.I, actual.I);
+    field("PC", expected.pc, actual.pc);
+    field("SP", expected.sp, actual.sp);
+    for (int s = 0; s < 16; ++s) {
+        std::snprintf(name, sizeof(name), "stack[%d]", s);
+        field(name, expected.stack[s], actual.stack[s]);
+    }
+    field("delay timer", expected.delayTimer, actual.delayTimer);
+    field("sound timer", expected.soundTimer, actual.soundTimer);
+    field("waiting (FX0A)", expected.waiting, actual.waiting);
+    field("exited", expected.exited, actual.exited);
+    field("hi-res", expected.highResolution, actual.highResolution);
+    field("plane mask", expected.planeMask, actual.planeMask);
+    field("audio pitch", expected.audioPitch, actual.audioPitch);
+    if (expected.framebufferHash != actual.framebufferHash) {
+        std::printf("    %-16s reference %016llx, engine %016llx\n", "framebuffer",
+                    static_cast<unsigned long long>(expected.framebufferHash),
+                    static_cast<unsigned long long>(actual.framebufferHash));
+        ++differences;
+    }
+    int shown = 0;
+    for (std::size_t a = 0; a < expected.memory.size() && a < actual.memory.size(); ++a) {
+        if (expected.memory[a] != actual.memory[a] && shown++ < 8) {
+            std::snprintf(name, sizeof(name), "memory[0x%03zX]", a);
+            field(name, expected.memory[a], actual.memory[a]);
+        }
+    }
+    if (shown > 8) {
+        std::printf("    ... %d more memory bytes differ\n", shown - 8);
+    }
+    return differences == 0 && shown == 0;
+}
+
+// ==================== ENGINES ====================
+
+enum class Engine { Step, Debug, Compiled };
+
+const char* engineName(Engine engine) {
+    switch (engine) {
+        case Engine::Step:     return "step";
+        case Engine::Debug:    return "debug";
+        case Engine::Compiled: return "compiled";
+    }
+    return "?";
+}
+
+/*
+ * Is the next instruction worth comparing?
+ *
+ * WHY?
+ * Fetches, the stack and I-relative accesses all wrap, so every real
+ * instruction is defined whatever a random ROM does. Unknown opcodes are
+ * not: they only count an error, and a run of them compares nothing, so a
+ * run ends just before one.
+ * @param reason: set to why the run must stop
+ */
+bool nextInstructionDefined(const Chip8& chip8, const char*& reason) {
+    reason = nullptr;
+    const OpcodeInfo* info = decodeOpcode(chip8.peekOpcode());
+    if (info == nullptr || (info->mask == 0xF000 && info->value == 0x0000)) {  // 0NNN: machine code
+        reason = "unknown opcode";
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Reference frame: the plain interpreter, one instruction at a time so
+ * the run can stop before an unknown opcode
+ * @return: instructions run (fewer than cycles if FX0A starts waiting)
+ */
+uint32_t runReference(Chip8& chip8, uint32_t cycles, const char*& stopReason) {
+    uint32_t done = 0;
+    while (done < cycles && nextInstructionDefined(chip8, stopReason)) {
+        if (chip8.runCycles(1) == 0) {
+            return done;  // Waiting for a key
+        }
+        ++done;
+    }
+    return done;
+}
+
+/*
+ * Engine frame: up to `cycles` instructions (fewer if FX0A starts waiting)
+ * @param stepwise: one runCycles(1) per instruction, for replays
+ */
+uint32_t runEngine(Chip8& chip8, Engine engine, uint32_t cycles, bool stepwise) {
+    if (engine == Engine::Step) {
+        uint32_t done = 0;
+        while (done < cycles && !chip8.isWaitingForKey()) {
+            chip8.emulateCycle();
+            ++done;
+        }
+        return done;
+    }
+    if (!stepwise) {
+        return chip8.runCycles(cycles);
+    }
+    uint32_t done = 0;
+    while (done < cycles && chip8.runCycles(1) == 1) {
+        ++done;
+    }
+    return done;
+}
+
+void endFrame(Chip8& chip8, const std::vector<InputEvent>& inputs, std::size_t& nextInput, uint32_t frame) {
+    while (nextInput < inputs.size() && inputs[nextInput].frame == frame) {
+        chip8.setKey(inputs[nextInput].key, inputs[nextInput].pressed);
+        ++nextInput;
+    }
+    chip8.updateTimers();
+}
+
+/*
+ * Replay from a checkpoint one instruction at a time to find the first
+ * cycle where the states differ
+ */
+void locateDivergence(Chip8 reference, Chip8 engine, Engine kind, const std::vector<InputEvent>& inputs,
+                      std::size_t nextInput, uint32_t frame, uint64_t cycle, uint32_t lastFrame) {
+    MachineState expected;
+    MachineState actual;
+    std::size_t engineInput = nextInput;
+    const char* stopReason = nullptr;
+
+    for (; frame <= lastFrame; ++frame) {
+        for (int i = 0; i < CYCLES_PER_FRAME; ++i) {
+            uint16_t pc = reference.getPC();
+            uint16_t opcode = reference.peekOpcode();
+            uint32_t a = runReference(reference, 1, stopReason);
+            uint32_t b = runEngine(engine, kind, 1, true);
+            expected.capture(reference);
+            actual.capture(engine);
+            if (a != b) {
+                std::printf("  first divergence at cycle %llu (frame %u): reference ran %u, engine ran %u\n",
+                            static_cast<unsigned long long>(cycle), frame, a, b);
+                return;
+            }
+            if (!diffStates(expected, actual)) {
+                std::printf("  ^ first divergence at cycle %llu (frame %u), after PC 0x%03X opcode 0x%04X\n",
+                            static_cast<unsigned long long>(cycle), frame, pc, opcode);
+                return;
+            }
+            if (a == 0) {
+                break;  // Both waiting for a key (or the run ended)
+            }
+            ++cycle;
+        }
+        endFrame(reference, inputs, nextInput, frame);
+        endFrame(engine, inputs, engineInput, frame);
+        expected.capture(reference);
+        actual.capture(engine);
+        if (!diffStates(expected, actual)) {
+            std::printf("  ^ first divergence at the end of frame %u (timers / input)\n", frame);
+            return;
+        }
+    }
+    std::printf("  states diverged but the stepwise replay did not (batching difference)\n");
+}
+
+struct RunResult {
+    bool match;
+    uint64_t cycles;          // Instructions compared
+    const char* stopReason;   // Why the run ended early, or nullptr
+};
+
+/*
+ * Run the reference and one engine side by side
+ */
+RunResult compareEngine(const std::vector<uint8_t>& rom, QuirkProfile profile, Engine kind,
+                        const std::vector<InputEvent>& inputs, uint64_t cycles, uint64_t checkEvery,
+                        const std::string& label) {
+    Debugger emptyDebugger;
+    Chip8 reference;
+    Chip8 engine;
+    reference.setQuirkProfile(profile);
+    engine.setQuirkProfile(profile);
+    reference.setCompiledRomsEnabled(false);
+    engine.setCompiledRomsEnabled(kind == Engine::Compiled);
+    if (!reference.loadROM(rom.data(), rom.size()) || !engine.loadROM(rom.data(), rom.size())) {
+        std::printf("%s: ROM does not fit\n", label.c_str());
+        return {false, 0, nullptr};
+    }
+    if (kind == Engine::Debug) {
+        engine.attachDebugger(&emptyDebugger);
+    }
+
+    const uint32_t frames = static_cast<uint32_t>((cycles + CYCLES_PER_FRAME - 1) / CYCLES_PER_FRAME);
+    MachineState expected;
+    MachineState actual;
+
+    // Last matching checkpoint
+    Chip8 referenceCheckpoint = reference;
+    Chip8 engineCheckpoint = engine;
+    std::size_t checkpointInput = 0;
+    uint32_t checkpointFrame = 0;
+    uint64_t checkpointCycle = 0;
+
+    std::size_t referenceInput = 0;
+    std::size_t engineInput = 0;
+    uint64_t cycle = 0;
+    uint64_t nextCheck = checkEvery;
+    const char* stopReason = nullptr;
+
+    for (uint32_t frame = 0; frame < frames && stopReason == nullptr; ++frame) {
+        uint32_t a = runReference(reference, CYCLES_PER_FRAME, stopReason);
+        // A run that stops early gives the engine exactly the same instructions
+        uint32_t b = runEngine(engine, kind, stopReason ? a : CYCLES_PER_FRAME, false);
+        cycle += a;
+        if (stopReason == nullptr) {
+            endFrame(reference, inputs, referenceInput, frame);
+            endFrame(engine, inputs, engineInput, frame);
+        }
+
+        if (a != b || cycle >= nextCheck || frame + 1 == frames || stopReason != nullptr) {
+            expected.capture(reference);
+            actual.capture(engine);
+            if (a != b || !sameState(expected, actual)) {
+                std::printf("%s: engine '%s' diverged between cycle %llu and %llu\n", label.c_str(),
+                            engineName(kind), static_cast<unsigned long long>(checkpointCycle),
+                            static_cast<unsigned long long>(cycle));
+                locateDivergence(referenceCheckpoint, engineCheckpoint, kind, inputs, checkpointInput,
+                                 checkpointFrame, checkpointCycle, frame);
+                return {false, cycle, stopReason};
+            }
+            referenceCheckpoint = reference;
+            engineCheckpoint = engine;
+            checkpointInput = referenceInput;
+            checkpointFrame = frame + 1;
+            checkpointCycle = cycle;
+            nextCheck = cycle + checkEvery;
+        }
+    }
+    return {true, cycle, stopReason};
+}
+
+int main(int argc, char* argv[]) {
+    long roms = 200;
+    uint64_t seed = 1;
+    std::string romPath;
+    bool fixedProfile = false;
+    QuirkProfile profile = QuirkProfile::Chip8;
+    uint64_t cycles = 100000;
+    uint64_t checkEvery = 1000;
+    std::string saveDir;
+    bool requireCompiled = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--require-compiled") {
+            requireCompiled = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (option == "--roms") {
+            roms = std::strtol(value.c_str(), nullptr, 10);
+        } else if (option == "--seed") {
+            seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (option == "--rom") {
+            romPath = value;
+        } else if (option == "--quirks") {
+            if (!parseQuirkProfile(value, profile)) {
+                std::cerr << "[ERROR] Unknown quirk profile: " << value << "\n";
+                return 1;
+            }
+            fixedProfile = true;
+        } else if (option == "--cycles") {
+            cycles = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (option == "--check-every") {
+            checkEvery = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (option == "--save-roms") {
+            saveDir = value;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (checkEvery == 0) {
+        checkEvery = 1;
+    }
+
+    const QuirkProfile PROFILES[] = {QuirkProfile::Chip8, QuirkProfile::Chip48,
+                                     QuirkProfile::SuperChip, QuirkProfile::XoChip};
+    Random random(seed);
+    const uint32_t frames = static_cast<uint32_t>((cycles + CYCLES_PER_FRAME - 1) / CYCLES_PER_FRAME);
+
+    std::vector<uint8_t> fileRom;
+    if (!romPath.empty()) {
+        std::ifstream file(romPath, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "[ERROR] Cannot open ROM: " << romPath << "\n";
+            return 1;
+        }
+        fileRom.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        roms = 1;
+    }
+
+    int failures = 0;
+    int notCompiled = 0;
+    long comparisons = 0;
+    long endedEarly = 0;
+    uint64_t comparedCycles = 0;
+    for (long r = 0; r < roms; ++r) {
+        QuirkProfile romProfile = fixedProfile ? profile : PROFILES[r % 4];
+        std::vector<uint8_t> rom = romPath.empty() ? randomRom(random, romProfile) : fileRom;
+        std::vector<InputEvent> inputs = randomInputs(random, frames);
+
+        std::string label = romPath.empty() ? "ROM #" + std::to_string(r) : romPath;
+        label += std::string(" (") + quirkProfileName(romProfile) + ")";
+
+        if (!saveDir.empty()) {
+            // Same ROMs as a test run with the same seed (inputs are drawn above too)
+            std::string path = saveDir + "/rom" + std::to_string(r) + "-" + quirkProfileName(romProfile) + ".ch8";
+            std::ofstream file(path, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(rom.data()), static_cast<std::streamsize>(rom.size()));
+            if (!file) {
+                std::cerr << "[ERROR] Cannot write ROM: " << path << "\n";
+                return 1;
+            }
+            continue;
+        }
+
+        std::vector<Engine> engines = {Engine::Step, Engine::Debug};
+        Chip8 probe;
+        probe.setQuirkProfile(romProfile);
+        if (probe.loadROM(rom.data(), rom.size()) && probe.getCompiledRom() != nullptr) {
+            engines.push_back(Engine::Compiled);
+        } else if (requireCompiled) {
+            std::printf("%s: no compiled code for this ROM (see aot.h)\n", label.c_str());
+            ++notCompiled;
+        }
+
+        for (Engine engine : engines) {
+            RunResult result = compareEngine(rom, romProfile, engine, inputs, cycles, checkEvery, label);
+            ++comparisons;
+            comparedCycles += result.cycles;
+            failures += result.match ? 0 : 1;
+            endedEarly += result.stopReason ? 1 : 0;
+            if (result.stopReason && !romPath.empty()) {
+                std::printf("%s: run ended after %llu cycles: %s\n", label.c_str(),
+                            static_cast<unsigned long long>(result.cycles), result.stopReason);
+            }
+        }
+    }
+
+    if (!saveDir.empty()) {
+        std::printf("[DIFFTEST] %ld ROMs written to %s\n", roms, saveDir.c_str());
+        return 0;
+    }
+
+    std::printf("[DIFFTEST] %ld ROMs, %ld engine comparisons, %llu cycles compared, "
+                "%ld ended on an unknown opcode, %d divergent", roms, comparisons,
+                static_cast<unsigned long long>(comparedCycles), endedEarly, failures);
+    if (requireCompiled) {
+        std::printf(", %d without compiled code", notCompiled);
+    }
+    std::printf("\n");
+    return failures == 0 && notCompiled == 0 ? 0 : 1;
+}
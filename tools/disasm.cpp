@@ -0,0 +1,73 @@
+#include "chip8.h"
+#include "disassembler.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+/*
+ * CHIP-8 Disassembler
+ *
+ * Lists a ROM as instructions, starting at 0x200:
+ *
+ *   chip8_disasm game.ch8
+ *
+ *   0x200  00E0       CLS
+ *   0x202  A22A       LD I, 0x22A
+ *   0x204  F000 1234  LD I, 0x1234
+ *
+ * This is a linear sweep: every word is decoded as if it were code, so
+ * sprite data shows up as (often nonsensical) instructions or "DW".
+ * Good enough for reading a ROM next to a trace; telling code from data
+ * needs control flow analysis.
+ */
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <ROM file>\n";
+        return 1;
+    }
+
+    std::ifstream file(argv[1], std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Cannot open ROM: " << argv[1] << "\n";
+        return 1;
+    }
+    std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+
+    char text[32];
+    std::size_t offset = 0;
+    while (offset < rom.size()) {
+        unsigned address = Chip8::ROM_START_ADDRESS + static_cast<unsigned>(offset);
+
+        // An odd trailing byte can't be an instruction
+        if (offset + 1 >= rom.size()) {
+            std::printf("0x%03X  %02X         DB 0x%02X\n", address, rom[offset], rom[offset]);
+            break;
+        }
+
+        uint16_t opcode = static_cast<uint16_t>((rom[offset] << 8) | rom[offset + 1]);
+        int length = instructionLength(opcode);
+        uint16_t nextWord = 0;
+        if (offset + length > rom.size()) {
+            length = 2;  // F000 with its operand cut off by the end of the ROM
+            std::snprintf(text, sizeof(text), "DW 0x%04X", opcode);
+        } else {
+            if (length == 4) {
+                nextWord = static_cast<uint16_t>((rom[offset + 2] << 8) | rom[offset + 3]);
+            }
+            disassemble(opcode, nextWord, text, sizeof(text));
+        }
+
+        if (length == 4) {
+            std::printf("0x%03X  %04X %04X  %s\n", address, opcode, nextWord, text);
+        } else {
+            std::printf("0x%03X  %04X       %s\n", address, opcode, text);
+        }
+        offset += length;
+    }
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+#include "chip8.h"
+#include "explorer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/*
+ * CHIP-8 Explorer
+ *
+ * Beam search over key sequences (see explorer.h): finds inputs that
+ * reach new code, a halt, or a goal address, and writes the key path
+ * that gets there.
+ *
+ *   chip8_explore game.ch8 --depth 300                      widen coverage
+ *   chip8_explore game.ch8 --goal 0x3A4 --path level2.keys  reach the end of a level
+ *   chip8_explore game.ch8 --keys 456 --pairs on --beam 1024 --threads 8
+ *
+ * Find a goal address with chip8_disasm / chip8_cfg (e.g. the routine
+ * that draws "LEVEL 2"). Without --goal the search runs --depth steps
+ * and reports the best frontier path and the first halt it saw (a jump
+ * to itself or 00FD: usually "game over", sometimes a crash).
+ *
+ * PATH FILE FORMAT:
+ * One line per action: the key mask as 4 hex digits and the number of
+ * frames it is held, e.g. "0010 8" = key 4 for 8 frames. The run starts
+ * from reset with CXNN seeded by --seed.
+ *
+ * Exits with 0 if --goal was reached (or no goal was given), 1 if not.
+ */
+
+constexpr int CPU_FREQ_HZ = 700;
+constexpr int TIMER_FREQ_HZ = 60;
+constexpr uint32_t DEFAULT_DEPTH = 100;
+
+void printUsage(const char* program) {
+    ExplorerConfig defaults;
+    std::cerr << "Usage: " << program << " <ROM file> [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --depth N         Actions per path at most (default " << DEFAULT_DEPTH << ")\n";
+    std::cerr << "  --beam N          States kept per depth (default " << defaults.beamWidth << ")\n";
+    std::cerr << "  --hold N          Frames each action is held (default " << defaults.framesPerAction << ")\n";
+    std::cerr << "  --keys HEX        Keys actions may press, e.g. 456 (default all 16)\n";
+    std::cerr << "  --pairs on|off    Also press every two of them at once (default off)\n";
+    std::cerr << "  --goal ADDR       Stop when this address executes (can be given several times)\n";
+    std::cerr << "  --path FILE       Write the goal path (or the best path) here\n";
+    std::cerr << "  --threads N       Worker threads (default: one per CPU)\n";
+    std::cerr << "  --states N        Seen-state set capacity (default " << defaults.maxStates << ")\n";
+    std::cerr << "  --quirks NAME     chip8, chip48, schip or xochip (default chip8)\n";
+    std::cerr << "  --seed N          CXNN seed of the start state (default 1)\n";
+}
+
+// "0010 8 0000 8 ..." on one line, for the console
+static void printPath(const char* label, const std::vector<uint16_t>& keys, uint32_t hold) {
+    std::cout << "[EXPLORE] " << label << " (" << keys.size() << " actions, " << keys.size() * hold << " frames):";
+    char mask[8];
+    for (uint16_t key : keys) {
+        std::snprintf(mask, sizeof(mask), " %04x", key);
+        std::cout << mask;
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc % 2 != 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string romPath = argv[1];
+    ExplorerConfig config;
+    config.cyclesPerFrame = CPU_FREQ_HZ / TIMER_FREQ_HZ;
+    uint32_t depth = DEFAULT_DEPTH;
+    std::string pathFile;
+
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--depth") {
+            depth = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (option == "--beam") {
+            config.beamWidth = std::strtoul(value.c_str(), nullptr, 10);
+        } else if (option == "--hold") {
+            config.framesPerAction = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (option == "--keys") {
+            config.keys = 0;
+            for (char digit : value) {
+                char text[2] = {digit, '\0'};
+                char* end = nullptr;
+                long key = std::strtol(text, &end, 16);
+                if (*end != '\0') {
+                    std::cerr << "[ERROR] --keys takes hex digits, e.g. 456\n";
+                    return 1;
+                }
+                config.keys |= static_cast<uint16_t>(1u << key);
+            }
+        } else if (option == "--pairs") {
+            if (value != "on" && value != "off") {
+                std::cerr << "[ERROR] --pairs takes on or off\n";
+                return 1;
+            }
+            config.keyPairs = (value == "on");
+        } else if (option == "--goal") {
+            char* end = nullptr;
+            long address = std::strtol(value.c_str(), &end, 0);
+            if (*end != '\0' || address < 0 || address > 0xFFFF) {
+                std::cerr << "[ERROR] Bad goal address: " << value << "\n";
+                return 1;
+            }
+            config.goalPcs.push_back(static_cast<uint16_t>(address));
+        } else if (option == "--path") {
+            pathFile = value;
+        } else if (option == "--threads") {
+            config.threads = static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (option == "--states") {
+            config.maxStates = std::strtoul(value.c_str(), nullptr, 10);
+        } else if (option == "--quirks") {
+            if (!parseQuirkProfile(value, config.profile)) {
+                std::cerr << "[ERROR] Unknown quirk profile: " << value << "\n";
+                return 1;
+            }
+        } else if (option == "--seed") {
+            config.seed = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        } else {
+            std::cerr << "[ERROR] Unknown option: " << option << "\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (config.beamWidth == 0 || config.framesPerAction == 0) {
+        std::cerr << "[ERROR] --beam and --hold must be at least 1\n";
+        return 1;
+    }
+
+    std::ifstream file(romPath, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Cannot open ROM: " << romPath << "\n";
+        return 1;
+    }
+    std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    Explorer explorer(rom.data(), rom.size(), config);
+    if (!explorer.loadedOk()) {
+        return 1;
+    }
+    std::cout << "[EXPLORE] " << explorer.actions().size() << " actions, beam " << config.beamWidth
+              << ", " << config.framesPerAction << " frames per action\n";
+
+    const auto start = std::chrono::steady_clock::now();
+    while (explorer.stats().depth < depth && explorer.step()) {
+        const ExplorerStats& stats = explorer.stats();
+        if (stats.depth % 10 == 0) {
+            std::cout << "[EXPLORE] Depth " << stats.depth << ": " << stats.pcsCovered << " PCs, "
+                      << stats.framebuffersSeen << " screens, " << stats.children << " forks, "
+                      << stats.duplicates << " duplicates, " << stats.halts << " halts\n";
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const ExplorerStats& stats = explorer.stats();
+    std::cout << "[EXPLORE] Searched " << stats.depth << " depths in " << seconds << " s ("
+              << static_cast<uint64_t>(stats.children / (seconds > 0 ? seconds : 1)) << " forks/s): "
+              << stats.pcsCovered << " PCs covered, " << stats.framebuffersSeen << " screens, "
+              << stats.duplicates << " duplicate states skipped\n";
+    if (stats.stateSetFull) {
+        std::cout << "[EXPLORE] Seen-state set is full; raise --states to keep deduplicating\n";
+    }
+
+    const std::vector<uint16_t> halt = explorer.haltPath();
+    if (!halt.empty()) {
+        printPath("First halt", halt, config.framesPerAction);
+    }
+    std::vector<uint16_t> result;
+    if (explorer.goalReached()) {
+        result = explorer.goalPath();
+        printPath("Goal reached", result, config.framesPerAction);
+    } else {
+        result = explorer.bestPath();
+        if (!config.goalPcs.empty()) {
+            std::cout << "[EXPLORE] Goal not reached\n";
+        }
+        printPath("Best path", result, config.framesPerAction);
+    }
+
+    if (!pathFile.empty()) {
+        std::ofstream out(pathFile);
+        char line[32];
+        for (uint16_t keys : result) {
+            std::snprintf(line, sizeof(line), "%04x %u\n", keys, config.framesPerAction);
+            out << line;
+        }
+        if (!out) {
+            std::cerr << "[ERROR] Cannot write path: " << pathFile << "\n";
+            return 1;
+        }
+    }
+    return (config.goalPcs.empty() || explorer.goalReached()) ? 0 : 1;
+}
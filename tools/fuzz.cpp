@@ -0,0 +1,336 @@
+#include "chip8.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*
+ * CHIP-8 Core Fuzzer
+ *
+ * Feeds arbitrary bytes to the interpreter as ROMs and catches every
+ * input that crashes it. Guest addresses and the stack wrap (see
+ * Chip8::memory), so no ROM should be able to; build with sanitizers
+ * (cmake -DCHIP8_LIBFUZZER=ON, or -fsanitize=address,undefined) to
+ * catch the accesses that would not crash on their own.
+ *
+ * INPUT LAYOUT:
+ *   byte 0     quirk profile (low 2 bits: chip8, chip48, schip, xochip)
+ *   byte 1     first key of the input schedule
+ *   byte 2..   the ROM, loaded at 0x200 (cut to what fits)
+ *
+ * Each input runs for at most --cycles instructions, 11 per frame, with
+ * one key pressed on even frames and released on odd ones (so FX0A
+ * waits finish and key skips go both ways).
+ *
+ * TWO WAYS TO RUN:
+ *   libFuzzer (clang): cmake -DCHIP8_LIBFUZZER=ON, then
+ *       chip8_fuzz corpus/ -max_len=4096
+ *     The sanitizers report a bad access and libFuzzer saves the input.
+ *   Standalone (any compiler): chip8_fuzz [options] [seed files]
+ *     A built-in mutation loop, guided by which guest PC -> PC edges an
+ *     input reaches. If an input crashes the process, a signal handler
+ *     saves it to --crashes DIR as crash-signal.bin.
+ *
+ * WHY one machine for every input?
+ * Constructing a Chip8 sets up engines and logs; reset() just clears
+ * the state (a few KB), which keeps the cost per input at the cycles
+ * actually run.
+ */
+
+constexpr int CYCLES_PER_FRAME = 11;
+constexpr std::size_t MAX_INPUT_SIZE = 4096;
+constexpr uint32_t COVERAGE_SIZE = 1 << 16;
+
+// Guest PC -> PC edges reached so far
+struct EdgeCoverage {
+    std::vector<uint8_t> seen = std::vector<uint8_t>(COVERAGE_SIZE, 0);
+    std::vector<uint32_t> fresh;   // Edges first reached by the current input
+    uint32_t total = 0;
+
+    void hit(uint32_t edge) {
+        if (!seen[edge]) {
+            seen[edge] = 1;
+            fresh.push_back(edge);
+            ++total;
+        }
+    }
+};
+
+static Chip8& machine() {
+    static Chip8 chip8;
+    return chip8;
+}
+
+/*
+ * Run One Input
+ * @param coverage: edges to update (nullptr: run a frame at a time)
+ */
+static void runInput(const uint8_t* data, std::size_t size, uint32_t maxCycles, EdgeCoverage* coverage) {
+    static const QuirkProfile PROFILES[] = {QuirkProfile::Chip8, QuirkProfile::Chip48,
+                                            QuirkProfile::SuperChip, QuirkProfile::XoChip};
+    if (size < 2) {
+        return;
+    }
+    Chip8& chip8 = machine();
+    chip8.setQuirkProfile(PROFILES[data[0] & 3]);
+    chip8.reset();
+    std::size_t romSize = size - 2;
+    if (romSize > chip8.getMemorySize() - Chip8::ROM_START_ADDRESS) {
+        romSize = chip8.getMemorySize() - Chip8::ROM_START_ADDRESS;
+    }
+    chip8.loadROM(data + 2, romSize);
+
+    uint32_t cycles = 0;
+    uint16_t previous = chip8.getPC();
+    for (uint32_t frame = 0; cycles < maxCycles; ++frame) {
+        if (coverage == nullptr) {
+            // No edges to record: let the release engine run the frame
+            cycles += CYCLES_PER_FRAME;
+            chip8.runCycles(CYCLES_PER_FRAME);
+        }
+        for (int i = 0; coverage != nullptr && i < CYCLES_PER_FRAME && cycles < maxCycles; ++i, ++cycles) {
+            if (chip8.runCycles(1) == 0 || chip8.hasExited()) {
+                break;  // Waiting for a key, or 00FD
+            }
+            // AFL-style edge: the shift keeps A->B and B->A apart
+            uint16_t pc = chip8.getPC();
+            coverage->hit(((previous >> 1) ^ pc) & (COVERAGE_SIZE - 1));
+            previous = pc;
+        }
+        if (chip8.hasExited()) {
+            break;
+        }
+        chip8.setKey(static_cast<uint8_t>((data[1] + frame / 2) & 0xF), frame % 2 == 0);
+        chip8.updateTimers();
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size) {
+    runInput(data, size, 10000, nullptr);
+    return 0;
+}
+
+#ifndef CHIP8_LIBFUZZER
+
+// ==================== STANDALONE MUTATION LOOP ====================
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options] [seed files...]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --runs N        Inputs to try (default 1000000, 0 = forever)\n";
+    std::cerr << "  --seed N        Mutation seed (default 1)\n";
+    std::cerr << "  --cycles N      Instructions per input (default 1000)\n";
+    std::cerr << "  --crashes DIR   Where a crashing input is written (default .)\n";
+}
+
+// xorshift64*: small and reproducible across platforms
+struct Random {
+    uint64_t state;
+    explicit Random(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ULL + 1) {}
+    uint32_t next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return static_cast<uint32_t>((state * 0x2545F4914F6CDD1DULL) >> 32);
+    }
+    uint32_t below(uint32_t n) { return next() % n; }
+};
+
+/*
+ * Mutate
+ *
+ * 1 to 4 random edits. Besides the usual byte-level ones, one edit
+ * inserts a whole instruction at an even ROM offset, which keeps the
+ * rest of the program aligned (a single inserted byte would turn every
+ * following instruction into a different one).
+ */
+static void mutate(std::vector<uint8_t>& input, Random& random, const std::vector<std::vector<uint8_t>>& corpus) {
+    static const uint8_t INTERESTING[] = {0x00, 0x01, 0x0F, 0x10, 0x7F, 0x80, 0xEE, 0xF0, 0xFF};
+    int edits = 1 + random.below(4);
+    for (int e = 0; e < edits; ++e) {
+        std::size_t size = input.size();
+        std::size_t at = random.below(static_cast<uint32_t>(size));
+        switch (random.below(8)) {
+            case 0:  // Flip a bit
+                input[at] ^= static_cast<uint8_t>(1 << random.below(8));
+                break;
+            case 1:  // Random byte
+                input[at] = static_cast<uint8_t>(random.next());
+                break;
+            case 2:  // Interesting byte
+                input[at] = INTERESTING[random.below(sizeof(INTERESTING))];
+                break;
+            case 3: {  // Insert an instruction
+                std::size_t even = 2 + (random.below(static_cast<uint32_t>(size - 1)) & ~1u);
+                if (size + 2 > MAX_INPUT_SIZE) {
+                    break;
+                }
+                uint16_t word = static_cast<uint16_t>(random.next());
+                input.insert(input.begin() + static_cast<std::ptrdiff_t>(even),
+                             {static_cast<uint8_t>(word >> 8), static_cast<uint8_t>(word)});
+                break;
+            }
+            case 4: {  // Erase a few bytes (keep the 2-byte header)
+                std::size_t count = 1 + random.below(8);
+                if (at >= 2 && at + count <= size) {
+                    input.erase(input.begin() + static_cast<std::ptrdiff_t>(at),
+                                input.begin() + static_cast<std::ptrdiff_t>(at + count));
+                }
+                break;
+            }
+            case 5: {  // Duplicate a chunk somewhere else
+                std::size_t count = 1 + random.below(32);
+                std::size_t from = random.below(static_cast<uint32_t>(size));
+                if (from + count <= size && size + count <= MAX_INPUT_SIZE) {
+                    std::vector<uint8_t> chunk(input.begin() + static_cast<std::ptrdiff_t>(from),
+                                               input.begin() + static_cast<std::ptrdiff_t>(from + count));
+                    input.insert(input.begin() + static_cast<std::ptrdiff_t>(at < 2 ? 2 : at),
+                                 chunk.begin(), chunk.end());
+                }
+                break;
+            }
+            case 6: {  // Splice: our head, another input's tail
+                const std::vector<uint8_t>& other = corpus[random.below(static_cast<uint32_t>(corpus.size()))];
+                if (at < other.size()) {
+                    input.resize(at);
+                    input.insert(input.end(), other.begin() + static_cast<std::ptrdiff_t>(at), other.end());
+                }
+                break;
+            }
+            case 7:  // Other profile
+                input[0] = static_cast<uint8_t>(random.next());
+                break;
+        }
+        if (input.size() < 2) {
+            input.resize(2);
+        }
+    }
+}
+
+#ifndef _WIN32
+// A crash takes the process down with it: save the input being run from
+// the signal handler first (write() is signal-safe)
+static const std::vector<uint8_t>* currentInput = nullptr;
+static std::string signalCrashPath;
+
+static void onCrashSignal(int signal) {
+    if (currentInput != nullptr) {
+        int fd = open(signalCrashPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd >= 0) {
+            ssize_t written = write(fd, currentInput->data(), currentInput->size());
+            (void)written;
+            close(fd);
+        }
+    }
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    uint64_t runs = 1000000;
+    uint64_t seed = 1;
+    uint32_t maxCycles = 1000;
+    std::string crashDir = ".";
+    std::vector<std::vector<uint8_t>> corpus;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--", 0) == 0) {
+            if (i + 1 >= argc) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            std::string value = argv[++i];
+            if (arg == "--runs") {
+                runs = std::strtoull(value.c_str(), nullptr, 10);
+            } else if (arg == "--seed") {
+                seed = std::strtoull(value.c_str(), nullptr, 10);
+            } else if (arg == "--cycles") {
+                maxCycles = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+            } else if (arg == "--crashes") {
+                crashDir = value;
+            } else {
+                printUsage(argv[0]);
+                return 1;
+            }
+            continue;
+        }
+        std::ifstream file(arg, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "[ERROR] Cannot open seed: " << arg << "\n";
+            return 1;
+        }
+        std::vector<uint8_t> input((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (input.size() >= 2 && input.size() <= MAX_INPUT_SIZE) {
+            corpus.push_back(input);
+        }
+    }
+    if (corpus.empty()) {
+        // One tiny program per profile: CLS, draw the font's 0, loop
+        for (uint8_t profile = 0; profile < 4; ++profile) {
+            corpus.push_back({profile, 0, 0x00, 0xE0, 0xA0, 0x00, 0xD0, 0x15, 0x12, 0x00});
+        }
+    }
+
+    EdgeCoverage coverage;
+    Random random(seed);
+
+#ifndef _WIN32
+    signalCrashPath = crashDir + "/crash-signal.bin";
+    std::signal(SIGSEGV, onCrashSignal);
+    std::signal(SIGBUS, onCrashSignal);
+    std::signal(SIGFPE, onCrashSignal);
+    std::signal(SIGABRT, onCrashSignal);
+#endif
+
+    for (const std::vector<uint8_t>& input : corpus) {
+        runInput(input.data(), input.size(), maxCycles, &coverage);
+        coverage.fresh.clear();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto lastReport = start;
+    uint64_t executed = 0;
+    std::vector<uint8_t> input;
+    for (; runs == 0 || executed < runs; ++executed) {
+        input = corpus[random.below(static_cast<uint32_t>(corpus.size()))];
+        mutate(input, random, corpus);
+#ifndef _WIN32
+        currentInput = &input;
+#endif
+        runInput(input.data(), input.size(), maxCycles, &coverage);
+        if (!coverage.fresh.empty()) {  // Reached something new: keep it
+            corpus.push_back(input);
+            coverage.fresh.clear();
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastReport >= std::chrono::seconds(2)) {
+            lastReport = now;
+            double seconds = std::chrono::duration<double>(now - start).count();
+            std::printf("[FUZZ] #%llu  corpus %zu  edges %u  %.0f exec/s\n",
+                        static_cast<unsigned long long>(executed), corpus.size(), coverage.total,
+                        executed / seconds);
+            std::fflush(stdout);
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("[FUZZ] %llu inputs in %.1fs (%.0f exec/s), corpus %zu, edges %u, no crashes\n",
+                static_cast<unsigned long long>(executed), seconds, executed / (seconds > 0 ? seconds : 1),
+                corpus.size(), coverage.total);
+    return 0;
+}
+
+#endif // CHIP8_LIBFUZZER
@@ -0,0 +1,331 @@
+#include "chip8.h"
+#include "debugger.h"
+#include "frame_recorder.h"
+#include "frame_server.h"
+#include "report.h"
+#include "trace.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * CHIP-8 Headless Runner
+ *
+ * Runs a ROM without a window, audio or input for a fixed number of
+ * frames. Used by the ROM regression farm:
+ *
+ * 1. RECORD: Write one framebuffer hash per frame to a text file
+ *      chip8_headless game.ch8 --frames 600 --hashes game.golden
+ *
+ * 2. COMPARE: Check a run against a golden file in a single pass
+ *      chip8_headless game.ch8 --frames 600 --golden game.golden
+ *    Stops at the first frame whose hash differs and exits with 1.
+ *
+ * 3. RECORD FRAMES: Also capture drawn frames for later inspection
+ *      chip8_headless game.ch8 --frames 600 --record game.c8rec
+ *
+ * 4. DEBUG: Log machine state whenever a breakpoint, watchpoint or
+ *    register condition triggers, then keep running
+ *      chip8_headless game.ch8 --break 0x2A4 --watch 0x300:16:w --break-if V3==10
+ *    (each option can be given several times; without any of them the
+ *    debugger is not attached and the core runs at full speed)
+ *
+ * 5. TRACE: Record every executed instruction into a binary ring file
+ *      chip8_headless game.ch8 --trace game.c8trace
+ *      chip8_tracedump game.c8trace --last 100
+ *    --trace-records N sets the ring size (a power of two, default 1M)
+ *
+ * 6. STREAM: Serve the display to chip8_viewer clients (kiosk mode)
+ *      chip8_headless game.ch8 --frames 216000 --fps 60 --stream tcp:9000
+ *      chip8_viewer tcp:9000
+ *    --fps paces the run to real time; without it frames go out as
+ *    fast as the core runs them
+ *
+ * 7. STOP ON LOOP: End emulation once the machine repeats a whole state
+ *      chip8_headless game.ch8 --frames 216000 --stop-on-loop on --golden game.golden
+ *    Headless runs press no keys, so a repeated Chip8::getStateHash()
+ *    means every later frame repeats too (a halted ROM, or an attract
+ *    mode cycling forever). The remaining frames' hashes are replayed
+ *    from the cycle, so --hashes and --golden see exactly what a full
+ *    run would; --record, --trace, --stream and the debugger stop there
+ *
+ * HASH FILE FORMAT:
+ * One line per frame, 16 lowercase hex digits (line N = frame N).
+ * Plain text so golden files diff nicely in code review.
+ */
+
+// Emulation speed (matches the interactive frontend)
+constexpr int CPU_FREQ_HZ = 700;  // CHIP-8 CPU cycles per second
+constexpr int TIMER_FREQ_HZ = 60; // Timer updates (= frames) per second
+constexpr int DEFAULT_FRAMES = 600;  // 10 seconds of emulated time
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <ROM file> [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --frames N            Frames to run (default " << DEFAULT_FRAMES << ")\n";
+    std::cerr << "  --cycles-per-frame N  CPU cycles per frame (default "
+              << CPU_FREQ_HZ / TIMER_FREQ_HZ << ")\n";
+    std::cerr << "  --hashes FILE         Write per-frame framebuffer hashes\n";
+    std::cerr << "  --golden FILE         Compare per-frame hashes against FILE\n";
+    std::cerr << "  --record FILE         Record drawn frames (see chip8_rec2img)\n";
+    std::cerr << "  --quirks NAME         chip8, chip48, schip or xochip (default chip8)\n";
+    std::cerr << "  --break ADDR          Stop and log state when PC reaches ADDR\n";
+    std::cerr << "  --watch ADDR[:LEN][:r|w|rw]  Log I-relative memory accesses\n";
+    std::cerr << "  --break-if COND       Log when COND becomes true (e.g. V3==10, I>0x300)\n";
+    std::cerr << "  --aot on|off          Use built-in compiled ROMs (default on)\n";
+    std::cerr << "  --trace FILE          Record executed instructions (see chip8_tracedump)\n";
+    std::cerr << "  --trace-records N     Instructions kept in the trace (power of two, default "
+              << TraceWriter::DEFAULT_CAPACITY << ")\n";
+    std::cerr << "  --stream ADDRESS      Serve frames to viewers (tcp:[HOST:]PORT or unix:PATH)\n";
+    std::cerr << "  --fps N               Limit to N frames per second (0 = unlimited, default)\n";
+    std::cerr << "  --stop-on-loop on|off Stop emulating once a machine state repeats (default off)\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string romPath = argv[1];
+    long frames = DEFAULT_FRAMES;
+    long cyclesPerFrame = CPU_FREQ_HZ / TIMER_FREQ_HZ;
+    std::string hashesPath;
+    std::string goldenPath;
+    std::string recordPath;
+    QuirkProfile quirks = QuirkProfile::Chip8;
+    Debugger debugger;
+    bool debugging = false;
+    bool useCompiledRoms = true;
+    std::string tracePath;
+    unsigned long traceRecords = TraceWriter::DEFAULT_CAPACITY;
+    std::string streamAddress;
+    long fps = 0;
+    bool stopOnLoop = false;
+
+    // Parse options (each one takes exactly one value)
+    for (int i = 2; i < argc; ++i) {
+        std::string option = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+
+        if (option == "--frames") {
+            frames = std::strtol(value.c_str(), nullptr, 10);
+        } else if (option == "--cycles-per-frame") {
+            cyclesPerFrame = std::strtol(value.c_str(), nullptr, 10);
+        } else if (option == "--hashes") {
+            hashesPath = value;
+        } else if (option == "--golden") {
+            goldenPath = value;
+        } else if (option == "--record") {
+            recordPath = value;
+        } else if (option == "--quirks") {
+            if (!parseQuirkProfile(value, quirks)) {
+                std::cerr << "[ERROR] Unknown quirk profile: " << value << "\n";
+                return 1;
+            }
+        } else if (option == "--break") {
+            char* end = nullptr;
+            long address = std::strtol(value.c_str(), &end, 0);
+            if (*end != '\0' || address < 0 || address > 0xFFFF) {
+                std::cerr << "[ERROR] Bad breakpoint address: " << value << "\n";
+                return 1;
+            }
+            debugger.addBreakpoint(static_cast<uint16_t>(address));
+            debugging = true;
+        } else if (option == "--watch") {
+            uint16_t address;
+            uint16_t length;
+            WatchAccess access;
+            if (!Debugger::parseWatchpoint(value, address, length, access)) {
+                std::cerr << "[ERROR] Bad watchpoint: " << value << "\n";
+                return 1;
+            }
+            debugger.addWatchpoint(address, length, access);
+            debugging = true;
+        } else if (option == "--break-if") {
+            int reg;
+            CompareOp op;
+            uint16_t compareValue;
+            if (!Debugger::parseCondition(value, reg, op, compareValue)) {
+                std::cerr << "[ERROR] Bad condition: " << value << "\n";
+                return 1;
+            }
+            debugger.addCondition(reg, op, compareValue);
+            debugging = true;
+        } else if (option == "--aot") {
+            if (value != "on" && value != "off") {
+                std::cerr << "[ERROR] --aot takes on or off\n";
+                return 1;
+            }
+            useCompiledRoms = (value == "on");
+        } else if (option == "--trace") {
+            tracePath = value;
+        } else if (option == "--trace-records") {
+            traceRecords = std::strtoul(value.c_str(), nullptr, 10);
+        } else if (option == "--stream") {
+            streamAddress = value;
+        } else if (option == "--fps") {
+            fps = std::strtol(value.c_str(), nullptr, 10);
+        } else if (option == "--stop-on-loop") {
+            if (value != "on" && value != "off") {
+                std::cerr << "[ERROR] --stop-on-loop takes on or off\n";
+                return 1;
+            }
+            stopOnLoop = (value == "on");
+        } else {
+            std::cerr << "[ERROR] Unknown option: " << option << "\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    Chip8 chip8;
+    chip8.setQuirkProfile(quirks);
+    chip8.setCompiledRomsEnabled(useCompiledRoms);
+    if (!loadROMFile(chip8, romPath)) {
+        std::cerr << "[ERROR] Failed to load ROM\n";
+        return 1;
+    }
+    if (debugging) {
+        chip8.attachDebugger(&debugger);
+    }
+
+    TraceWriter tracer;
+    if (!tracePath.empty()) {
+        if (traceRecords > 0xFFFFFFFFul ||
+            !tracer.open(tracePath, static_cast<uint32_t>(traceRecords))) {
+            return 1;
+        }
+        chip8.attachTracer(&tracer);
+        std::cout << "[TRACE] Tracing to " << tracePath << " (last " << traceRecords << " instructions)\n";
+    }
+
+    std::ofstream hashes;
+    if (!hashesPath.empty()) {
+        hashes.open(hashesPath);
+        if (!hashes.is_open()) {
+            std::cerr << "[ERROR] Cannot write hashes: " << hashesPath << "\n";
+            return 1;
+        }
+    }
+
+    std::ifstream golden;
+    if (!goldenPath.empty()) {
+        golden.open(goldenPath);
+        if (!golden.is_open()) {
+            std::cerr << "[ERROR] Cannot read golden file: " << goldenPath << "\n";
+            return 1;
+        }
+    }
+
+    FrameRecorder recorder;
+    if (!recordPath.empty() && !recorder.open(recordPath)) {
+        return 1;
+    }
+
+    FrameServer server;
+    if (!streamAddress.empty() && !server.open(streamAddress)) {
+        return 1;
+    }
+
+    // Main loop: one iteration = one 60Hz frame
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    char line[32] = "";
+    
+    // --stop-on-loop: frame after which each state hash was first seen,
+    // and every emulated frame's framebuffer hash for the replay
+    std::unordered_map<uint64_t, long> stateFrames;
+    std::vector<uint64_t> frameHashes;
+    long loopStart = 0;    // First frame of the repeating cycle
+    long loopLength = 0;   // 0 until a state repeats
+    uint32_t unknownOpcodesReported = 0;
+    
+    for (long frame = 0; frame < frames; ++frame) {
+        uint64_t hash;
+        if (loopLength > 0) {
+            // Frame N repeats frame N - loopLength: replay its hash
+            hash = frameHashes[loopStart + (frame - loopStart) % loopLength];
+        } else {
+            if (fps > 0) {
+                // Absolute deadlines, so sleep overshoot does not accumulate
+                std::this_thread::sleep_until(start + std::chrono::microseconds(frame * 1000000 / fps));
+            }
+
+            // A debugger stop ends the batch early: log it, resume, and run
+            // the rest of the frame's cycles
+            uint32_t remaining = static_cast<uint32_t>(cyclesPerFrame);
+            while (remaining > 0) {
+                remaining -= chip8.runCycles(remaining);
+                if (!debugger.hasBreak()) {
+                    break;  // Frame done (or FX0A is waiting for a key)
+                }
+                std::cout << "[DEBUG] Frame " << frame << ": " << debugger.describe(chip8);
+                debugger.resume();
+            }
+            chip8.updateTimers();
+            reportUnknownOpcodes(chip8, unknownOpcodesReported);
+
+            const uint64_t dirtyRows = chip8.takeDirtyRows();
+            if (chip8.shouldDraw()) {
+                recorder.capture(chip8, dirtyRows, static_cast<uint32_t>(frame));
+                chip8.clearDrawFlag();
+            }
+            server.publish(chip8, dirtyRows, static_cast<uint32_t>(frame));
+            hash = chip8.getFramebufferHash();
+
+            if (stopOnLoop) {
+                frameHashes.push_back(hash);
+                auto seen = stateFrames.emplace(chip8.getStateHash(), frame);
+                if (!seen.second) {
+                    loopStart = seen.first->second + 1;
+                    loopLength = frame - seen.first->second;
+                    std::cout << "[HEADLESS] Frame " << frame << " repeats the state of frame "
+                              << seen.first->second << ": stopping emulation, replaying its "
+                              << loopLength << "-frame cycle\n";
+                }
+            }
+        }
+
+        // WHY snprintf? Formatting 16 hex digits by hand into a stack
+        // buffer is much cheaper than iostream manipulators per frame
+        std::snprintf(line, sizeof(line), "%016llx", static_cast<unsigned long long>(hash));
+
+        if (hashes.is_open()) {
+            hashes << line << '\n';
+        }
+
+        if (golden.is_open()) {
+            std::string expected;
+            if (!std::getline(golden, expected)) {
+                std::cerr << "[HEADLESS] Golden file ends at frame " << frame << "\n";
+                return 1;
+            }
+            if (expected != line) {
+                std::cerr << "[HEADLESS] MISMATCH at frame " << frame
+                          << ": expected " << expected << ", got " << line << "\n";
+                return 1;
+            }
+        }
+    }
+
+    std::cout << "[HEADLESS] Ran " << frames << " frames, final hash " << line << "\n";
+    if (tracer.isOpen()) {
+        std::cout << "[TRACE] " << tracer.getWritten() << " instructions traced\n";
+    }
+    if (golden.is_open()) {
+        std::cout << "[HEADLESS] All frames match " << goldenPath << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,270 @@
+#include "chip8.h"
+#include "netplay.h"
+#include "udp_transport.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * CHIP-8 Netplay Loopback Test
+ *
+ * Plays a two-player session entirely inside one process: two machines,
+ * two rollback sessions, two real UDP sockets on 127.0.0.1, and scripted
+ * random key presses for both players. The sockets can be made as bad
+ * as a real link:
+ *
+ *   chip8_netplay game.ch8                               clean network
+ *   chip8_netplay game.ch8 --latency 60 --jitter 40 --loss 10
+ *   chip8_netplay game.ch8 --quirks xochip --max-rollback 12 --frames 3600
+ *
+ * Afterwards the final state of both sides must equal an offline run
+ * of the same ROM with the same keys (no network, no prediction). That
+ * is the whole point of rollback: whatever the network did, the game
+ * ends up exactly where it would have without one.
+ *
+ * It also reports what the rollbacks cost in host time, against the
+ * 16.7ms a 60Hz frame may take. Time is simulated (each tick advances
+ * the clock by one frame), so a 60-second session takes well under a
+ * second and a run with the same --seed is repeatable.
+ *
+ * Exits with 1 on a mismatch or a detected desync.
+ */
+
+constexpr int CYCLES_PER_FRAME = 11;     // ~700Hz CPU at 60 frames per second
+constexpr double FRAME_SECONDS = 1.0 / 60.0;
+constexpr uint32_t DEFAULT_FRAMES = 1800;   // 30 seconds of play
+constexpr uint16_t DEFAULT_PORT = 47800;    // And the next one
+
+static_assert(RollbackSession::MAX_PACKET_SIZE <= UdpTransport::MAX_DATAGRAM, "packets must fit a datagram");
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <ROM file> [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --frames N          Frames each side plays (default " << DEFAULT_FRAMES << ")\n";
+    std::cerr << "  --latency MS        One-way delay added to every packet (default 0)\n";
+    std::cerr << "  --jitter MS         Up to this much more, random (default 0)\n";
+    std::cerr << "  --loss PERCENT      Packets dropped (default 0)\n";
+    std::cerr << "  --max-rollback N    Frames a side may predict (default 8, max "
+              << RollbackSession::MAX_ROLLBACK << ")\n";
+    std::cerr << "  --quirks NAME       chip8, chip48, schip or xochip (default chip8)\n";
+    std::cerr << "  --port N            First of the two UDP ports used (default " << DEFAULT_PORT << ")\n";
+    std::cerr << "  --seed N            Seed for keys and network conditions (default 1)\n";
+}
+
+// ==================== SCRIPTED PLAYERS ====================
+
+/*
+ * A player's keys for every frame: hold one random key (or nothing) for
+ * a random 1-30 frames, then pick again. Precomputed, so the offline
+ * reference run sees exactly the same keys.
+ */
+std::vector<uint16_t> scriptKeys(uint64_t seed, uint32_t frames) {
+    std::vector<uint16_t> keys(frames);
+    uint64_t state = seed;
+    uint32_t frame = 0;
+    while (frame < frames) {
+        state = mix64(state + 1);
+        uint32_t hold = 1 + static_cast<uint32_t>(state % 30);
+        uint32_t key = static_cast<uint32_t>((state >> 8) % 20);   // 16..19 = no key
+        uint16_t mask = key < Chip8::KEY_COUNT ? static_cast<uint16_t>(1u << key) : 0;
+        for (uint32_t i = 0; i < hold && frame < frames; ++i) {
+            keys[frame++] = mask;
+        }
+    }
+    return keys;
+}
+
+// ==================== ONE SIDE ====================
+
+struct Side {
+    Chip8 machine;
+    UdpTransport net;
+    std::unique_ptr<RollbackSession> session;
+    std::vector<uint16_t> keys;
+    double slowestTick = 0.0;   // Seconds: receive + advance (incl. rollback) + send
+    double totalTick = 0.0;
+    uint64_t ticks = 0;
+};
+
+/*
+ * One host frame of one side, exactly what a frontend does per frame:
+ * drain the socket, advance (unless done or too far ahead), send.
+ */
+void tick(Side& side, uint32_t frames, double now) {
+    auto start = std::chrono::steady_clock::now();
+
+    uint8_t packet[UdpTransport::MAX_DATAGRAM];
+    while (std::size_t size = side.net.receive(packet, sizeof(packet), now)) {
+        side.session->readPacket(packet, size);
+    }
+    if (side.session->frame() < frames) {
+        side.session->advance(side.keys[side.session->frame()]);
+    } else {
+        side.session->rollback();
+    }
+    side.net.send(packet, side.session->writePacket(packet), now);
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    side.slowestTick = std::max(side.slowestTick, seconds);
+    side.totalTick += seconds;
+    ++side.ticks;
+}
+
+void printSide(const char* name, const Side& side) {
+    const NetplayStats& stats = side.session->stats();
+    std::printf("[NET] %s: %llu rollbacks, %llu frames re-simulated (deepest %u), %llu stalls, "
+                "%llu/%llu packets dropped\n", name,
+                static_cast<unsigned long long>(stats.rollbacks),
+                static_cast<unsigned long long>(stats.framesResimulated), stats.deepestRollback,
+                static_cast<unsigned long long>(stats.stalls),
+                static_cast<unsigned long long>(side.net.droppedCount()),
+                static_cast<unsigned long long>(side.net.sentCount()));
+    std::printf("[NET] %s: slowest rollback %.1f us, slowest frame %.1f us, mean frame %.2f us "
+                "(budget %.0f us)\n", name, stats.slowestRollback * 1e6, side.slowestTick * 1e6,
+                side.ticks ? side.totalTick / side.ticks * 1e6 : 0.0, FRAME_SECONDS * 1e6);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string romPath = argv[1];
+    uint32_t frames = DEFAULT_FRAMES;
+    NetConditions conditions;
+    NetplayConfig config;
+    config.cyclesPerFrame = CYCLES_PER_FRAME;
+    QuirkProfile quirks = QuirkProfile::Chip8;
+    long port = DEFAULT_PORT;
+    uint64_t seed = 1;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string option = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (option == "--frames") {
+            frames = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (option == "--latency") {
+            conditions.latency = std::strtod(value.c_str(), nullptr) / 1000.0;
+        } else if (option == "--jitter") {
+            conditions.jitter = std::strtod(value.c_str(), nullptr) / 1000.0;
+        } else if (option == "--loss") {
+            conditions.loss = std::strtod(value.c_str(), nullptr) / 100.0;
+        } else if (option == "--max-rollback") {
+            config.maxRollback = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (option == "--quirks") {
+            if (!parseQuirkProfile(value, quirks)) {
+                std::cerr << "[ERROR] Unknown quirk profile: " << value << "\n";
+                return 1;
+            }
+        } else if (option == "--port") {
+            port = std::strtol(value.c_str(), nullptr, 10);
+        } else if (option == "--seed") {
+            seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (port <= 0 || port >= 65535) {
+        std::cerr << "[ERROR] Invalid port: " << port << "\n";
+        return 1;
+    }
+
+    std::ifstream file(romPath, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Cannot open ROM: " << romPath << "\n";
+        return 1;
+    }
+    std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    config.sessionId = RollbackSession::sessionIdFor(rom.data(), rom.size(), quirks);
+
+    // Both players, and the offline reference
+    Side sides[2];
+    Chip8 reference;
+    for (Chip8* machine : {&sides[0].machine, &sides[1].machine, &reference}) {
+        machine->setQuirkProfile(quirks);
+        if (!machine->loadROM(rom.data(), rom.size())) {
+            std::cerr << "[ERROR] ROM does not fit in memory\n";
+            return 1;
+        }
+    }
+    const uint16_t ports[2] = {static_cast<uint16_t>(port), static_cast<uint16_t>(port + 1)};
+    for (int s = 0; s < 2; ++s) {
+        Side& side = sides[s];
+        side.keys = scriptKeys(mix64(seed) + s, frames);
+        side.session.reset(new RollbackSession(side.machine, config));
+        if (!side.net.open(ports[s], "127.0.0.1", ports[1 - s])) {
+            return 1;
+        }
+        NetConditions sideConditions = conditions;
+        sideConditions.seed = mix64(seed ^ (s + 1));
+        side.net.setConditions(sideConditions);
+    }
+
+    // Play until both sides ran every frame and know every remote key;
+    // the cap only matters if the link is so lossy nothing gets through
+    const uint64_t maxTicks = 10ull * frames + 6000;
+    uint64_t tickCount = 0;
+    for (; tickCount < maxTicks; ++tickCount) {
+        const double now = tickCount * FRAME_SECONDS;
+        tick(sides[0], frames, now);
+        tick(sides[1], frames, now);
+        bool finished = true;
+        for (const Side& side : sides) {
+            finished = finished && side.session->frame() == frames && side.session->confirmedFrame() >= frames;
+        }
+        if (finished) {
+            break;
+        }
+    }
+    for (Side& side : sides) {
+        side.session->rollback();   // A correction that arrived on the last tick
+    }
+
+    // Offline: same seed, both players' keys every frame, no network
+    reference.seedRandom(RollbackSession::seedFor(config.sessionId));
+    for (uint32_t f = 0; f < frames; ++f) {
+        reference.setKeys(static_cast<uint16_t>(sides[0].keys[f] | sides[1].keys[f]));
+        reference.runCycles(config.cyclesPerFrame);
+        reference.updateTimers();
+    }
+
+    std::printf("[NET] %u frames in %llu ticks (%.0f ms latency, %.0f ms jitter, %.0f%% loss, "
+                "max rollback %u)\n", frames, static_cast<unsigned long long>(tickCount),
+                conditions.latency * 1000, conditions.jitter * 1000, conditions.loss * 100,
+                config.maxRollback);
+    printSide("player 1", sides[0]);
+    printSide("player 2", sides[1]);
+
+    bool ok = true;
+    const uint64_t expected = reference.getStateHash();
+    for (int s = 0; s < 2; ++s) {
+        const Side& side = sides[s];
+        if (side.session->frame() != frames || side.session->confirmedFrame() < frames) {
+            std::printf("[NET] player %d: did not finish (frame %u, confirmed %u)\n", s + 1,
+                        side.session->frame(), side.session->confirmedFrame());
+            ok = false;
+        } else if (side.machine.getStateHash() != expected) {
+            std::printf("[NET] player %d: final state differs from the offline run\n", s + 1);
+            ok = false;
+        }
+        if (side.session->desynced()) {
+            std::printf("[NET] player %d: desync detected at frame %u\n", s + 1, side.session->desyncAt());
+            ok = false;
+        }
+    }
+    std::printf("[NET] %s\n", ok ? "PASS: both sides match the offline run" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,192 @@
+#include "frame_recorder.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * CHIP-8 Recording Converter
+ *
+ * Turns a .c8rec stream (see frame_recorder.h) into images or video:
+ *
+ *   chip8_rec2img run.c8rec frames/run --format ppm
+ *     -> frames/run_000000.ppm, frames/run_000003.ppm, ...
+ *        (one binary PPM per recorded frame, named by emulated frame number)
+ *
+ *   chip8_rec2img run.c8rec run.y4m --format y4m
+ *     -> a 60 FPS YUV4MPEG2 video. Frames where nothing was drawn are
+ *        filled by repeating the previous frame, so playback speed
+ *        matches emulated time. Any video tool can take it from there:
+ *        ffmpeg -i run.y4m run.mp4
+ *        The video is always sized for 128x64; 64x32 frames are scaled
+ *        up 2x more, so SUPER-CHIP mode switches (00FE/00FF) keep
+ *        the same picture size.
+ *
+ * --scale N makes every CHIP-8 pixel an N x N block (default 8).
+ */
+
+constexpr int DEFAULT_SCALE = 8;
+constexpr int VIDEO_FPS = 60;
+
+/*
+ * Expand a 1-bit frame into an 8-bit image (0 = black, 255 = white)
+ * with every pixel repeated scale times in both directions
+ */
+void expandFrame(const CapturedFrame& frame, int scale, std::vector<uint8_t>& out) {
+    int width = frame.width * scale;
+    int height = frame.height * scale;
+    out.resize(static_cast<std::size_t>(width) * height);
+
+    for (int y = 0; y < frame.height; ++y) {
+        uint8_t* line = &out[static_cast<std::size_t>(y) * scale * width];
+
+        for (int x = 0; x < frame.width; ++x) {
+            uint8_t byte = frame.bits[(y * frame.width + x) / 8];
+            uint8_t value = (byte & (0x80 >> (x % 8))) ? 255 : 0;
+            for (int s = 0; s < scale; ++s) {
+                line[x * scale + s] = value;
+            }
+        }
+
+        // Repeat the finished line for the remaining scale - 1 lines
+        for (int s = 1; s < scale; ++s) {
+            std::copy(line, line + width, line + static_cast<std::size_t>(s) * width);
+        }
+    }
+}
+
+bool writePPM(const std::string& path, const std::vector<uint8_t>& gray, int width, int height) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out.is_open()) {
+        std::cerr << "[ERROR] Cannot write " << path << "\n";
+        return false;
+    }
+
+    // P6 = binary RGB; expand each gray value to three equal channels
+    out << "P6\n" << width << " " << height << "\n255\n";
+    std::vector<uint8_t> rgb(gray.size() * 3);
+    for (std::size_t i = 0; i < gray.size(); ++i) {
+        rgb[i * 3] = rgb[i * 3 + 1] = rgb[i * 3 + 2] = gray[i];
+    }
+    out.write(reinterpret_cast<const char*>(rgb.data()), rgb.size());
+    return true;
+}
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <recording.c8rec> <output> [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --format ppm|y4m  Output format (default ppm)\n";
+    std::cerr << "  --scale N         Pixel scale factor (default " << DEFAULT_SCALE << ")\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string inputPath = argv[1];
+    std::string outputPath = argv[2];
+    std::string format = "ppm";
+    int scale = DEFAULT_SCALE;
+
+    for (int i = 3; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        if (option == "--format") {
+            format = argv[i + 1];
+        } else if (option == "--scale") {
+            scale = std::atoi(argv[i + 1]);
+        } else {
+            std::cerr << "[ERROR] Unknown option: " << option << "\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((format != "ppm" && format != "y4m") || scale < 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    FrameStreamReader reader;
+    if (!reader.open(inputPath)) {
+        return 1;
+    }
+
+    std::ofstream video;
+    int videoWidth = 0;
+    int videoHeight = 0;
+    bool haveVideoFrame = false;
+    uint32_t nextVideoFrame = 0;
+
+    CapturedFrame frame;
+    std::vector<uint8_t> image;
+    std::vector<uint8_t> previousImage;
+    uint64_t count = 0;
+
+    while (reader.next(frame)) {
+        // y4m has one resolution per stream: bring every frame to 128x64
+        int frameScale = scale;
+        if (format == "y4m" && frame.width > 0 && Chip8::DISPLAY_WIDTH % frame.width == 0) {
+            frameScale = scale * (Chip8::DISPLAY_WIDTH / frame.width);
+        }
+        expandFrame(frame, frameScale, image);
+        int width = frame.width * frameScale;
+        int height = frame.height * frameScale;
+
+        if (format == "ppm") {
+            char suffix[32];
+            std::snprintf(suffix, sizeof(suffix), "_%06u.ppm", static_cast<unsigned>(frame.frame));
+            if (!writePPM(outputPath + suffix, image, width, height)) {
+                return 1;
+            }
+        } else {
+            if (!video.is_open()) {
+                video.open(outputPath, std::ios::binary);
+                if (!video.is_open()) {
+                    std::cerr << "[ERROR] Cannot write " << outputPath << "\n";
+                    return 1;
+                }
+                // Cmono = luma plane only, which is all a 1-bit display needs
+                videoWidth = Chip8::DISPLAY_WIDTH * scale;
+                videoHeight = Chip8::DISPLAY_HEIGHT * scale;
+                video << "YUV4MPEG2 W" << videoWidth << " H" << videoHeight
+                      << " F" << VIDEO_FPS << ":1 Ip A1:1 Cmono\n";
+                nextVideoFrame = frame.frame;
+            }
+
+            if (width != videoWidth || height != videoHeight) {
+                // Only a corrupt or foreign record has other sizes
+                std::cerr << "[ERROR] Unexpected " << static_cast<int>(frame.width) << "x" << static_cast<int>(frame.height)
+                          << " frame " << frame.frame << " in y4m output\n";
+                return 1;
+            }
+
+            // Hold the previous image for frames where nothing was drawn
+            while (haveVideoFrame && nextVideoFrame < frame.frame) {
+                video << "FRAME\n";
+                video.write(reinterpret_cast<const char*>(previousImage.data()), previousImage.size());
+                ++nextVideoFrame;
+            }
+
+            video << "FRAME\n";
+            video.write(reinterpret_cast<const char*>(image.data()), image.size());
+            nextVideoFrame = frame.frame + 1;
+            haveVideoFrame = true;
+            previousImage.swap(image);
+        }
+
+        ++count;
+    }
+
+    if (reader.isCorrupt()) {
+        std::cerr << "[ERROR] Corrupt record after " << count << " frames\n";
+        return 1;
+    }
+
+    std::cout << "[REC2IMG] Converted " << count << " frames\n";
+    return 0;
+}
@@ -0,0 +1,374 @@
+#include "cfg.h"
+#include "chip8.h"
+#include "disassembler.h"
+#include "hash.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/*
+ * CHIP-8 Static Recompiler
+ *
+ * Translates a ROM into a C++ file that is compiled into the emulator:
+ *
+ *   chip8_recompile roms/pong.ch8 aot/pong.cpp
+ *   chip8_recompile roms/game.ch8 aot/game.cpp --quirks schip
+ *
+ * then rebuild. Loading that exact ROM (same bytes, same profile) runs
+ * the compiled blocks; anything else is interpreted as usual.
+ *
+ * WHAT IS GENERATED:
+ * One function per basic block found by analyzeControlFlow(). Each
+ * function is a switch with a case per instruction that falls through
+ * to the next, so a run can enter at any instruction of the block and
+ * stop after any instruction when the cycle budget runs out:
+ *
+ *   case 0x206:  // ADD V0, 0x03
+ *       V[0x0] = static_cast<uint8_t>(V[0x0] + 0x03);
+ *       if (++n == budget) { pc = 0x208; return n; }
+ *       [[fallthrough]];
+ *
+ * Register moves, arithmetic, I updates, jumps, calls, returns and
+ * register skips are compiled with the profile's quirks baked in.
+ * Everything else (drawing, memory, keys, timers, random numbers...)
+ * calls the interpreter for that one instruction, so its behaviour is
+ * exactly the interpreter's. Blocks the analyzer found to be modified by
+ * the ROM itself are left out entirely.
+ */
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <ROM file> <output .cpp> [--quirks NAME]\n";
+}
+
+static std::string baseName(const std::string& path) {
+    std::size_t slash = path.find_last_of("/\\");
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+/*
+ * Emits the body of one block
+ */
+template <typename Quirks>
+class BlockEmitter {
+public:
+    BlockEmitter(FILE* out, const std::vector<uint8_t>& rom) : out(out), rom(rom) {}
+
+    void emit(const BasicBlock& block);
+
+private:
+    FILE* out;
+    const std::vector<uint8_t>& rom;
+
+    uint16_t word(uint32_t address) const {
+        std::size_t offset = address - Chip8::ROM_START_ADDRESS;
+        return static_cast<uint16_t>((rom[offset] << 8) | rom[offset + 1]);
+    }
+    bool hasWord(uint32_t address) const {
+        return address + 2 <= Chip8::ROM_START_ADDRESS + rom.size();
+    }
+    uint32_t lengthAt(uint32_t address) const {
+        if (Quirks::XOCHIP_OPCODES && hasWord(address + 2) && word(address) == 0xF000) {
+            return 4;
+        }
+        return 2;
+    }
+
+    bool emitNative(uint16_t op, uint32_t address);
+    void emitInterpreted(uint16_t op, uint32_t address, bool terminator);
+    void emitTerminator(const BasicBlock& block, uint16_t op, uint32_t address, uint32_t next);
+};
+
+/*
+ * Straight-line instructions compiled natively (true), or false if the
+ * interpreter must run it. Semantics mirror Chip8::executeOpcode.
+ */
+template <typename Quirks>
+bool BlockEmitter<Quirks>::emitNative(uint16_t op, uint32_t address) {
+    const unsigned x = (op >> 8) & 0xF;
+    const unsigned y = (op >> 4) & 0xF;
+    const unsigned nn = op & 0xFF;
+
+    switch (op & 0xF000) {
+        case 0x6000:
+            std::fprintf(out, "        V[0x%X] = 0x%02X;\n", x, nn);
+            return true;
+        case 0x7000:
+            std::fprintf(out, "        V[0x%X] = static_cast<uint8_t>(V[0x%X] + 0x%02X);\n", x, x, nn);
+            return true;
+        case 0xA000:
+            std::fprintf(out, "        I = 0x%03X;\n", op & 0x0FFF);
+            return true;
+        case 0x8000:
+            break;
+        case 0xF000:
+            if (Quirks::XOCHIP_OPCODES && op == 0xF000 && lengthAt(address) == 4) {
+                std::fprintf(out, "        I = 0x%04X;\n", word(address + 2));
+                return true;
+            }
+            if ((op & 0x00FF) == 0x1E) {
+                std::fprintf(out, "        I = static_cast<uint16_t>(I + V[0x%X]);\n", x);
+                return true;
+            }
+            return false;
+        default:
+            return false;
+    }
+
+    // 8XYN
+    const char* resetVF = Quirks::LOGIC_RESETS_VF ? " V[0xF] = 0;" : "";
+    const unsigned source = Quirks::SHIFT_USES_VY ? y : x;
+    switch (op & 0x000F) {
+        case 0x0:
+            std::fprintf(out, "        V[0x%X] = V[0x%X];\n", x, y);
+            return true;
+        case 0x1:
+            std::fprintf(out, "        V[0x%X] |= V[0x%X];%s\n", x, y, resetVF);
+            return true;
+        case 0x2:
+            std::fprintf(out, "        V[0x%X] &= V[0x%X];%s\n", x, y, resetVF);
+            return true;
+        case 0x3:
+            std::fprintf(out, "        V[0x%X] ^= V[0x%X];%s\n", x, y, resetVF);
+            return true;
+        case 0x4:
+            std::fprintf(out, "        { unsigned sum = V[0x%X] + V[0x%X]; V[0x%X] = static_cast<uint8_t>(sum); "
+                              "V[0xF] = sum > 0xFF ? 1 : 0; }\n", x, y, x);
+            return true;
+        case 0x5:
+            std::fprintf(out, "        { uint8_t noBorrow = V[0x%X] >= V[0x%X] ? 1 : 0; "
+                              "V[0x%X] = static_cast<uint8_t>(V[0x%X] - V[0x%X]); V[0xF] = noBorrow; }\n",
+                         x, y, x, x, y);
+            return true;
+        case 0x6:
+            std::fprintf(out, "        { uint8_t source = V[0x%X]; V[0x%X] = source >> 1; "
+                              "V[0xF] = source & 0x01; }\n", source, x);
+            return true;
+        case 0x7:
+            std::fprintf(out, "        { uint8_t noBorrow = V[0x%X] >= V[0x%X] ? 1 : 0; "
+                              "V[0x%X] = static_cast<uint8_t>(V[0x%X] - V[0x%X]); V[0xF] = noBorrow; }\n",
+                         y, x, x, y, x);
+            return true;
+        case 0xE:
+            std::fprintf(out, "        { uint8_t source = V[0x%X]; V[0x%X] = static_cast<uint8_t>(source << 1); "
+                              "V[0xF] = (source & 0x80) >> 7; }\n", source, x);
+            return true;
+        default:
+            return false;  // Unknown 8XYN: the interpreter logs it
+    }
+}
+
+template <typename Quirks>
+void BlockEmitter<Quirks>::emitInterpreted(uint16_t op, uint32_t address, bool terminator) {
+    std::fprintf(out, "        pc = 0x%03X;\n", address);
+    if (terminator) {
+        std::fprintf(out, "        X::interpret<Quirks>(c, 0x%04X);\n", op);
+        std::fprintf(out, "        return n + 1;\n");
+    } else {
+        // Stores may overwrite compiled code, FX0A starts waiting: stop then
+        std::fprintf(out, "        if (X::interpret<Quirks>(c, 0x%04X)) { return n + 1; }\n", op);
+    }
+}
+
+/*
+ * Last instruction of a block that ends in control flow
+ */
+template <typename Quirks>
+void BlockEmitter<Quirks>::emitTerminator(const BasicBlock& block, uint16_t op,
+                                          uint32_t address, uint32_t next) {
+    const unsigned x = (op >> 8) & 0xF;
+    const unsigned y = (op >> 4) & 0xF;
+    const unsigned nn = op & 0xFF;
+
+    const char* condition = nullptr;
+    char buffer[64];
+    switch (block.exit) {
+        case BlockExit::Jump:
+            std::fprintf(out, "        pc = 0x%03X;\n        return n + 1;\n", op & 0x0FFF);
+            return;
+        case BlockExit::Call:
+            std::fprintf(out, "        X::call(c, 0x%03X, 0x%03X);\n        return n + 1;\n",
+                         address, op & 0x0FFF);
+            return;
+        case BlockExit::Return:
+            std::fprintf(out, "        X::ret(c);\n        return n + 1;\n");
+            return;
+        case BlockExit::Skip:
+            if ((op & 0xF000) == 0x3000) {
+                std::snprintf(buffer, sizeof(buffer), "V[0x%X] == 0x%02X", x, nn);
+                condition = buffer;
+            } else if ((op & 0xF000) == 0x4000) {
+                std::snprintf(buffer, sizeof(buffer), "V[0x%X] != 0x%02X", x, nn);
+                condition = buffer;
+            } else if ((op & 0xF000) == 0x5000) {
+                std::snprintf(buffer, sizeof(buffer), "V[0x%X] == V[0x%X]", x, y);
+                condition = buffer;
+            } else if ((op & 0xF000) == 0x9000) {
+                std::snprintf(buffer, sizeof(buffer), "V[0x%X] != V[0x%X]", x, y);
+                condition = buffer;
+            }
+            if (condition != nullptr) {
+                std::fprintf(out, "        pc = (%s) ? 0x%03X : 0x%03X;\n        return n + 1;\n",
+                             condition, next + lengthAt(next), next);
+                return;
+            }
+            break;  // EX9E / EXA1: keys live in the interpreter
+        default:
+            break;  // BNNN, 00FD
+    }
+    emitInterpreted(op, address, true);
+}
+
+template <typename Quirks>
+void BlockEmitter<Quirks>::emit(const BasicBlock& block) {
+    std::fprintf(out, "// 0x%03X - 0x%03X (%s)\n", block.start, block.end - 1, blockExitName(block.exit));
+    std::fprintf(out, "uint32_t block_%03X(Chip8& c, uint32_t budget) {\n", block.start);
+    std::fprintf(out, "    auto& V = X::V(c);\n    uint16_t& I = X::I(c);\n    uint16_t& pc = X::pc(c);\n");
+    std::fprintf(out, "    (void)V;\n    (void)I;\n    (void)budget;\n    uint32_t n = 0;\n");
+    std::fprintf(out, "    switch (pc) {\n");
+
+    char text[32];
+    for (uint32_t address = block.start; address < block.end; ) {
+        uint16_t op = word(address);
+        uint32_t length = lengthAt(address);
+        uint32_t next = address + length;
+        disassemble(op, length == 4 ? word(address + 2) : 0, text, sizeof(text));
+        std::fprintf(out, "    case 0x%03X:  // %s\n", address, text);
+
+        if (next >= block.end && block.exit != BlockExit::Fallthrough) {
+            emitTerminator(block, op, address, next);
+        } else {
+            if (!emitNative(op, address)) {
+                emitInterpreted(op, address, false);
+            }
+            if (next >= block.end) {
+                std::fprintf(out, "        pc = 0x%03X;\n        return n + 1;\n", next);
+            } else {
+                std::fprintf(out, "        if (++n == budget) { pc = 0x%03X; return n; }\n", next);
+                std::fprintf(out, "        [[fallthrough]];\n");
+            }
+        }
+        address = next;
+    }
+
+    std::fprintf(out, "    default:\n        return 0;  // Not an instruction boundary\n    }\n}\n\n");
+}
+
+template <typename Quirks>
+static void generate(FILE* out, const std::vector<uint8_t>& rom, const std::string& romName,
+                     const char* quirksType, QuirkProfile profile) {
+    ControlFlowGraph cfg = analyzeControlFlow(rom.data(), rom.size(), profile);
+    uint64_t romHash = hashBytes(rom.data(), rom.size());
+
+    std::fprintf(out, "// Generated by chip8_recompile from %s (%s profile). Do not edit.\n",
+                 romName.c_str(), quirkProfileName(profile));
+    std::fprintf(out, "#include \"aot.h\"\n\nnamespace {\n\n");
+    std::fprintf(out, "using X = CompiledRomAccess;\nusing Quirks = %s;\n\n", quirksType);
+
+    BlockEmitter<Quirks> emitter(out, rom);
+    std::vector<const BasicBlock*> compiled;
+    int skipped = 0;
+    for (const BasicBlock& block : cfg.blocks) {
+        if (block.selfModified) {
+            ++skipped;  // The ROM rewrites it: leave it to the interpreter
+            continue;
+        }
+        emitter.emit(block);
+        compiled.push_back(&block);
+    }
+
+    std::fprintf(out, "const CompiledBlock BLOCKS[] = {\n");
+    for (const BasicBlock* block : compiled) {
+        std::fprintf(out, "    {0x%03X, 0x%03X, block_%03X},\n", block->start, block->end, block->start);
+    }
+    std::fprintf(out, "};\n\n");
+
+    // The ROM bytes, so loadState() can tell which blocks memory still holds
+    std::fprintf(out, "const uint8_t IMAGE[] = {");
+    for (std::size_t i = 0; i < rom.size(); ++i) {
+        std::fprintf(out, "%s0x%02X,", (i % 16 == 0) ? "\n    " : " ", rom[i]);
+    }
+    std::fprintf(out, "\n};\n\n");
+
+    std::fprintf(out, "const CompiledRom ROM = {\n");
+    std::fprintf(out, "    0x%016llXULL, %zu, QuirkProfile::", static_cast<unsigned long long>(romHash), rom.size());
+    switch (profile) {
+        case QuirkProfile::Chip48:    std::fprintf(out, "Chip48"); break;
+        case QuirkProfile::SuperChip: std::fprintf(out, "SuperChip"); break;
+        case QuirkProfile::XoChip:    std::fprintf(out, "XoChip"); break;
+        case QuirkProfile::Chip8:
+        default:                      std::fprintf(out, "Chip8"); break;
+    }
+    std::fprintf(out, ", \"");
+    for (char ch : romName) {
+        if (ch == '"' || ch == '\\') {
+            std::fputc('\\', out);
+        }
+        std::fputc(ch, out);
+    }
+    std::fprintf(out, "\",\n    BLOCKS, sizeof(BLOCKS) / sizeof(BLOCKS[0]), IMAGE\n};\n\n");
+    std::fprintf(out, "const CompiledRomRegistrar REGISTRAR(&ROM);\n\n}  // namespace\n");
+
+    std::cout << "[AOT] " << compiled.size() << " blocks compiled";
+    if (skipped > 0) {
+        std::cout << ", " << skipped << " self-modified blocks left to the interpreter";
+    }
+    if (!cfg.indirectJumps.empty()) {
+        std::cout << ", " << cfg.indirectJumps.size() << " indirect jumps (targets interpreted)";
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3 && argc != 5) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string romPath = argv[1];
+    std::string outputPath = argv[2];
+    QuirkProfile profile = QuirkProfile::Chip8;
+    if (argc == 5) {
+        if (std::string(argv[3]) != "--quirks" || !parseQuirkProfile(argv[4], profile)) {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::ifstream file(romPath, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Cannot open ROM: " << romPath << "\n";
+        return 1;
+    }
+    std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+
+    FILE* out = std::fopen(outputPath.c_str(), "w");
+    if (out == nullptr) {
+        std::cerr << "[ERROR] Cannot write: " << outputPath << "\n";
+        return 1;
+    }
+
+    std::string romName = baseName(romPath);
+    switch (profile) {
+        case QuirkProfile::Chip48:
+            generate<Chip48Quirks>(out, rom, romName, "Chip48Quirks", profile);
+            break;
+        case QuirkProfile::SuperChip:
+            generate<SuperChipQuirks>(out, rom, romName, "SuperChipQuirks", profile);
+            break;
+        case QuirkProfile::XoChip:
+            generate<XoChipQuirks>(out, rom, romName, "XoChipQuirks", profile);
+            break;
+        case QuirkProfile::Chip8:
+        default:
+            generate<Chip8Quirks>(out, rom, romName, "Chip8Quirks", profile);
+            break;
+    }
+
+    std::fclose(out);
+    std::cout << "[AOT] Wrote " << outputPath << "\n";
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "disassembler.h"
+#include "trace.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * CHIP-8 Trace Decoder
+ *
+ * Prints a binary trace (see trace.h) as text, oldest record first:
+ *
+ *   chip8_tracedump run.c8trace
+ *   chip8_tracedump run.c8trace --last 200
+ *
+ *   cycle        pc    opcode  instruction         changed
+ *   1048570      0x2A4 0x7301  ADD V3, 0x01        V3=0x11
+ *
+ * The trace holds the last `capacity` instructions of the run; older
+ * ones were overwritten in the ring. --last N prints only the newest N
+ * (handy after a crash: the interesting part is at the end).
+ *
+ * XO-CHIP "LD I, 0xNNNN" (F000) shows its operand from the I it loaded,
+ * since the trace stores one opcode word per instruction.
+ */
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <trace file> [--last N]\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 2 && argc != 4) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    uint64_t last = 0;  // 0 = everything in the file
+    if (argc == 4) {
+        if (std::string(argv[2]) != "--last") {
+            printUsage(argv[0]);
+            return 1;
+        }
+        last = std::strtoull(argv[3], nullptr, 10);
+    }
+
+    std::ifstream file(argv[1], std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "[ERROR] Cannot open trace: " << argv[1] << "\n";
+        return 1;
+    }
+
+    TraceHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+        std::cerr << "[ERROR] Not a CHIP-8 trace: " << argv[1] << "\n";
+        return 1;
+    }
+    if (header.version != TRACE_VERSION || header.recordSize != sizeof(TraceRecord) ||
+        header.capacity == 0) {
+        std::cerr << "[ERROR] Unsupported trace version " << header.version << "\n";
+        return 1;
+    }
+
+    std::vector<TraceRecord> records(header.capacity);
+    file.read(reinterpret_cast<char*>(records.data()),
+              static_cast<std::streamsize>(records.size() * sizeof(TraceRecord)));
+    if (!file) {
+        std::cerr << "[ERROR] Trace is truncated\n";
+        return 1;
+    }
+
+    // The ring holds records [first, written); slot = index % capacity
+    uint64_t written = header.written;
+    uint64_t first = written > header.capacity ? written - header.capacity : 0;
+    if (last != 0 && written - first > last) {
+        first = written - last;
+    }
+
+    std::printf("%-12s %-5s %-7s %-19s %s\n", "cycle", "pc", "opcode", "instruction", "changed");
+    char text[32];
+    char changed[16];
+    for (uint64_t n = first; n < written; ++n) {
+        const TraceRecord& r = records[n % header.capacity];
+        uint16_t nextWord = (r.reg == TRACE_REGISTER_I) ? r.value : 0;
+        disassemble(r.opcode, nextWord, text, sizeof(text));
+
+        if (r.reg < 16) {
+            std::snprintf(changed, sizeof(changed), "V%X=0x%02X", r.reg, r.value);
+        } else if (r.reg == TRACE_REGISTER_I) {
+            std::snprintf(changed, sizeof(changed), "I=0x%04X", r.value);
+        } else {
+            changed[0] = '\0';
+        }
+
+        std::printf("%-12llu 0x%03X 0x%04X  %-19s %s\n",
+                    static_cast<unsigned long long>(r.cycle), r.pc, r.opcode, text, changed);
+    }
+
+    return 0;
+}
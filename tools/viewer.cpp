@@ -0,0 +1,239 @@
+#include "chip8.h"
+#include "frame_server.h"
+#include "hash.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+/*
+ * CHIP-8 Stream Viewer
+ *
+ * Headless client for a frame server (chip8-emulator or chip8_headless
+ * started with --stream). Applies keyframes and deltas to its own copy
+ * of the display, and can print it as text:
+ *
+ *   chip8_viewer tcp:9000                         until the server closes
+ *   chip8_viewer unix:/tmp/kiosk.sock --frames 600 --print-every 60
+ *   chip8_viewer tcp:9000 --slow 100              lag behind on purpose
+ *
+ * --slow sleeps after every message, like a viewer on a bad link; the
+ * server should then skip its deltas and send keyframes instead, and the
+ * picture must still end up identical.
+ *
+ * At exit it reports message counts and the display hash, the XOR of
+ * hashSlot(word, row word) over plane 0. For a CHIP-8 ROM in 64x32 that
+ * is the same value chip8_headless prints as its final hash.
+ */
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " tcp:[HOST:]PORT | unix:PATH [options]\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --frames N         Stop after N messages (default: until the server closes)\n";
+    std::cerr << "  --slow MS          Sleep MS after every message (simulate a slow viewer)\n";
+    std::cerr << "  --print-every N    Print the display as text every N messages (default 0 = never)\n";
+}
+
+#if defined(__linux__)
+// Connect to "tcp:[HOST:]PORT" or "unix:PATH"; -1 on failure
+static int connectTo(const std::string& address) {
+    if (address.compare(0, 4, "tcp:") == 0) {
+        std::string spec = address.substr(4);
+        std::string host = "127.0.0.1";
+        std::size_t colon = spec.rfind(':');
+        if (colon != std::string::npos) {
+            host = spec.substr(0, colon);
+            spec = spec.substr(colon + 1);
+        }
+        long port = std::strtol(spec.c_str(), nullptr, 10);
+        sockaddr_in remote;
+        std::memset(&remote, 0, sizeof(remote));
+        remote.sin_family = AF_INET;
+        remote.sin_port = htons(static_cast<uint16_t>(port));
+        if (port <= 0 || port > 65535 || ::inet_pton(AF_INET, host.c_str(), &remote.sin_addr) != 1) {
+            return -1;
+        }
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd >= 0 && ::connect(fd, reinterpret_cast<const sockaddr*>(&remote), sizeof(remote)) != 0) {
+            ::close(fd);
+            fd = -1;
+        }
+        return fd;
+    }
+    if (address.compare(0, 5, "unix:") == 0) {
+        std::string path = address.substr(5);
+        sockaddr_un remote;
+        std::memset(&remote, 0, sizeof(remote));
+        remote.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(remote.sun_path)) {
+            return -1;
+        }
+        std::memcpy(remote.sun_path, path.c_str(), path.size());
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && ::connect(fd, reinterpret_cast<const sockaddr*>(&remote), sizeof(remote)) != 0) {
+            ::close(fd);
+            fd = -1;
+        }
+        return fd;
+    }
+    return -1;
+}
+
+// Read exactly size bytes; false once the server has closed
+static bool readFully(int fd, uint8_t* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t n = ::recv(fd, data, size, 0);
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+#endif
+
+static uint32_t getU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static uint64_t getU64(const uint8_t* p) {
+    return static_cast<uint64_t>(getU32(p)) | (static_cast<uint64_t>(getU32(p + 4)) << 32);
+}
+
+// One '#' per lit pixel, '.' otherwise
+static void printDisplay(const uint64_t* rows, int width, int height, uint32_t frame) {
+    std::cout << "[VIEWER] Frame " << frame << " (" << width << "x" << height << ")\n";
+    std::string line;
+    for (int y = 0; y < height; ++y) {
+        line.clear();
+        for (int x = 0; x < width; ++x) {
+            uint64_t word = rows[y * Chip8::ROW_WORDS + x / 64];
+            line += (word >> (63 - x % 64)) & 1 ? '#' : '.';
+        }
+        std::cout << line << '\n';
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc % 2 != 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string address = argv[1];
+    long maxMessages = 0;
+    long slowMs = 0;
+    long printEvery = 0;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--frames") {
+            maxMessages = std::strtol(value.c_str(), nullptr, 10);
+        } else if (option == "--slow") {
+            slowMs = std::strtol(value.c_str(), nullptr, 10);
+        } else if (option == "--print-every") {
+            printEvery = std::strtol(value.c_str(), nullptr, 10);
+        } else {
+            std::cerr << "[ERROR] Unknown option: " << option << "\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+#if !defined(__linux__)
+    std::cerr << "[ERROR] chip8_viewer is not available on this platform (Linux only)\n";
+    return 1;
+#else
+    int fd = connectTo(address);
+    if (fd < 0) {
+        std::cerr << "[ERROR] Cannot connect to " << address << "\n";
+        return 1;
+    }
+
+    uint8_t hello[FRAME_SERVER_HELLO_SIZE];
+    if (!readFully(fd, hello, sizeof(hello)) || std::memcmp(hello, FRAME_SERVER_MAGIC, sizeof(FRAME_SERVER_MAGIC)) != 0 ||
+        hello[4] != FRAME_SERVER_VERSION) {
+        std::cerr << "[ERROR] " << address << " is not a version " << int(FRAME_SERVER_VERSION) << " frame server\n";
+        ::close(fd);
+        return 1;
+    }
+
+    std::array<uint64_t, Chip8::DISPLAY_HEIGHT * Chip8::ROW_WORDS> rows{};
+    int width = 0;
+    int height = 0;
+    uint32_t frame = 0;
+    long messages = 0;
+    long keyframes = 0;
+    long deltas = 0;
+    long rowsReceived = 0;
+    bool synced = false;   // Had a keyframe; deltas before it would be a server bug
+
+    uint8_t header[FRAME_MESSAGE_HEADER_SIZE];
+    while ((maxMessages == 0 || messages < maxMessages) && readFully(fd, header, sizeof(header))) {
+        const uint8_t type = header[0];
+        const uint64_t rowMask = getU64(header + 8);
+        if (type != FRAME_MESSAGE_KEYFRAME && type != FRAME_MESSAGE_DELTA) {
+            std::cerr << "[ERROR] Unknown message type " << int(type) << "\n";
+            ::close(fd);
+            return 1;
+        }
+        if (type == FRAME_MESSAGE_DELTA && !synced) {
+            std::cerr << "[ERROR] Delta before the first keyframe\n";
+            ::close(fd);
+            return 1;
+        }
+        for (uint64_t left = rowMask; left != 0; left &= left - 1) {
+            const int y = __builtin_ctzll(left);
+            uint8_t row[FRAME_ROW_BYTES];
+            if (!readFully(fd, row, sizeof(row))) {
+                std::cerr << "[ERROR] Stream ended inside a message\n";
+                ::close(fd);
+                return 1;
+            }
+            for (int w = 0; w < Chip8::ROW_WORDS; ++w) {
+                rows[y * Chip8::ROW_WORDS + w] = getU64(row + 8 * w);
+            }
+            ++rowsReceived;
+        }
+
+        synced = true;
+        width = header[1];
+        height = header[2];
+        frame = getU32(header + 4);
+        ++messages;
+        ++(type == FRAME_MESSAGE_KEYFRAME ? keyframes : deltas);
+
+        if (printEvery > 0 && messages % printEvery == 0) {
+            printDisplay(rows.data(), width, height, frame);
+        }
+        if (slowMs > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(slowMs));
+        }
+    }
+    ::close(fd);
+
+    uint64_t hash = 0;
+    for (int word = 0; word < Chip8::DISPLAY_HEIGHT * Chip8::ROW_WORDS; ++word) {
+        hash ^= hashSlot(word, rows[word]);
+    }
+    char hex[32];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+    std::cout << "[VIEWER] " << messages << " messages (" << keyframes << " keyframes, " << deltas
+              << " deltas, " << rowsReceived << " rows), last frame " << frame << ", display hash " << hex << "\n";
+    return 0;
+#endif
+}